@@ -0,0 +1,119 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/miniconda/lib/cmake/GTest/GTestConfig.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestConfigVersion.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestTargets-release.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestTargets.cmake"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/benchmarks/CMakeLists.txt"
+  "/root/repo/benchmarks/rotate_chain/CMakeLists.txt"
+  "/root/repo/cmake/AddEigen3.cmake"
+  "/root/repo/cmake/AddGTest.cmake"
+  "/root/repo/cmake/WaveGeometryHelpers.cmake"
+  "/root/repo/test/CMakeLists.txt"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkTargets-none.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkTargets.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindDependencyMacro.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseArguments.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindBoost.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGTest.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/GoogleTest.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  "/usr/share/eigen3/cmake/Eigen3Config.cmake"
+  "/usr/share/eigen3/cmake/Eigen3ConfigVersion.cmake"
+  "/usr/share/eigen3/cmake/Eigen3Targets.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "benchmarks/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "benchmarks/rotate_chain/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/tests.dir/DependInfo.cmake"
+  "CMakeFiles/benchmarks.dir/DependInfo.cmake"
+  "CMakeFiles/benchmark.dir/DependInfo.cmake"
+  "test/CMakeFiles/rotation_test.dir/DependInfo.cmake"
+  "test/CMakeFiles/vector_expression_test.dir/DependInfo.cmake"
+  "test/CMakeFiles/rvalue_expression_test.dir/DependInfo.cmake"
+  "test/CMakeFiles/rigid_transform_test.dir/DependInfo.cmake"
+  "test/CMakeFiles/manifold_test.dir/DependInfo.cmake"
+  "test/CMakeFiles/batch_test.dir/DependInfo.cmake"
+  "test/CMakeFiles/lanes_test.dir/DependInfo.cmake"
+  "test/CMakeFiles/point_cloud_test.dir/DependInfo.cmake"
+  "test/CMakeFiles/layout_view_test.dir/DependInfo.cmake"
+  "test/CMakeFiles/imu_preint_test.dir/DependInfo.cmake"
+  "test/CMakeFiles/is_same_test.dir/DependInfo.cmake"
+  "test/CMakeFiles/reverse_jacobian_test.dir/DependInfo.cmake"
+  "test/CMakeFiles/shared_test.dir/DependInfo.cmake"
+  "test/CMakeFiles/constant_test.dir/DependInfo.cmake"
+  "test/CMakeFiles/rewrite_test.dir/DependInfo.cmake"
+  "test/CMakeFiles/jacobian_chain_test.dir/DependInfo.cmake"
+  "test/CMakeFiles/index_sequence_test.dir/DependInfo.cmake"
+  "test/CMakeFiles/type_list_test.dir/DependInfo.cmake"
+  "test/CMakeFiles/util_cross_matrix.dir/DependInfo.cmake"
+  "test/CMakeFiles/identity_matrix_test.dir/DependInfo.cmake"
+  "test/CMakeFiles/block_matrix_test.dir/DependInfo.cmake"
+  "test/CMakeFiles/batch_math_test.dir/DependInfo.cmake"
+  "test/CMakeFiles/thread_pool_test.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/util_cross_matrix_bench.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/util_identity_bench.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/util_block_matrix_bench.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/batch_exp_log_bench.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/point_cloud_bench.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/jacobian_chain_bench.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/quaternion_exp_log_bench.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/exp_map_bench.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/batch_exp_log_bench.dir/batch_exp_log_bench.cpp.o"
+  "CMakeFiles/batch_exp_log_bench.dir/batch_exp_log_bench.cpp.o.d"
+  "batch_exp_log_bench"
+  "batch_exp_log_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/batch_exp_log_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
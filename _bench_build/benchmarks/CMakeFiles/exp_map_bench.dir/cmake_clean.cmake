@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/exp_map_bench.dir/exp_map_bench.cpp.o"
+  "CMakeFiles/exp_map_bench.dir/exp_map_bench.cpp.o.d"
+  "exp_map_bench"
+  "exp_map_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exp_map_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
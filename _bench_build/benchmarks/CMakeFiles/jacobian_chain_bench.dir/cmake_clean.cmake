@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/jacobian_chain_bench.dir/jacobian_chain_bench.cpp.o"
+  "CMakeFiles/jacobian_chain_bench.dir/jacobian_chain_bench.cpp.o.d"
+  "jacobian_chain_bench"
+  "jacobian_chain_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/jacobian_chain_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
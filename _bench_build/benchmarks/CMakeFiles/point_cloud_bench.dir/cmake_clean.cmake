@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/point_cloud_bench.dir/point_cloud_bench.cpp.o"
+  "CMakeFiles/point_cloud_bench.dir/point_cloud_bench.cpp.o.d"
+  "point_cloud_bench"
+  "point_cloud_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/point_cloud_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/quaternion_exp_log_bench.dir/quaternion_exp_log_bench.cpp.o"
+  "CMakeFiles/quaternion_exp_log_bench.dir/quaternion_exp_log_bench.cpp.o.d"
+  "quaternion_exp_log_bench"
+  "quaternion_exp_log_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/quaternion_exp_log_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/util_block_matrix_bench.dir/util_block_matrix_bench.cpp.o"
+  "CMakeFiles/util_block_matrix_bench.dir/util_block_matrix_bench.cpp.o.d"
+  "util_block_matrix_bench"
+  "util_block_matrix_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/util_block_matrix_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
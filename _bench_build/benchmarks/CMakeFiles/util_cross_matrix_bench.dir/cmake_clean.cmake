@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/util_cross_matrix_bench.dir/util_cross_matrix_bench.cpp.o"
+  "CMakeFiles/util_cross_matrix_bench.dir/util_cross_matrix_bench.cpp.o.d"
+  "util_cross_matrix_bench"
+  "util_cross_matrix_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/util_cross_matrix_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
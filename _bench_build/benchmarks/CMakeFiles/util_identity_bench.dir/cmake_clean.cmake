@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/util_identity_bench.dir/util_identity_bench.cpp.o"
+  "CMakeFiles/util_identity_bench.dir/util_identity_bench.cpp.o.d"
+  "util_identity_bench"
+  "util_identity_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/util_identity_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,39 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/benchmarks
+# Build directory: /root/repo/_bench_build/benchmarks
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Bb][Ee][Nn][Cc][Hh][Mm][Aa][Rr][Kk])$")
+  add_test(util_cross_matrix_bench "/root/repo/_bench_build/benchmarks/util_cross_matrix_bench")
+  set_tests_properties(util_cross_matrix_bench PROPERTIES  LABELS "benchmark" _BACKTRACE_TRIPLES "/root/repo/cmake/WaveGeometryHelpers.cmake;63;ADD_TEST;/root/repo/benchmarks/CMakeLists.txt;6;wave_add_benchmark;/root/repo/benchmarks/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Bb][Ee][Nn][Cc][Hh][Mm][Aa][Rr][Kk])$")
+  add_test(util_identity_bench "/root/repo/_bench_build/benchmarks/util_identity_bench")
+  set_tests_properties(util_identity_bench PROPERTIES  LABELS "benchmark" _BACKTRACE_TRIPLES "/root/repo/cmake/WaveGeometryHelpers.cmake;63;ADD_TEST;/root/repo/benchmarks/CMakeLists.txt;7;wave_add_benchmark;/root/repo/benchmarks/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Bb][Ee][Nn][Cc][Hh][Mm][Aa][Rr][Kk])$")
+  add_test(util_block_matrix_bench "/root/repo/_bench_build/benchmarks/util_block_matrix_bench")
+  set_tests_properties(util_block_matrix_bench PROPERTIES  LABELS "benchmark" _BACKTRACE_TRIPLES "/root/repo/cmake/WaveGeometryHelpers.cmake;63;ADD_TEST;/root/repo/benchmarks/CMakeLists.txt;8;wave_add_benchmark;/root/repo/benchmarks/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Bb][Ee][Nn][Cc][Hh][Mm][Aa][Rr][Kk])$")
+  add_test(batch_exp_log_bench "/root/repo/_bench_build/benchmarks/batch_exp_log_bench")
+  set_tests_properties(batch_exp_log_bench PROPERTIES  LABELS "benchmark" _BACKTRACE_TRIPLES "/root/repo/cmake/WaveGeometryHelpers.cmake;63;ADD_TEST;/root/repo/benchmarks/CMakeLists.txt;9;wave_add_benchmark;/root/repo/benchmarks/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Bb][Ee][Nn][Cc][Hh][Mm][Aa][Rr][Kk])$")
+  add_test(point_cloud_bench "/root/repo/_bench_build/benchmarks/point_cloud_bench")
+  set_tests_properties(point_cloud_bench PROPERTIES  LABELS "benchmark" _BACKTRACE_TRIPLES "/root/repo/cmake/WaveGeometryHelpers.cmake;63;ADD_TEST;/root/repo/benchmarks/CMakeLists.txt;10;wave_add_benchmark;/root/repo/benchmarks/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Bb][Ee][Nn][Cc][Hh][Mm][Aa][Rr][Kk])$")
+  add_test(jacobian_chain_bench "/root/repo/_bench_build/benchmarks/jacobian_chain_bench")
+  set_tests_properties(jacobian_chain_bench PROPERTIES  LABELS "benchmark" _BACKTRACE_TRIPLES "/root/repo/cmake/WaveGeometryHelpers.cmake;63;ADD_TEST;/root/repo/benchmarks/CMakeLists.txt;11;wave_add_benchmark;/root/repo/benchmarks/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Bb][Ee][Nn][Cc][Hh][Mm][Aa][Rr][Kk])$")
+  add_test(quaternion_exp_log_bench "/root/repo/_bench_build/benchmarks/quaternion_exp_log_bench")
+  set_tests_properties(quaternion_exp_log_bench PROPERTIES  LABELS "benchmark" _BACKTRACE_TRIPLES "/root/repo/cmake/WaveGeometryHelpers.cmake;63;ADD_TEST;/root/repo/benchmarks/CMakeLists.txt;12;wave_add_benchmark;/root/repo/benchmarks/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Bb][Ee][Nn][Cc][Hh][Mm][Aa][Rr][Kk])$")
+  add_test(exp_map_bench "/root/repo/_bench_build/benchmarks/exp_map_bench")
+  set_tests_properties(exp_map_bench PROPERTIES  LABELS "benchmark" _BACKTRACE_TRIPLES "/root/repo/cmake/WaveGeometryHelpers.cmake;63;ADD_TEST;/root/repo/benchmarks/CMakeLists.txt;13;wave_add_benchmark;/root/repo/benchmarks/CMakeLists.txt;0;")
+endif()
+subdirs("rotate_chain")
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/benchmarks/rotate_chain
+# Build directory: /root/repo/_bench_build/benchmarks/rotate_chain
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../tests/batch_math_test"
+  "../tests/batch_math_test.pdb"
+  "CMakeFiles/batch_math_test.dir/util/batch_math_test.cpp.o"
+  "CMakeFiles/batch_math_test.dir/util/batch_math_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/batch_math_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../tests/block_matrix_test"
+  "../tests/block_matrix_test.pdb"
+  "CMakeFiles/block_matrix_test.dir/util/block_matrix_test.cpp.o"
+  "CMakeFiles/block_matrix_test.dir/util/block_matrix_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/block_matrix_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../tests/constant_test"
+  "../tests/constant_test.pdb"
+  "CMakeFiles/constant_test.dir/constant_test.cpp.o"
+  "CMakeFiles/constant_test.dir/constant_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/constant_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../tests/identity_matrix_test"
+  "../tests/identity_matrix_test.pdb"
+  "CMakeFiles/identity_matrix_test.dir/util/identity_matrix_test.cpp.o"
+  "CMakeFiles/identity_matrix_test.dir/util/identity_matrix_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/identity_matrix_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../tests/imu_preint_test"
+  "../tests/imu_preint_test.pdb"
+  "CMakeFiles/imu_preint_test.dir/imu_preint_test.cpp.o"
+  "CMakeFiles/imu_preint_test.dir/imu_preint_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/imu_preint_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
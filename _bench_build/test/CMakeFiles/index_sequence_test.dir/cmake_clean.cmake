@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../tests/index_sequence_test"
+  "../tests/index_sequence_test.pdb"
+  "CMakeFiles/index_sequence_test.dir/util/index_sequence_test.cpp.o"
+  "CMakeFiles/index_sequence_test.dir/util/index_sequence_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/index_sequence_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../tests/is_same_test"
+  "../tests/is_same_test.pdb"
+  "CMakeFiles/is_same_test.dir/is_same_test.cpp.o"
+  "CMakeFiles/is_same_test.dir/is_same_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/is_same_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
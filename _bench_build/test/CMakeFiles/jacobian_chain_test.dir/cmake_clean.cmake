@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../tests/jacobian_chain_test"
+  "../tests/jacobian_chain_test.pdb"
+  "CMakeFiles/jacobian_chain_test.dir/jacobian_chain_test.cpp.o"
+  "CMakeFiles/jacobian_chain_test.dir/jacobian_chain_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/jacobian_chain_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../tests/lanes_test"
+  "../tests/lanes_test.pdb"
+  "CMakeFiles/lanes_test.dir/lanes_test.cpp.o"
+  "CMakeFiles/lanes_test.dir/lanes_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lanes_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
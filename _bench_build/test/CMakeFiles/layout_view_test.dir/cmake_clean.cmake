@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../tests/layout_view_test"
+  "../tests/layout_view_test.pdb"
+  "CMakeFiles/layout_view_test.dir/layout_view_test.cpp.o"
+  "CMakeFiles/layout_view_test.dir/layout_view_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/layout_view_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
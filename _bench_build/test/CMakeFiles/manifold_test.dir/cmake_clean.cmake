@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../tests/manifold_test"
+  "../tests/manifold_test.pdb"
+  "CMakeFiles/manifold_test.dir/manifold_test.cpp.o"
+  "CMakeFiles/manifold_test.dir/manifold_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/manifold_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../tests/point_cloud_test"
+  "../tests/point_cloud_test.pdb"
+  "CMakeFiles/point_cloud_test.dir/point_cloud_test.cpp.o"
+  "CMakeFiles/point_cloud_test.dir/point_cloud_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/point_cloud_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
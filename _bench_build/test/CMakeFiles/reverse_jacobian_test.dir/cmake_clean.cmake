@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../tests/reverse_jacobian_test"
+  "../tests/reverse_jacobian_test.pdb"
+  "CMakeFiles/reverse_jacobian_test.dir/reverse_jacobian_test.cpp.o"
+  "CMakeFiles/reverse_jacobian_test.dir/reverse_jacobian_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/reverse_jacobian_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../tests/rewrite_test"
+  "../tests/rewrite_test.pdb"
+  "CMakeFiles/rewrite_test.dir/rewrite_test.cpp.o"
+  "CMakeFiles/rewrite_test.dir/rewrite_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rewrite_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../tests/rigid_transform_test"
+  "../tests/rigid_transform_test.pdb"
+  "CMakeFiles/rigid_transform_test.dir/rigid_transform_test.cpp.o"
+  "CMakeFiles/rigid_transform_test.dir/rigid_transform_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rigid_transform_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../tests/rvalue_expression_test"
+  "../tests/rvalue_expression_test.pdb"
+  "CMakeFiles/rvalue_expression_test.dir/rvalue_expression_test.cpp.o"
+  "CMakeFiles/rvalue_expression_test.dir/rvalue_expression_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rvalue_expression_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
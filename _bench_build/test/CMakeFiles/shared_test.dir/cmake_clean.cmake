@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../tests/shared_test"
+  "../tests/shared_test.pdb"
+  "CMakeFiles/shared_test.dir/shared_test.cpp.o"
+  "CMakeFiles/shared_test.dir/shared_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shared_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../tests/type_list_test"
+  "../tests/type_list_test.pdb"
+  "CMakeFiles/type_list_test.dir/util/type_list_test.cpp.o"
+  "CMakeFiles/type_list_test.dir/util/type_list_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/type_list_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
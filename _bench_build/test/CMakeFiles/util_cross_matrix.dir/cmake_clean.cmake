@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../tests/util_cross_matrix"
+  "../tests/util_cross_matrix.pdb"
+  "CMakeFiles/util_cross_matrix.dir/util/cross_matrix_test.cpp.o"
+  "CMakeFiles/util_cross_matrix.dir/util/cross_matrix_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/util_cross_matrix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
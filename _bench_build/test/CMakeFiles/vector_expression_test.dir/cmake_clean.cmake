@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../tests/vector_expression_test"
+  "../tests/vector_expression_test.pdb"
+  "CMakeFiles/vector_expression_test.dir/vector_expression_test.cpp.o"
+  "CMakeFiles/vector_expression_test.dir/vector_expression_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/vector_expression_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,52 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test
+# Build directory: /root/repo/_bench_build/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(rotation_test "/root/repo/_bench_build/tests/rotation_test")
+set_tests_properties(rotation_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/WaveGeometryHelpers.cmake;37;ADD_TEST;/root/repo/test/CMakeLists.txt;8;WAVE_ADD_TEST;/root/repo/test/CMakeLists.txt;0;")
+add_test(vector_expression_test "/root/repo/_bench_build/tests/vector_expression_test")
+set_tests_properties(vector_expression_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/WaveGeometryHelpers.cmake;37;ADD_TEST;/root/repo/test/CMakeLists.txt;9;WAVE_ADD_TEST;/root/repo/test/CMakeLists.txt;0;")
+add_test(rvalue_expression_test "/root/repo/_bench_build/tests/rvalue_expression_test")
+set_tests_properties(rvalue_expression_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/WaveGeometryHelpers.cmake;37;ADD_TEST;/root/repo/test/CMakeLists.txt;10;WAVE_ADD_TEST;/root/repo/test/CMakeLists.txt;0;")
+add_test(rigid_transform_test "/root/repo/_bench_build/tests/rigid_transform_test")
+set_tests_properties(rigid_transform_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/WaveGeometryHelpers.cmake;37;ADD_TEST;/root/repo/test/CMakeLists.txt;11;WAVE_ADD_TEST;/root/repo/test/CMakeLists.txt;0;")
+add_test(manifold_test "/root/repo/_bench_build/tests/manifold_test")
+set_tests_properties(manifold_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/WaveGeometryHelpers.cmake;37;ADD_TEST;/root/repo/test/CMakeLists.txt;12;WAVE_ADD_TEST;/root/repo/test/CMakeLists.txt;0;")
+add_test(batch_test "/root/repo/_bench_build/tests/batch_test")
+set_tests_properties(batch_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/WaveGeometryHelpers.cmake;37;ADD_TEST;/root/repo/test/CMakeLists.txt;13;WAVE_ADD_TEST;/root/repo/test/CMakeLists.txt;0;")
+add_test(lanes_test "/root/repo/_bench_build/tests/lanes_test")
+set_tests_properties(lanes_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/WaveGeometryHelpers.cmake;37;ADD_TEST;/root/repo/test/CMakeLists.txt;14;WAVE_ADD_TEST;/root/repo/test/CMakeLists.txt;0;")
+add_test(point_cloud_test "/root/repo/_bench_build/tests/point_cloud_test")
+set_tests_properties(point_cloud_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/WaveGeometryHelpers.cmake;37;ADD_TEST;/root/repo/test/CMakeLists.txt;15;WAVE_ADD_TEST;/root/repo/test/CMakeLists.txt;0;")
+add_test(layout_view_test "/root/repo/_bench_build/tests/layout_view_test")
+set_tests_properties(layout_view_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/WaveGeometryHelpers.cmake;37;ADD_TEST;/root/repo/test/CMakeLists.txt;16;WAVE_ADD_TEST;/root/repo/test/CMakeLists.txt;0;")
+add_test(imu_preint_test "/root/repo/_bench_build/tests/imu_preint_test")
+set_tests_properties(imu_preint_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/WaveGeometryHelpers.cmake;37;ADD_TEST;/root/repo/test/CMakeLists.txt;19;WAVE_ADD_TEST;/root/repo/test/CMakeLists.txt;0;")
+add_test(is_same_test "/root/repo/_bench_build/tests/is_same_test")
+set_tests_properties(is_same_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/WaveGeometryHelpers.cmake;37;ADD_TEST;/root/repo/test/CMakeLists.txt;22;WAVE_ADD_TEST;/root/repo/test/CMakeLists.txt;0;")
+add_test(reverse_jacobian_test "/root/repo/_bench_build/tests/reverse_jacobian_test")
+set_tests_properties(reverse_jacobian_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/WaveGeometryHelpers.cmake;37;ADD_TEST;/root/repo/test/CMakeLists.txt;23;WAVE_ADD_TEST;/root/repo/test/CMakeLists.txt;0;")
+add_test(shared_test "/root/repo/_bench_build/tests/shared_test")
+set_tests_properties(shared_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/WaveGeometryHelpers.cmake;37;ADD_TEST;/root/repo/test/CMakeLists.txt;24;WAVE_ADD_TEST;/root/repo/test/CMakeLists.txt;0;")
+add_test(constant_test "/root/repo/_bench_build/tests/constant_test")
+set_tests_properties(constant_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/WaveGeometryHelpers.cmake;37;ADD_TEST;/root/repo/test/CMakeLists.txt;25;WAVE_ADD_TEST;/root/repo/test/CMakeLists.txt;0;")
+add_test(rewrite_test "/root/repo/_bench_build/tests/rewrite_test")
+set_tests_properties(rewrite_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/WaveGeometryHelpers.cmake;37;ADD_TEST;/root/repo/test/CMakeLists.txt;26;WAVE_ADD_TEST;/root/repo/test/CMakeLists.txt;0;")
+add_test(jacobian_chain_test "/root/repo/_bench_build/tests/jacobian_chain_test")
+set_tests_properties(jacobian_chain_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/WaveGeometryHelpers.cmake;37;ADD_TEST;/root/repo/test/CMakeLists.txt;27;WAVE_ADD_TEST;/root/repo/test/CMakeLists.txt;0;")
+add_test(index_sequence_test "/root/repo/_bench_build/tests/index_sequence_test")
+set_tests_properties(index_sequence_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/WaveGeometryHelpers.cmake;37;ADD_TEST;/root/repo/test/CMakeLists.txt;30;WAVE_ADD_TEST;/root/repo/test/CMakeLists.txt;0;")
+add_test(type_list_test "/root/repo/_bench_build/tests/type_list_test")
+set_tests_properties(type_list_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/WaveGeometryHelpers.cmake;37;ADD_TEST;/root/repo/test/CMakeLists.txt;31;WAVE_ADD_TEST;/root/repo/test/CMakeLists.txt;0;")
+add_test(util_cross_matrix "/root/repo/_bench_build/tests/util_cross_matrix")
+set_tests_properties(util_cross_matrix PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/WaveGeometryHelpers.cmake;37;ADD_TEST;/root/repo/test/CMakeLists.txt;32;WAVE_ADD_TEST;/root/repo/test/CMakeLists.txt;0;")
+add_test(identity_matrix_test "/root/repo/_bench_build/tests/identity_matrix_test")
+set_tests_properties(identity_matrix_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/WaveGeometryHelpers.cmake;37;ADD_TEST;/root/repo/test/CMakeLists.txt;33;WAVE_ADD_TEST;/root/repo/test/CMakeLists.txt;0;")
+add_test(block_matrix_test "/root/repo/_bench_build/tests/block_matrix_test")
+set_tests_properties(block_matrix_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/WaveGeometryHelpers.cmake;37;ADD_TEST;/root/repo/test/CMakeLists.txt;34;WAVE_ADD_TEST;/root/repo/test/CMakeLists.txt;0;")
+add_test(batch_math_test "/root/repo/_bench_build/tests/batch_math_test")
+set_tests_properties(batch_math_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/WaveGeometryHelpers.cmake;37;ADD_TEST;/root/repo/test/CMakeLists.txt;35;WAVE_ADD_TEST;/root/repo/test/CMakeLists.txt;0;")
+add_test(thread_pool_test "/root/repo/_bench_build/tests/thread_pool_test")
+set_tests_properties(thread_pool_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/WaveGeometryHelpers.cmake;37;ADD_TEST;/root/repo/test/CMakeLists.txt;36;WAVE_ADD_TEST;/root/repo/test/CMakeLists.txt;0;")
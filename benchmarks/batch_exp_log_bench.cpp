@@ -0,0 +1,106 @@
+#include <benchmark/benchmark.h>
+#include "wave/geometry/geometry.hpp"
+#include "bechmark_helpers.hpp"
+
+// Compares the single-element SO(3) exp and log maps, called in a loop, with the
+// branch-free batch kernels over the same number of inputs.
+
+namespace {
+
+Eigen::Array<double, Eigen::Dynamic, 3> randomRotationVectors(Eigen::Index n) {
+    // Angles up to pi, as seen in practice
+    return Eigen::Array<double, Eigen::Dynamic, 3>::Random(n, 3) * 1.8;
+}
+
+}  // namespace
+
+void BM_ExpMapLoop(benchmark::State &state) {
+    const auto N = state.range(0);
+    const wave::RelativeRotationBatchd phi{randomRotationVectors(N)};
+
+    for (auto _ : state) {
+        for (auto i = N; i--;) {
+            const wave::RelativeRotationd phi_i = phi.get(i);
+            const auto result = evalImpl(wave::internal::expr<wave::ExpMap>{}, phi_i);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * N);
+}
+
+void BM_ExpMapBatch(benchmark::State &state) {
+    const auto N = state.range(0);
+    const wave::RelativeRotationBatchd phi{randomRotationVectors(N)};
+
+    for (auto _ : state) {
+        const auto result = wave::internal::expMapBatch(phi.value());
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * N);
+}
+
+void BM_ExpMapJacobianLoop(benchmark::State &state) {
+    const auto N = state.range(0);
+    const wave::RelativeRotationBatchd phi{randomRotationVectors(N)};
+
+    for (auto _ : state) {
+        for (auto i = N; i--;) {
+            const wave::RelativeRotationd phi_i = phi.get(i);
+            const auto &expr = wave::internal::expr<wave::ExpMap>{};
+            const auto result = evalImpl(expr, phi_i);
+            const auto jac = jacobianImpl(expr, result, phi_i);
+            benchmark::DoNotOptimize(result);
+            benchmark::DoNotOptimize(jac);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * N);
+}
+
+void BM_ExpMapJacobianBatch(benchmark::State &state) {
+    const auto N = state.range(0);
+    const wave::RelativeRotationBatchd phi{randomRotationVectors(N)};
+
+    for (auto _ : state) {
+        const auto result = wave::internal::expMapBatch(phi.value());
+        const auto jac = wave::internal::expMapJacobianBatch(phi.value());
+        benchmark::DoNotOptimize(result.data());
+        benchmark::DoNotOptimize(jac.data());
+    }
+    state.SetItemsProcessed(state.iterations() * N);
+}
+
+void BM_LogMapLoop(benchmark::State &state) {
+    const auto N = state.range(0);
+    const wave::RelativeRotationBatchd phi{randomRotationVectors(N)};
+    const wave::RotationMBatchd r{exp(phi)};
+
+    for (auto _ : state) {
+        for (auto i = N; i--;) {
+            const wave::RotationMd r_i = r.get(i);
+            const auto result = evalImpl(wave::internal::expr<wave::LogMap>{}, r_i);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * N);
+}
+
+void BM_LogMapBatch(benchmark::State &state) {
+    const auto N = state.range(0);
+    const wave::RelativeRotationBatchd phi{randomRotationVectors(N)};
+    const wave::RotationMBatchd r{exp(phi)};
+
+    for (auto _ : state) {
+        const auto result = wave::internal::logMapBatch(r.value());
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * N);
+}
+
+BENCHMARK(BM_ExpMapLoop)->RangeMultiplier(10)->Range(1000, 10000000);
+BENCHMARK(BM_ExpMapBatch)->RangeMultiplier(10)->Range(1000, 10000000);
+BENCHMARK(BM_ExpMapJacobianLoop)->RangeMultiplier(10)->Range(1000, 10000000);
+BENCHMARK(BM_ExpMapJacobianBatch)->RangeMultiplier(10)->Range(1000, 10000000);
+BENCHMARK(BM_LogMapLoop)->RangeMultiplier(10)->Range(1000, 10000000);
+BENCHMARK(BM_LogMapBatch)->RangeMultiplier(10)->Range(1000, 10000000);
+
+WAVE_BENCHMARK_MAIN()
@@ -0,0 +1,142 @@
+#include <benchmark/benchmark.h>
+#include "wave/geometry/geometry.hpp"
+#include "bechmark_helpers.hpp"
+
+// Compares the exp maps of rotation vectors and twists, for each leaf they evaluate to,
+// with the previous kernels: Rodrigues' formula with a dense square of the cross matrix
+// and separate sin and cos calls, and Eigen::AngleAxis for quaternions.
+
+namespace {
+
+const int N = 4;
+using L = wave::Lanes<double, N>;
+using R = wave::RelativeRotationd;
+using RL = wave::RelativeRotation<Eigen::Matrix<L, 3, 1>>;
+using M = wave::RotationMd;
+using Q = wave::RotationQd;
+using Tw = wave::Twistd;
+
+template <typename T>
+using EigenVector = std::vector<T, Eigen::aligned_allocator<T>>;
+
+struct Library {
+    template <typename Tangent>
+    static auto matrix(const Tangent &w) -> decltype(wave::exp(w).eval().value()) {
+        return wave::exp(w).eval().value();
+    }
+
+    static Eigen::Quaterniond quaternion(const R &w) {
+        return Q{wave::exp(w)}.value();
+    }
+
+    static Eigen::Matrix4d twist(const Tw &xi) {
+        return wave::exp(xi).eval().value();
+    }
+};
+
+struct Previous {
+    template <typename Tangent>
+    static auto matrix(const Tangent &w) -> decltype(wave::exp(w).eval().value()) {
+        using Scalar = typename wave::internal::traits<Tangent>::Scalar;
+        using Mat3 = Eigen::Matrix<Scalar, 3, 3>;
+        using std::cos;
+        using std::sin;
+        using std::sqrt;
+        const auto &r = w.value();
+        const Scalar angle2 = r.squaredNorm();
+        const Scalar angle = sqrt(angle2);
+        const Scalar sin_angle = sin(angle);
+        const Scalar cos_angle = cos(angle);
+        const auto large = wave::laneGreater(angle2, Eigen::NumTraits<Scalar>::epsilon());
+        const Scalar A = wave::laneSelect(large, Scalar{sin_angle / angle}, Scalar{1});
+        const Scalar B = wave::laneSelect(
+          large, Scalar{(Scalar{1} - cos_angle) / angle2}, Scalar{0.5});
+        return Mat3::Identity() + A * wave::crossMatrix(r) +
+               B * wave::crossMatrix(r) * wave::crossMatrix(r);
+    }
+
+    static Eigen::Quaterniond quaternion(const R &w) {
+        const double angle = w.value().norm();
+        return Eigen::Quaterniond{
+          Eigen::AngleAxisd{angle, w.value() / (angle > 0 ? angle : 1.0)}};
+    }
+
+    static Eigen::Matrix4d twist(const Tw &xi) {
+        using Mat3 = Eigen::Matrix3d;
+        const Eigen::Vector3d omega = xi.value().head<3>();
+        const double theta2 = omega.squaredNorm();
+        const double theta = std::sqrt(theta2);
+        const double A = theta2 > 1e-16 ? std::sin(theta) / theta : 1.0;
+        const double B = theta2 > 1e-16 ? (1.0 - std::cos(theta)) / theta2 : 0.5;
+        const double C = theta2 > 1e-16 ? (1.0 - A) / theta2 : 1.0 / 6;
+        const auto cross = wave::crossMatrix(omega);
+        const Mat3 cross2 = cross * cross;
+        const Mat3 V = Mat3::Identity() + B * cross + C * cross2;
+        Eigen::Matrix4d out = Eigen::Matrix4d::Identity();
+        out.topLeftCorner<3, 3>() = Mat3::Identity() + A * cross + B * cross2;
+        out.topRightCorner<3, 1>() = V * xi.value().tail<3>();
+        return out;
+    }
+};
+
+}  // namespace
+
+template <typename Kernel>
+void BM_ExpMatrix(benchmark::State &state) {
+    const auto w = randomMatrices<R>(1000);
+    for (auto _ : state) {
+        for (const auto &w_i : w) {
+            const Eigen::Matrix3d result = Kernel::matrix(w_i);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+}
+
+template <typename Kernel>
+void BM_ExpMatrixLanes(benchmark::State &state) {
+    EigenVector<RL> w(1000 / N);
+    for (auto &w_i : w) {
+        for (int j = 0; j < N; ++j) {
+            wave::setLane(w_i.value(), j, Eigen::Vector3d::Random());
+        }
+    }
+    for (auto _ : state) {
+        for (const auto &w_i : w) {
+            const Eigen::Matrix<L, 3, 3> result = Kernel::matrix(w_i);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+}
+
+template <typename Kernel>
+void BM_ExpQuaternion(benchmark::State &state) {
+    const auto w = randomMatrices<R>(1000);
+    for (auto _ : state) {
+        for (const auto &w_i : w) {
+            const Eigen::Quaterniond result = Kernel::quaternion(w_i);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+}
+
+template <typename Kernel>
+void BM_ExpTwist(benchmark::State &state) {
+    const auto xi = randomMatrices<Tw>(1000);
+    for (auto _ : state) {
+        for (const auto &xi_i : xi) {
+            const Eigen::Matrix4d result = Kernel::twist(xi_i);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_ExpMatrix, Library);
+BENCHMARK_TEMPLATE(BM_ExpMatrix, Previous);
+BENCHMARK_TEMPLATE(BM_ExpMatrixLanes, Library);
+BENCHMARK_TEMPLATE(BM_ExpMatrixLanes, Previous);
+BENCHMARK_TEMPLATE(BM_ExpQuaternion, Library);
+BENCHMARK_TEMPLATE(BM_ExpQuaternion, Previous);
+BENCHMARK_TEMPLATE(BM_ExpTwist, Library);
+BENCHMARK_TEMPLATE(BM_ExpTwist, Previous);
+
+WAVE_BENCHMARK_MAIN()
@@ -0,0 +1,206 @@
+#include <benchmark/benchmark.h>
+#include "wave/geometry/geometry.hpp"
+#include "bechmark_helpers.hpp"
+
+// Compares the jacobians of mixed SE(3), SO(3) and R^3 expressions found by multiplying
+// local jacobians from the target up (TypedJacobianEvaluator), from the root down
+// (AdjointJacobianEvaluator), and in the cheapest order (evaluateWithChainJacobians).
+// Also times a reverse sweep holding some leaves constant, products of the jacobians
+// with vectors, and writing the jacobians into a solver's row-major matrix.
+
+struct FrameE;
+
+namespace {
+
+using T_AB = wave::RigidTransformQFd<FrameA, FrameB>;
+using T_BC = wave::RigidTransformQFd<FrameB, FrameC>;
+using T_CD = wave::RigidTransformQFd<FrameC, FrameD>;
+using R_AB = wave::RotationQFd<FrameA, FrameB>;
+using R_BC = wave::RotationMFd<FrameB, FrameC>;
+using V_CCD = wave::RelativeRotationFd<FrameC, FrameC, FrameD>;
+
+struct Typed {
+    template <typename Derived, typename... Targets>
+    static auto run(const Derived &expr, const Targets &... targets)
+      -> decltype(wave::internal::evaluateWithTypedJacobians(expr, targets...)) {
+        return wave::internal::evaluateWithTypedJacobians(expr, targets...);
+    }
+};
+
+struct Adjoint {
+    template <typename Derived, typename... Targets>
+    static auto run(const Derived &expr, const Targets &... targets)
+      -> decltype(wave::internal::evaluateWithAdjointJacobians(expr, targets...)) {
+        return wave::internal::evaluateWithAdjointJacobians(expr, targets...);
+    }
+};
+
+struct Chain {
+    template <typename Derived, typename... Targets>
+    static auto run(const Derived &expr, const Targets &... targets)
+      -> decltype(wave::internal::evaluateWithChainJacobians(expr, targets...)) {
+        return wave::internal::evaluateWithChainJacobians(expr, targets...);
+    }
+};
+
+}  // namespace
+
+// A point through a chain of transforms, w.r.t. the last transform: two (3 x 3) jacobians
+// times a (3 x 6) jacobian
+template <typename Evaluator>
+void BM_PointThroughTransforms(benchmark::State &state) {
+    const auto T1 = T_AB::Random();
+    const auto T2 = T_BC::Random();
+    const auto T3 = T_CD::Random();
+    const auto p = wave::TranslationFd<FrameD, FrameD, FrameE>::Random();
+
+    for (auto _ : state) {
+        const auto res = Evaluator::run(T1 * (T2 * (T3 * p)), T3);
+        benchmark::DoNotOptimize(std::get<1>(res).data());
+    }
+}
+
+// A point rotated after a transform, w.r.t. the relative rotation deepest in the tree
+template <typename Evaluator>
+void BM_RotationsAndPoint(benchmark::State &state) {
+    const auto R1 = R_AB::Random();
+    const auto R2 = R_BC::Random();
+    const auto v = V_CCD::Random();
+    const auto T = wave::RigidTransformQFd<FrameC, FrameE>::Random();
+    const auto p = wave::TranslationFd<FrameE, FrameE, FrameA>::Random();
+
+    for (auto _ : state) {
+        const auto res = Evaluator::run(R1 * R2 * exp(v) * (T * p), v, T);
+        benchmark::DoNotOptimize(std::get<1>(res).data());
+        benchmark::DoNotOptimize(std::get<2>(res).data());
+    }
+}
+
+// A relative pose error, w.r.t. all of its transforms
+template <typename Evaluator>
+void BM_PoseError(benchmark::State &state) {
+    const auto T1 = T_AB::Random();
+    const auto T2 = T_BC::Random();
+    const auto T3 = wave::RigidTransformMFd<FrameA, FrameC>::Random();
+
+    for (auto _ : state) {
+        const auto res = Evaluator::run(log(T1 * T2 * inverse(T3)), T1, T2, T3);
+        benchmark::DoNotOptimize(std::get<1>(res).data());
+        benchmark::DoNotOptimize(std::get<3>(res).data());
+    }
+}
+
+// A relative pose error, w.r.t. all of its transforms but the last range(0), which are
+// held constant in one reverse sweep
+void BM_PoseErrorConstant(benchmark::State &state) {
+    const auto T1 = T_AB::Random();
+    const auto T2 = T_BC::Random();
+    const auto T3 = wave::RigidTransformMFd<FrameA, FrameC>::Random();
+    std::bitset<3> constant;
+    for (int i = 0; i < state.range(0); ++i) {
+        constant.set(2 - i);
+    }
+
+    for (auto _ : state) {
+        const auto res = log(T1 * T2 * inverse(T3)).evalWithJacobians(constant);
+        benchmark::DoNotOptimize(std::get<1>(res).data());
+        benchmark::DoNotOptimize(std::get<3>(res).data());
+    }
+}
+
+// The gradients r^T J of a pose error r w.r.t. its transforms, from the full jacobians
+void BM_PoseErrorGradientFull(benchmark::State &state) {
+    const auto T1 = T_AB::Random();
+    const auto T2 = T_BC::Random();
+    const auto T3 = wave::RigidTransformMFd<FrameA, FrameC>::Random();
+
+    for (auto _ : state) {
+        const auto res = log(T1 * T2 * inverse(T3)).evalWithJacobians();
+        const Eigen::Matrix<double, 1, 6> r = std::get<0>(res).value().transpose();
+        const Eigen::Matrix<double, 1, 6> g1 = r * std::get<1>(res);
+        const Eigen::Matrix<double, 1, 6> g3 = r * std::get<3>(res);
+        benchmark::DoNotOptimize(g1.data());
+        benchmark::DoNotOptimize(g3.data());
+    }
+}
+
+// As BM_PoseErrorGradientFull, seeding the reverse sweep with r^T
+void BM_PoseErrorGradientVJP(benchmark::State &state) {
+    const auto T1 = T_AB::Random();
+    const auto T2 = T_BC::Random();
+    const auto T3 = wave::RigidTransformMFd<FrameA, FrameC>::Random();
+    const auto expr = log(T1 * T2 * inverse(T3));
+    const Eigen::Matrix<double, 1, 6> r = expr.eval().value().transpose();
+
+    for (auto _ : state) {
+        const auto res = expr.evalWithVJP(r);
+        benchmark::DoNotOptimize(std::get<1>(res).data());
+        benchmark::DoNotOptimize(std::get<3>(res).data());
+    }
+}
+
+// The directional derivative of a pose error along tangents of its transforms
+void BM_PoseErrorJVP(benchmark::State &state) {
+    const auto T1 = T_AB::Random();
+    const auto T2 = T_BC::Random();
+    const auto T3 = wave::RigidTransformMFd<FrameA, FrameC>::Random();
+    const Eigen::Matrix<double, 6, 1> d1 = Eigen::Matrix<double, 6, 1>::Random();
+    const Eigen::Matrix<double, 6, 1> d2 = Eigen::Matrix<double, 6, 1>::Random();
+    const Eigen::Matrix<double, 6, 1> d3 = Eigen::Matrix<double, 6, 1>::Random();
+
+    for (auto _ : state) {
+        const auto res = log(T1 * T2 * inverse(T3)).evalWithJVP(d1, d2, d3);
+        benchmark::DoNotOptimize(std::get<1>(res).data());
+    }
+}
+
+// A relative pose error, with its jacobians copied into blocks of a row-major matrix
+void BM_PoseErrorCopyToBlocks(benchmark::State &state) {
+    const auto T1 = T_AB::Random();
+    const auto T2 = T_BC::Random();
+    const auto T3 = wave::RigidTransformMFd<FrameA, FrameC>::Random();
+    Eigen::Matrix<double, 6, 18, Eigen::RowMajor> J;
+
+    for (auto _ : state) {
+        const auto res = log(T1 * T2 * inverse(T3)).evalWithJacobians();
+        J.leftCols<6>() = std::get<1>(res);
+        J.middleCols<6>(6) = std::get<2>(res);
+        J.rightCols<6>() = std::get<3>(res);
+        benchmark::DoNotOptimize(std::get<0>(res).value().data());
+        benchmark::DoNotOptimize(J.data());
+    }
+}
+
+// A relative pose error, with its jacobians written straight into the blocks
+void BM_PoseErrorIntoBlocks(benchmark::State &state) {
+    const auto T1 = T_AB::Random();
+    const auto T2 = T_BC::Random();
+    const auto T3 = wave::RigidTransformMFd<FrameA, FrameC>::Random();
+    Eigen::Matrix<double, 6, 18, Eigen::RowMajor> J;
+
+    for (auto _ : state) {
+        const auto res = log(T1 * T2 * inverse(T3))
+                           .evalWithJacobiansInto(
+                             J.leftCols<6>(), J.middleCols<6>(6), J.rightCols<6>());
+        benchmark::DoNotOptimize(res.value().data());
+        benchmark::DoNotOptimize(J.data());
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_PointThroughTransforms, Typed);
+BENCHMARK_TEMPLATE(BM_PointThroughTransforms, Adjoint);
+BENCHMARK_TEMPLATE(BM_PointThroughTransforms, Chain);
+BENCHMARK_TEMPLATE(BM_RotationsAndPoint, Typed);
+BENCHMARK_TEMPLATE(BM_RotationsAndPoint, Adjoint);
+BENCHMARK_TEMPLATE(BM_RotationsAndPoint, Chain);
+BENCHMARK_TEMPLATE(BM_PoseError, Typed);
+BENCHMARK_TEMPLATE(BM_PoseError, Adjoint);
+BENCHMARK_TEMPLATE(BM_PoseError, Chain);
+BENCHMARK(BM_PoseErrorConstant)->DenseRange(0, 3);
+BENCHMARK(BM_PoseErrorGradientFull);
+BENCHMARK(BM_PoseErrorGradientVJP);
+BENCHMARK(BM_PoseErrorJVP);
+BENCHMARK(BM_PoseErrorCopyToBlocks);
+BENCHMARK(BM_PoseErrorIntoBlocks);
+
+WAVE_BENCHMARK_MAIN()
@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+#include "wave/geometry/geometry.hpp"
+#include "bechmark_helpers.hpp"
+
+// Compares transforming the points of a cloud one at a time, as single-point
+// expressions, with transforming the whole cloud at once.
+
+namespace {
+
+using StridedMap = Eigen::Map<Eigen::Matrix3Xd, 0, Eigen::OuterStride<>>;
+
+}  // namespace
+
+void BM_TransformPointsLoop(benchmark::State &state) {
+    const auto N = state.range(0);
+    const wave::PointCloudd cloud{Eigen::Matrix3Xd::Random(3, N)};
+    wave::PointCloudd out{N};
+    const auto T = wave::RigidTransformQd::Random();
+
+    for (auto _ : state) {
+        for (auto i = N; i--;) {
+            out.set(i, wave::Translationd{T * cloud.get(i)});
+        }
+        benchmark::DoNotOptimize(out.value().data());
+    }
+    state.SetItemsProcessed(state.iterations() * N);
+}
+
+void BM_TransformPointCloud(benchmark::State &state) {
+    const auto N = state.range(0);
+    const wave::PointCloudd cloud{Eigen::Matrix3Xd::Random(3, N)};
+    wave::PointCloudd out{N};
+    const auto T = wave::RigidTransformQd::Random();
+
+    for (auto _ : state) {
+        out = T * cloud;
+        benchmark::DoNotOptimize(out.value().data());
+    }
+    state.SetItemsProcessed(state.iterations() * N);
+}
+
+void BM_TransformPointsTo(benchmark::State &state) {
+    const auto N = state.range(0);
+    const wave::PointCloudd cloud{Eigen::Matrix3Xd::Random(3, N)};
+    wave::PointCloudd out{N};
+    const auto T = wave::RigidTransformQd::Random();
+
+    for (auto _ : state) {
+        wave::transformPointsTo(T, cloud, out);
+        benchmark::DoNotOptimize(out.value().data());
+    }
+    state.SetItemsProcessed(state.iterations() * N);
+}
+
+void BM_TransformPointsToStrided(benchmark::State &state) {
+    const auto N = state.range(0);
+    Eigen::Matrix4Xd data = Eigen::Matrix4Xd::Random(4, N);
+    wave::PointCloudMapd cloud{StridedMap{data.data(), 3, N, Eigen::OuterStride<>{4}}};
+    const auto T = wave::RigidTransformQd::Random();
+
+    for (auto _ : state) {
+        wave::transformPointsTo(T, cloud, cloud);
+        benchmark::DoNotOptimize(data.data());
+    }
+    state.SetItemsProcessed(state.iterations() * N);
+}
+
+void BM_TransformPointsToWithJacobians(benchmark::State &state) {
+    const auto N = state.range(0);
+    const wave::PointCloudd cloud{Eigen::Matrix3Xd::Random(3, N)};
+    wave::PointCloudd out{N};
+    wave::AlignedVector<Eigen::Matrix<double, 3, 6>> jacobians(N);
+    const auto T = wave::RigidTransformQd::Random();
+
+    for (auto _ : state) {
+        wave::transformPointsTo(T, cloud, out, jacobians);
+        benchmark::DoNotOptimize(out.value().data());
+        benchmark::DoNotOptimize(jacobians.data());
+    }
+    state.SetItemsProcessed(state.iterations() * N);
+}
+
+BENCHMARK(BM_TransformPointsLoop)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(BM_TransformPointCloud)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(BM_TransformPointsTo)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(BM_TransformPointsToStrided)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(BM_TransformPointsToWithJacobians)->RangeMultiplier(10)->Range(1000, 1000000);
+
+WAVE_BENCHMARK_MAIN()
@@ -0,0 +1,96 @@
+#include <benchmark/benchmark.h>
+#include "wave/geometry/geometry.hpp"
+#include "bechmark_helpers.hpp"
+
+// Compares the quaternion exp and log maps, evaluated directly, with the previous path
+// through rotation matrices, which is still taken when the conversion is written out.
+
+namespace {
+
+using Q = wave::RotationQd;
+using M = wave::RotationMd;
+using R = wave::RelativeRotationd;
+
+struct Direct {
+    template <typename A, typename B>
+    static auto logError(const A &q1, const B &q2)
+      -> decltype(wave::log(q1 * wave::inverse(q2))) {
+        return wave::log(q1 * wave::inverse(q2));
+    }
+
+    template <typename A, typename B>
+    static auto boxPlus(const A &q, const B &w) -> decltype(q + w) {
+        return q + w;
+    }
+};
+
+struct ThroughMatrix {
+    template <typename A, typename B>
+    static auto logError(const A &q1, const B &q2)
+      -> decltype(wave::log(wave::convertTo<M>(q1 * wave::inverse(q2)))) {
+        return wave::log(wave::convertTo<M>(q1 * wave::inverse(q2)));
+    }
+
+    template <typename A, typename B>
+    static auto boxPlus(const A &q, const B &w)
+      -> decltype(wave::exp(w) * wave::convertTo<M>(q)) {
+        return wave::exp(w) * wave::convertTo<M>(q);
+    }
+};
+
+}  // namespace
+
+template <typename Path>
+void BM_LogError(benchmark::State &state) {
+    const auto q1 = Q::Random().eval();
+    const auto q2 = Q::Random().eval();
+
+    for (auto _ : state) {
+        const auto result = Path::logError(q1, q2).eval();
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+template <typename Path>
+void BM_LogErrorJacobians(benchmark::State &state) {
+    const auto q1 = Q::Random().eval();
+    const auto q2 = Q::Random().eval();
+
+    for (auto _ : state) {
+        const auto result = Path::logError(q1, q2).evalWithJacobians(q1, q2);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+template <typename Path>
+void BM_BoxPlus(benchmark::State &state) {
+    const auto q = Q::Random().eval();
+    const auto w = R::Random().eval();
+
+    for (auto _ : state) {
+        const auto result = Path::boxPlus(q, w).eval();
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+template <typename Path>
+void BM_BoxPlusJacobians(benchmark::State &state) {
+    const auto q = Q::Random().eval();
+    const auto w = R::Random().eval();
+
+    for (auto _ : state) {
+        const auto result = Path::boxPlus(q, w).evalWithJacobians(q, w);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_LogError, Direct);
+BENCHMARK_TEMPLATE(BM_LogError, ThroughMatrix);
+BENCHMARK_TEMPLATE(BM_LogErrorJacobians, Direct);
+BENCHMARK_TEMPLATE(BM_LogErrorJacobians, ThroughMatrix);
+BENCHMARK_TEMPLATE(BM_BoxPlus, Direct);
+BENCHMARK_TEMPLATE(BM_BoxPlus, ThroughMatrix);
+BENCHMARK_TEMPLATE(BM_BoxPlusJacobians, Direct);
+BENCHMARK_TEMPLATE(BM_BoxPlusJacobians, ThroughMatrix);
+
+WAVE_BENCHMARK_MAIN()
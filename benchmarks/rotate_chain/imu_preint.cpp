@@ -74,6 +74,24 @@ BENCHMARK_F(Imu, waveReverse)(benchmark::State &state) {
     }
 }
 
+// As waveReverse, but without the jacobian w.r.t. the measurement
+BENCHMARK_F(Imu, waveReverseConstant)(benchmark::State &state) {
+    for (auto _ : state) {
+        for (auto i = N; i--;) {
+            const auto meas = constant(meas_Rij[i]);
+            const auto &expr1 = inverse(meas * exp(wg[i])) * inverse(R_i[i]) * R_j[i];
+            const auto &expr = log(expr1);
+
+            auto[r, J2, J_phi_i, J_phi_j] =
+              wave::internal::evaluateWithReverseJacobians(expr);
+            benchmark::DoNotOptimize(r);
+            benchmark::DoNotOptimize(J2);
+            benchmark::DoNotOptimize(J_phi_i);
+            benchmark::DoNotOptimize(J_phi_j);
+        }
+    }
+}
+
 BENCHMARK_F(Imu, waveUntyped)(benchmark::State &state) {
     for (auto _ : state) {
         for (auto i = N; i--;) {
@@ -92,6 +110,39 @@ BENCHMARK_F(Imu, waveUntyped)(benchmark::State &state) {
     }
 }
 
+BENCHMARK_F(Imu, waveAdjoint)(benchmark::State &state) {
+    for (auto _ : state) {
+        for (auto i = N; i--;) {
+            const auto &expr1 =
+              inverse(meas_Rij[i] * exp(wg[i])) * inverse(R_i[i]) * R_j[i];
+            const auto &expr = log(expr1);
+
+            auto[r, J1, J2, J_phi_i, J_phi_j] =
+              wave::internal::evaluateWithAdjointJacobians(
+                expr, meas_Rij[i], wg[i], R_i[i], R_j[i]);
+            benchmark::DoNotOptimize(r);
+            benchmark::DoNotOptimize(J1);
+            benchmark::DoNotOptimize(J2);
+            benchmark::DoNotOptimize(J_phi_i);
+            benchmark::DoNotOptimize(J_phi_j);
+        }
+    }
+}
+
+BENCHMARK_F(Imu, waveBatch)(benchmark::State &state) {
+    const auto residual = [](const auto &meas_Rij, const auto &wg, const auto &R_i,
+                             const auto &R_j) {
+        return log(inverse(meas_Rij * exp(wg)) * inverse(R_i) * R_j);
+    };
+    using Expr = decltype(residual(meas_Rij[0], wg[0], R_i[0], R_j[0]));
+    wave::internal::batch_with_reverse_jacobians_t<Expr> outputs;
+
+    for (auto _ : state) {
+        evalBatchWithJacobiansTo(outputs, residual, meas_Rij, wg, R_i, R_j);
+        benchmark::DoNotOptimize(outputs);
+    }
+}
+
 Eigen::Matrix3d expMap(const Eigen::Vector3d &phi) {
     return evalImpl(wave::internal::expr<ExpMap>{}, wave::RelativeRotationd{phi}).value();
 }
@@ -0,0 +1,61 @@
+#include <thread>
+#include <benchmark/benchmark.h>
+
+#include "wave/geometry/geometry.hpp"
+#include "../bechmark_helpers.hpp"
+
+// Scaling of the parallel batch driver on the IMU preintegration residual of
+// imu_preint.cpp, from one thread to one per hardware thread.
+
+using namespace wave;
+
+struct FrameW;
+struct FrameI;
+struct FrameJ;
+
+template <class I, class J>
+using RMFd = wave::RotationMFd<I, J>;
+
+class ImuParallel : public benchmark::Fixture {
+ protected:
+    // Large enough for many grains per thread
+    const int N = 100000;
+    const AlignedVector<RMFd<FrameI, FrameJ>> meas_Rij =
+      randomMatrices<RMFd<FrameI, FrameJ>>(N);
+    const AlignedVector<RMFd<FrameW, FrameI>> R_i =
+      randomMatrices<RMFd<FrameW, FrameI>>(N);
+    const AlignedVector<RMFd<FrameW, FrameJ>> R_j =
+      randomMatrices<RMFd<FrameW, FrameJ>>(N);
+    const AlignedVector<RelativeRotationFd<FrameJ, FrameJ, FrameJ>> wg =
+      randomMatrices<RelativeRotationFd<FrameJ, FrameJ, FrameJ>>(N);
+};
+
+BENCHMARK_DEFINE_F(ImuParallel, waveBatch)(benchmark::State &state) {
+    const auto residual = [](const auto &meas_Rij, const auto &wg, const auto &R_i,
+                             const auto &R_j) {
+        return log(inverse(meas_Rij * exp(wg)) * inverse(R_i) * R_j);
+    };
+    using Expr = decltype(residual(meas_Rij[0], wg[0], R_i[0], R_j[0]));
+    wave::internal::batch_with_reverse_jacobians_t<Expr> outputs;
+    ThreadPool pool{static_cast<unsigned int>(state.range(0))};
+
+    for (auto _ : state) {
+        parallelEvalBatchWithJacobiansTo(pool, outputs, residual, meas_Rij, wg, R_i, R_j);
+        benchmark::DoNotOptimize(outputs);
+    }
+    state.SetItemsProcessed(state.iterations() * N);
+}
+
+/** Runs with 1, 2, 4, ... threads, up to and including the number of hardware threads */
+void threadCounts(benchmark::internal::Benchmark *b) {
+    const int max_threads = std::max(1u, std::thread::hardware_concurrency());
+    for (int t = 1; t < max_threads; t *= 2) {
+        b->Arg(t);
+    }
+    b->Arg(max_threads);
+}
+
+// Real time, since the other threads' CPU time is not counted
+BENCHMARK_REGISTER_F(ImuParallel, waveBatch)->Apply(threadCounts)->UseRealTime();
+
+WAVE_BENCHMARK_MAIN()
@@ -0,0 +1,142 @@
+#include <benchmark/benchmark.h>
+
+#include "wave/geometry/geometry.hpp"
+#include "wave/geometry/debug.hpp"
+#include "../bechmark_helpers.hpp"
+
+// Compares evaluating v0 = R1*R2*...*RN*v one element at a time (as in
+// rotate_chain_wave_bench.cpp, but without Jacobians) with evaluating the same chain over
+// structure-of-arrays batches.
+//
+// Each intermediate of a batch chain is a fresh heap allocation. With glibc's default
+// trim threshold that memory is returned to the OS and page-faulted in again on every
+// iteration, which dominates the longer chains; run with e.g.
+// MALLOC_TRIM_THRESHOLD_=100000000 to see the arithmetic cost alone.
+
+template <int I>
+struct FrameN;
+
+template <int I, int J>
+using RMFd = wave::RotationMFd<FrameN<I>, FrameN<J>>;
+
+template <int I, int J>
+using RQFd = wave::RotationQFd<FrameN<I>, FrameN<J>>;
+
+template <int I, int J, int K>
+using TFd = wave::TranslationFd<FrameN<I>, FrameN<J>, FrameN<K>>;
+
+template <int I, int J>
+using RMBatchFd = wave::RotationMBatchFd<FrameN<I>, FrameN<J>>;
+
+template <int I, int J>
+using RQBatchFd = wave::RotationQBatchFd<FrameN<I>, FrameN<J>>;
+
+template <int I, int J, int K>
+using TBatchFd = wave::TranslationBatchFd<FrameN<I>, FrameN<J>, FrameN<K>>;
+
+template <typename T>
+using EigenVector = std::vector<T, Eigen::aligned_allocator<T>>;
+
+/** Copies a vector of elements into a batch */
+template <typename Batch, typename T>
+Batch toBatch(const EigenVector<T> &v) {
+    Batch batch{static_cast<Eigen::Index>(v.size())};
+    for (auto i = v.size(); i--;) {
+        batch.set(i, v[i]);
+    }
+    return batch;
+}
+
+class RotateChainBatch : public benchmark::Fixture {
+ protected:
+    const int N = 1000;
+    const EigenVector<RMFd<0, 1>> R1 = randomMatrices<RMFd<0, 1>>(N);
+    const EigenVector<RMFd<1, 2>> R2 = randomMatrices<RMFd<1, 2>>(N);
+    const EigenVector<RMFd<2, 3>> R3 = randomMatrices<RMFd<2, 3>>(N);
+    const EigenVector<RMFd<3, 4>> R4 = randomMatrices<RMFd<3, 4>>(N);
+    const EigenVector<RMFd<4, 5>> R5 = randomMatrices<RMFd<4, 5>>(N);
+    const EigenVector<RQFd<0, 1>> Q1 = randomMatrices<RQFd<0, 1>>(N);
+    const EigenVector<RQFd<1, 2>> Q2 = randomMatrices<RQFd<1, 2>>(N);
+    const EigenVector<RQFd<2, 3>> Q3 = randomMatrices<RQFd<2, 3>>(N);
+    const EigenVector<RQFd<3, 4>> Q4 = randomMatrices<RQFd<3, 4>>(N);
+    const EigenVector<RQFd<4, 5>> Q5 = randomMatrices<RQFd<4, 5>>(N);
+    const EigenVector<TFd<5, 0, 1>> v5 = randomMatrices<TFd<5, 0, 1>>(N);
+
+    const RMBatchFd<0, 1> R1b = toBatch<RMBatchFd<0, 1>>(R1);
+    const RMBatchFd<1, 2> R2b = toBatch<RMBatchFd<1, 2>>(R2);
+    const RMBatchFd<2, 3> R3b = toBatch<RMBatchFd<2, 3>>(R3);
+    const RMBatchFd<3, 4> R4b = toBatch<RMBatchFd<3, 4>>(R4);
+    const RMBatchFd<4, 5> R5b = toBatch<RMBatchFd<4, 5>>(R5);
+    const RQBatchFd<0, 1> Q1b = toBatch<RQBatchFd<0, 1>>(Q1);
+    const RQBatchFd<1, 2> Q2b = toBatch<RQBatchFd<1, 2>>(Q2);
+    const RQBatchFd<2, 3> Q3b = toBatch<RQBatchFd<2, 3>>(Q3);
+    const RQBatchFd<3, 4> Q4b = toBatch<RQBatchFd<3, 4>>(Q4);
+    const RQBatchFd<4, 5> Q5b = toBatch<RQBatchFd<4, 5>>(Q5);
+    const TBatchFd<5, 0, 1> v5b = toBatch<TBatchFd<5, 0, 1>>(v5);
+};
+
+BENCHMARK_F(RotateChainBatch, matrixLoop1)(benchmark::State &state) {
+    for (auto _ : state) {
+        for (auto i = N; i-- > 0;) {
+            TFd<4, 0, 1> v0 = R5[i] * v5[i];
+            benchmark::DoNotOptimize(v0);
+        }
+    }
+}
+
+BENCHMARK_F(RotateChainBatch, matrixBatch1)(benchmark::State &state) {
+    for (auto _ : state) {
+        TBatchFd<4, 0, 1> v0 = R5b * v5b;
+        benchmark::DoNotOptimize(v0);
+    }
+}
+
+BENCHMARK_F(RotateChainBatch, matrixLoop5)(benchmark::State &state) {
+    for (auto _ : state) {
+        for (auto i = N; i-- > 0;) {
+            TFd<0, 0, 1> v0 = R1[i] * R2[i] * R3[i] * R4[i] * R5[i] * v5[i];
+            benchmark::DoNotOptimize(v0);
+        }
+    }
+}
+
+BENCHMARK_F(RotateChainBatch, matrixBatch5)(benchmark::State &state) {
+    for (auto _ : state) {
+        TBatchFd<0, 0, 1> v0 = R1b * R2b * R3b * R4b * R5b * v5b;
+        benchmark::DoNotOptimize(v0);
+    }
+}
+
+BENCHMARK_F(RotateChainBatch, quaternionLoop1)(benchmark::State &state) {
+    for (auto _ : state) {
+        for (auto i = N; i-- > 0;) {
+            TFd<4, 0, 1> v0 = Q5[i] * v5[i];
+            benchmark::DoNotOptimize(v0);
+        }
+    }
+}
+
+BENCHMARK_F(RotateChainBatch, quaternionBatch1)(benchmark::State &state) {
+    for (auto _ : state) {
+        TBatchFd<4, 0, 1> v0 = Q5b * v5b;
+        benchmark::DoNotOptimize(v0);
+    }
+}
+
+BENCHMARK_F(RotateChainBatch, quaternionLoop5)(benchmark::State &state) {
+    for (auto _ : state) {
+        for (auto i = N; i-- > 0;) {
+            TFd<0, 0, 1> v0 = Q1[i] * Q2[i] * Q3[i] * Q4[i] * Q5[i] * v5[i];
+            benchmark::DoNotOptimize(v0);
+        }
+    }
+}
+
+BENCHMARK_F(RotateChainBatch, quaternionBatch5)(benchmark::State &state) {
+    for (auto _ : state) {
+        TBatchFd<0, 0, 1> v0 = Q1b * Q2b * Q3b * Q4b * Q5b * v5b;
+        benchmark::DoNotOptimize(v0);
+    }
+}
+
+WAVE_BENCHMARK_MAIN()
@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+
+#include "wave/geometry/geometry.hpp"
+#include "wave/geometry/debug.hpp"
+#include "../bechmark_helpers.hpp"
+
+// Reverse-mode jacobians of chains of quaternions and compact rigid transforms, with
+// inverses, as in relative pose errors. The rotation matrix of each quaternion node is
+// used by its own jacobian and by its parent's, and each of them converts it again.
+
+template <int I>
+struct FrameN;
+
+template <int I, int J>
+using RQFd = wave::RotationQFd<FrameN<I>, FrameN<J>>;
+
+template <int I, int J>
+using TQFd = wave::RigidTransformQFd<FrameN<I>, FrameN<J>>;
+
+template <int I, int J, int K>
+using TFd = wave::TranslationFd<FrameN<I>, FrameN<J>, FrameN<K>>;
+
+template <typename T>
+using EigenVector = std::vector<T, Eigen::aligned_allocator<T>>;
+
+class RotateChainQuat : public benchmark::Fixture {
+ protected:
+    const int N = 1000;
+    const EigenVector<RQFd<1, 0>> R1 = randomMatrices<RQFd<1, 0>>(N);
+    const EigenVector<RQFd<1, 2>> R2 = randomMatrices<RQFd<1, 2>>(N);
+    const EigenVector<RQFd<3, 2>> R3 = randomMatrices<RQFd<3, 2>>(N);
+    const EigenVector<RQFd<3, 4>> R4 = randomMatrices<RQFd<3, 4>>(N);
+    const EigenVector<TFd<2, 5, 6>> v2 = randomMatrices<TFd<2, 5, 6>>(N);
+    const EigenVector<TFd<4, 5, 6>> v4 = randomMatrices<TFd<4, 5, 6>>(N);
+    const EigenVector<TQFd<1, 0>> T1 = randomMatrices<TQFd<1, 0>>(N);
+    const EigenVector<TQFd<1, 2>> T2 = randomMatrices<TQFd<1, 2>>(N);
+    const EigenVector<TFd<2, 5, 6>> p2 = randomMatrices<TFd<2, 5, 6>>(N);
+};
+
+BENCHMARK_F(RotateChainQuat, quat2)(benchmark::State &state) {
+    for (auto _ : state) {
+        for (auto i = N; i-- > 0;) {
+            auto[v0, J1, J2, Jv] = (inverse(R1[i]) * R2[i] * v2[i]).evalWithJacobians();
+
+            benchmark::DoNotOptimize(J1);
+            benchmark::DoNotOptimize(J2);
+            benchmark::DoNotOptimize(Jv);
+            benchmark::DoNotOptimize(v0);
+        }
+    }
+}
+
+BENCHMARK_F(RotateChainQuat, quat4)(benchmark::State &state) {
+    for (auto _ : state) {
+        for (auto i = N; i-- > 0;) {
+            auto[v0, J1, J2, J3, J4, Jv] =
+              (inverse(R1[i]) * R2[i] * inverse(R3[i]) * R4[i] * v4[i])
+                .evalWithJacobians();
+
+            benchmark::DoNotOptimize(J1);
+            benchmark::DoNotOptimize(J2);
+            benchmark::DoNotOptimize(J3);
+            benchmark::DoNotOptimize(J4);
+            benchmark::DoNotOptimize(Jv);
+            benchmark::DoNotOptimize(v0);
+        }
+    }
+}
+
+BENCHMARK_F(RotateChainQuat, transform2)(benchmark::State &state) {
+    for (auto _ : state) {
+        for (auto i = N; i-- > 0;) {
+            auto[p0, J1, J2, Jp] = (inverse(T1[i]) * T2[i] * p2[i]).evalWithJacobians();
+
+            benchmark::DoNotOptimize(J1);
+            benchmark::DoNotOptimize(J2);
+            benchmark::DoNotOptimize(Jp);
+            benchmark::DoNotOptimize(p0);
+        }
+    }
+}
+
+WAVE_BENCHMARK_MAIN()
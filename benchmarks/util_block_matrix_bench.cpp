@@ -0,0 +1,129 @@
+#include <benchmark/benchmark.h>
+#include "wave/geometry/src/util/math/BlockMatrix.hpp"
+#include "wave/geometry/src/util/math/AdjointMatrix.hpp"
+#include "bechmark_helpers.hpp"
+
+namespace {
+
+using Mat3 = Eigen::Matrix3d;
+using Mat6 = Eigen::Matrix<double, 6, 6>;
+using Lower = wave::BlockLowerTriangular<double, 3>;
+using Adjoint = wave::AdjointMatrix<double>;
+
+std::vector<Lower, Eigen::aligned_allocator<Lower>> randomLower(int N) {
+    std::vector<Lower, Eigen::aligned_allocator<Lower>> v(N);
+    for (auto i = N; i--;) {
+        v[i] = Lower{Mat3::Random(), Mat3::Random(), Mat3::Random()};
+    }
+    return v;
+}
+
+std::vector<Adjoint, Eigen::aligned_allocator<Adjoint>> randomAdjoints(int N) {
+    std::vector<Adjoint, Eigen::aligned_allocator<Adjoint>> v;
+    v.reserve(N);
+    for (auto i = N; i--;) {
+        v.emplace_back(Mat3{Eigen::Quaterniond::UnitRandom()}, Eigen::Vector3d::Random());
+    }
+    return v;
+}
+
+}  // namespace
+
+// Products of SE(3) adjoints, as dense matrices and block by block
+void BM_Dense_LowerProduct(benchmark::State &state) {
+    const auto N = state.range(0);
+    const auto a = randomLower(N);
+    const auto b = randomLower(N);
+
+    for (auto _ : state) {
+        for (auto i = N; i--;) {
+            const Mat6 result = static_cast<const Mat6 &>(a[i]) * b[i].eval();
+
+            benchmark::DoNotOptimize(result.data());
+        }
+    }
+}
+
+void BM_wave_LowerProduct(benchmark::State &state) {
+    const auto N = state.range(0);
+    const auto a = randomLower(N);
+    const auto b = randomLower(N);
+
+    for (auto _ : state) {
+        for (auto i = N; i--;) {
+            const Lower result = a[i] * b[i];
+
+            benchmark::DoNotOptimize(result.data());
+            DEBUG_ASSERT_APPROX(result,
+                                Mat6{static_cast<const Mat6 &>(a[i]) * b[i].eval()});
+        }
+    }
+}
+
+// A point's jacobian times an SE(3) adjoint
+void BM_Dense_PointTimesLower(benchmark::State &state) {
+    const auto N = state.range(0);
+    const auto a = randomMatrices<Eigen::Matrix<double, 3, 6>>(N);
+    const auto b = randomLower(N);
+
+    for (auto _ : state) {
+        for (auto i = N; i--;) {
+            const Eigen::Matrix<double, 3, 6> result = a[i] * b[i].eval();
+
+            benchmark::DoNotOptimize(result.data());
+        }
+    }
+}
+
+void BM_wave_PointTimesLower(benchmark::State &state) {
+    const auto N = state.range(0);
+    const auto a = randomMatrices<Eigen::Matrix<double, 3, 6>>(N);
+    const auto b = randomLower(N);
+
+    for (auto _ : state) {
+        for (auto i = N; i--;) {
+            const Eigen::Matrix<double, 3, 6> result = a[i] * b[i];
+
+            benchmark::DoNotOptimize(result.data());
+        }
+    }
+}
+
+// Products of SE(3) adjoints kept as their rotation and translation
+void BM_wave_AdjointProduct(benchmark::State &state) {
+    const auto N = state.range(0);
+    const auto a = randomAdjoints(N);
+    const auto b = randomAdjoints(N);
+
+    for (auto _ : state) {
+        for (auto i = N; i--;) {
+            const Adjoint result = a[i] * b[i];
+
+            benchmark::DoNotOptimize(result.rotation().data());
+            DEBUG_ASSERT_APPROX(Mat6{result}, Mat6{Mat6{a[i]} * Mat6{b[i]}});
+        }
+    }
+}
+
+void BM_wave_PointTimesAdjoint(benchmark::State &state) {
+    const auto N = state.range(0);
+    const auto a = randomMatrices<Eigen::Matrix<double, 3, 6>>(N);
+    const auto b = randomAdjoints(N);
+
+    for (auto _ : state) {
+        for (auto i = N; i--;) {
+            const Eigen::Matrix<double, 3, 6> result = a[i] * b[i];
+
+            benchmark::DoNotOptimize(result.data());
+        }
+    }
+}
+
+BENCHMARK(BM_Dense_LowerProduct)->Arg(1000);
+BENCHMARK(BM_wave_LowerProduct)->Arg(1000);
+BENCHMARK(BM_Dense_PointTimesLower)->Arg(1000);
+BENCHMARK(BM_wave_PointTimesLower)->Arg(1000);
+BENCHMARK(BM_wave_AdjointProduct)->Arg(1000);
+BENCHMARK(BM_wave_PointTimesAdjoint)->Arg(1000);
+
+WAVE_BENCHMARK_MAIN()
@@ -201,6 +201,36 @@ void BM_EvalCross(benchmark::State &state) {
     }
 }
 
+// The second-order term of the exp map, as in I + A * cross + B * cross * cross
+template <typename Functor>
+void BM_ScaledCrossSquared(benchmark::State &state) {
+    const auto N = state.range(0);
+    auto a = randomMatrices<Eigen::Vector3d>(N);
+    auto b = randomMatrices<Eigen::Matrix<double, 1, 1>>(N);
+
+    for (auto _ : state) {
+        for (auto i = N; i--;) {
+            Eigen::Matrix3d result = b[i](0) * Functor::call(a[i]) * Functor::call(a[i]);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+}
+
+template <typename Functor>
+void BM_ScaledCrossTimesVector(benchmark::State &state) {
+    const auto N = state.range(0);
+    auto a = randomMatrices<Eigen::Vector3d>(N);
+    auto b = randomMatrices<Eigen::Vector3d>(N);
+    auto c = randomMatrices<Eigen::Matrix<double, 1, 1>>(N);
+
+    for (auto _ : state) {
+        for (auto i = N; i--;) {
+            Eigen::Vector3d result = (c[i](0) * Functor::call(a[i])) * b[i];
+            benchmark::DoNotOptimize(result);
+        }
+    }
+}
+
 // BENCHMARK(BM_ManualCrossMatrix);
 // BENCHMARK(BM_ExprCrossMatrix);
 // BENCHMARK(BM_ExprEvalCross)->Range(1, 1 << 10)->Complexity(benchmark::oN);
@@ -238,5 +268,10 @@ BENCHMARK_TEMPLATE(BM_CrossTimesCross, WaveCross)->Arg(reps);
 BENCHMARK_TEMPLATE(BM_CrossTimesCross, ManualCross)->Arg(reps);
 BENCHMARK_TEMPLATE(BM_CrossTimesCross, WaveCross)->Arg(reps);
 
+BENCHMARK_TEMPLATE(BM_ScaledCrossSquared, ManualCross)->Arg(reps);
+BENCHMARK_TEMPLATE(BM_ScaledCrossSquared, WaveCross)->Arg(reps);
+
+BENCHMARK_TEMPLATE(BM_ScaledCrossTimesVector, ManualCross)->Arg(reps);
+BENCHMARK_TEMPLATE(BM_ScaledCrossTimesVector, WaveCross)->Arg(reps);
 
-BENCHMARK_MAIN()
+WAVE_BENCHMARK_MAIN()
@@ -15,7 +15,13 @@
 #include "src/util/meta/index_sequence.hpp"
 #include "src/util/meta/type_list.hpp"
 #include "src/util/math/math.hpp"
+#include "src/util/math/BatchMath.hpp"
+#include "src/util/math/Lanes.hpp"
 #include "src/util/math/IdentityMatrix.hpp"
+#include "src/util/math/ZeroMatrix.hpp"
+#include "src/util/math/BlockMatrix.hpp"
+#include "src/util/math/AdjointMatrix.hpp"
+#include "src/util/parallel/ThreadPool.hpp"
 
 // Forward declarations and standalone type traits
 #include "src/core/forward_declarations.hpp"
@@ -27,20 +33,29 @@
 #include "src/core/functions/IsSameType.hpp"
 #include "src/core/functions/AddConversions.hpp"
 #include "src/core/functions/PrepareExpr.hpp"
+#include "src/core/functions/RewriteExpr.hpp"
 #include "src/core/functions/Evaluator.hpp"
 #include "src/core/functions/PrepareOutput.hpp"
 #include "src/core/functions/JacobianEvaluator.hpp"
+#include "src/core/functions/AdjointJacobianEvaluator.hpp"
 #include "src/core/functions/TypedJacobianEvaluator.hpp"
+#include "src/core/functions/JacobianChain.hpp"
+#include "src/core/functions/JacobianCost.hpp"
 #include "src/core/functions/ReverseJacobianEvaluator.hpp"
+#include "src/core/functions/JacobianProducts.hpp"
+#include "src/core/functions/BatchJacobianEvaluator.hpp"
 
 // Storage and traits bases
 #include "src/core/storage/UnaryExpression.hpp"
 #include "src/core/storage/BinaryExpression.hpp"
 #include "src/core/storage/LeafExpression.hpp"
+#include "src/core/storage/StridedView.hpp"
 #include "src/core/traits/traits_bases.hpp"
 
 // Expressions
 #include "src/core/op/Convert.hpp"
+#include "src/core/op/Shared.hpp"
+#include "src/core/op/Constant.hpp"
 
 // Generic expressions
 #include "src/core/base/ExpressionBase.hpp"
@@ -27,6 +27,7 @@
 #include "src/geometry/base/RotationBase.hpp"
 #include "src/geometry/leaf/MatrixRotation.hpp"
 #include "src/geometry/leaf/QuaternionRotation.hpp"
+#include "src/geometry/leaf/OrderedQuaternionRotation.hpp"
 #include "src/geometry/leaf/AngleAxisRotation.hpp"
 #include "src/geometry/base/RelativeRotationBase.hpp"
 #include "src/geometry/leaf/RelativeRotation.hpp"
@@ -36,13 +37,25 @@
 #include "src/geometry/leaf/Identity.hpp"
 #include "src/geometry/leaf/MatrixRigidTransform.hpp"
 #include "src/geometry/leaf/CompactRigidTransform.hpp"
+#include "src/geometry/leaf/LayoutRigidTransform.hpp"
 #include "src/geometry/base/RigidTransformBase.hpp"
 #include "src/geometry/base/TwistBase.hpp"
 #include "src/geometry/leaf/Twist.hpp"
+
+// Batches
+#include "src/geometry/base/BatchBase.hpp"
+#include "src/geometry/leaf/TranslationBatch.hpp"
+#include "src/geometry/leaf/MatrixRotationBatch.hpp"
+#include "src/geometry/leaf/QuaternionRotationBatch.hpp"
+#include "src/geometry/leaf/CompactRigidTransformBatch.hpp"
+#include "src/geometry/leaf/RelativeRotationBatch.hpp"
+#include "src/geometry/leaf/PointCloud.hpp"
+
 #include "src/geometry/op/Sum.hpp"
 #include "src/geometry/op/Rotate.hpp"
 #include "src/geometry/op/Transform.hpp"
 #include "src/geometry/op/Compose.hpp"
+#include "src/geometry/op/AdjointAction.hpp"
 #include "src/geometry/op/ExpMap.hpp"
 #include "src/geometry/op/LogMap.hpp"
 #include "src/geometry/op/BoxPlus.hpp"
@@ -57,12 +57,102 @@ class ExpressionBase {
     auto evalWithJacobians() const -> internal::eval_with_reverse_jacobians_t<Derived> {
         static_assert(internal::unique_leaves_t<Derived>{},
                       "Calling evalWithJacobians() without arguments is only possible "
-                      "for expression trees with unique types");
+                      "for expression trees with unique types. Otherwise, pass the "
+                      "leaves to differentiate with respect to.");
         return internal::evaluateWithReverseJacobians(this->derived());
     }
 
+    /** Evaluate the value and jacobians w.r.t. all leaves, in reverse mode, holding some
+     * leaves constant.
+     *
+     * Bit i of `constant` is set to hold the i-th leaf constant, in the order of the
+     * returned jacobians. Those jacobians are zero, and no work is done to find them.
+     * This requires that the expression is a tree with unique types.
+     */
+    template <std::size_t N>
+    auto evalWithJacobians(const std::bitset<N> &constant) const
+      -> internal::eval_with_reverse_jacobians_t<Derived> {
+        static_assert(internal::unique_leaves_t<Derived>{},
+                      "Holding leaves constant is only possible for expression trees "
+                      "with unique types.");
+        return internal::evaluateWithReverseJacobians(this->derived(), constant);
+    }
+
+    /** Evaluate the value and write the jacobians w.r.t. all leaves to the given
+     * destinations, in reverse mode.
+     *
+     * A destination is any writable matrix expression of the jacobian's size, such as a
+     * block of a larger jacobian, an Eigen::Ref, or an Eigen::Map with any stride or
+     * storage order. Pass one per leaf, in the order of the jacobians returned by
+     * evalWithJacobians(). No intermediate jacobians are formed.
+     */
+    template <typename... JacobianOut,
+              TICK_REQUIRES(internal::are_jacobian_destinations<JacobianOut...>{})>
+    OutputType evalWithJacobiansInto(JacobianOut &&... jacobians) const {
+        static_assert(internal::unique_leaves_t<Derived>{},
+                      "Writing jacobians into destinations is only possible for "
+                      "expression trees with unique types.");
+        return internal::evaluateWithReverseJacobiansInto(
+          this->derived(), std::forward<JacobianOut>(jacobians)...);
+    }
+
+    /** Evaluate the value and write the jacobians w.r.t. all leaves to raw arrays, in
+     * reverse mode.
+     *
+     * Each jacobian is written as a dense, row-major array, as in a Ceres cost function.
+     * A jacobian whose pointer is null is not found, as if its leaf were held constant.
+     */
+    template <typename Scalar,
+              TICK_REQUIRES(std::is_same<Scalar, internal::scalar_t<Derived>>{})>
+    OutputType evalWithJacobiansInto(Scalar *const *jacobians) const {
+        static_assert(internal::unique_leaves_t<Derived>{},
+                      "Writing jacobians into destinations is only possible for "
+                      "expression trees with unique types.");
+        return internal::evaluateWithReverseJacobiansInto(this->derived(), jacobians);
+    }
+
+    /** Evaluate the value and the products of an adjoint with the jacobians w.r.t. all
+     * leaves, in reverse mode, without forming the jacobians.
+     *
+     * @param adjoint a (K x M) matrix, such as the transpose of a residual, where M is
+     * the tangent size of the expression
+     * @return the value, then a (K x N) product for each leaf, in the order of the
+     * jacobians from evalWithJacobians()
+     */
+    template <typename AdjointDerived>
+    auto evalWithVJP(const Eigen::MatrixBase<AdjointDerived> &adjoint) const
+      -> internal::eval_with_vjp_t<Derived, typename AdjointDerived::PlainObject> {
+        static_assert(internal::unique_leaves_t<Derived>{},
+                      "evalWithVJP() is only possible for expression trees with unique "
+                      "types.");
+        return internal::evaluateWithVectorJacobianProducts(this->derived(), adjoint);
+    }
 
-    /** Evaluate the value and jacobians w.r.t. some targets */
+    /** Evaluate the value and the sum of the products of the jacobian w.r.t. each leaf
+     * with a tangent of that leaf, in forward mode, without forming the jacobians.
+     *
+     * @param tangents an (N x K) matrix for each leaf, in the order of the jacobians from
+     * evalWithJacobians()
+     * @return the value, then the (M x K) product
+     */
+    template <typename... TangentDerived>
+    auto evalWithJVP(const Eigen::MatrixBase<TangentDerived> &... tangents) const
+      -> std::tuple<OutputType,
+                    internal::forward_tangent_t<
+                      Derived,
+                      internal::tangent_cols<std::tuple<TangentDerived...>>::value>> {
+        static_assert(internal::unique_leaves_t<Derived>{},
+                      "evalWithJVP() is only possible for expression trees with unique "
+                      "types.");
+        return internal::evaluateWithJacobianVectorProduct(this->derived(),
+                                                           tangents.derived()...);
+    }
+
+    /** Evaluate the value and jacobians w.r.t. some targets.
+     * A target may appear more than once in the expression, or share its type with
+     * other leaves. Forward or reverse mode is used, whichever is estimated to be
+     * cheaper for this expression and these targets.
+     */
     template <typename... Targets>
     auto evalWithJacobians(const ExpressionBase<Targets> &... wrt) const
       -> std::tuple<OutputType, internal::jacobian_t<Derived, Targets>...> {
@@ -51,6 +51,12 @@ class ExpressionBase;
 template <typename ToDerived, typename FromDerived>
 struct Convert;
 
+template <typename Derived>
+class Shared;
+
+template <typename Leaf>
+class Constant;
+
 }  // namespace wave
 
 #endif  // WAVE_GEOMETRY_FORWARD_DECLARATIONS_HPP
@@ -8,16 +8,81 @@
 namespace wave {
 namespace internal {
 
-/** Choose the first directly evaluable leaf type, using either the given candidate or the
+/** Estimated cost, in flops, of `evalImpl(Tag{}, Args...)` for the given leaf types
+ *
+ * This is the cost table used to choose between conversions. Leaves specialize it for
+ * their operations and conversions, e.g. `eval_cost<expr<Convert, To>, From>`, counting
+ * a transcendental function or square root as 20 flops. Anything not listed is assumed
+ * to cost 100.
+ */
+template <typename Tag, typename... Args>
+struct eval_cost : std::integral_constant<int, 100> {};
+
+/** Of the candidates in a type list with a true `value`, derives from the one with the
+ * lowest `cost`. Of equal costs, the first is chosen. Derives from false_type if no
+ * candidate has a true `value`.
+ */
+template <typename List, typename Best = std::false_type>
+struct cheapest_candidate : Best {};
+
+template <typename Candidate, typename... Rest, typename Best>
+struct cheapest_candidate<tmp::type_list<Candidate, Rest...>, Best>
+  : cheapest_candidate<
+      tmp::type_list<Rest...>,
+      tmp::conditional_t<(Candidate::value && Candidate::cost < Best::cost),
+                         Candidate,
+                         Best>> {};
+
+// Until a valid candidate is found, there is no cost to compare
+template <typename Candidate, typename... Rest>
+struct cheapest_candidate<tmp::type_list<Candidate, Rest...>, std::false_type>
+  : cheapest_candidate<tmp::type_list<Rest...>,
+                       tmp::conditional_t<Candidate::value, Candidate, std::false_type>> {
+};
+
+/** The expression converting an operand to the leaf type To, and its estimated cost
+ *
+ * By default this is Convert<To, Operand>, applied to the operand's output. An operation
+ * which can give To directly, for less than computing its usual output and converting
+ * it, specializes this to replace the conversion: see ExpMapTo.
+ *
+ * @tparam Operand a prepared expression
+ */
+template <typename To, typename Operand, typename Enable = void>
+struct operand_conversion
+  : is_directly_evaluable_unary<expr<Convert, To>, eval_t<Operand>> {
+    using type = Convert<To, Operand>;
+    static constexpr int cost = eval_cost<expr<Convert, To>, eval_t<Operand>>::value;
+};
+
+/** The leaf types an operand may be converted to: those in the ConvertTo list of its
+ * output type, and any extra types the operation itself can give
+ *
+ * @tparam Operand a prepared expression
+ */
+template <typename Operand, typename Enable = void>
+struct operand_convert_to {
+    using type = typename traits<clean_eval_t<Operand>>::ConvertTo;
+};
+
+template <typename Operand>
+using operand_convert_to_t = typename operand_convert_to<Operand>::type;
+
+/** Choose the directly evaluable leaf type, using either the given candidate or the
  * core leaf types for its operand.
- * For a `Derived` expression of the form `Unary<Rhs>`, the order checked is:
+ * For a `Derived` expression of the form `Unary<Rhs>`, the options checked are:
  *
  * 1. `Unary<RhsFolded>` (no conversion)
- * 2. For each type T in the type list `Derived::ConvertTo`:
+ * 2. For each type T in the type list `operand_convert_to_t<Rhs>`:
+ *      `Unary<operand_conversion<T, RhsFolded>::type>`, usually
  *      `Unary<Convert<T, RhsFolded>>`
  *
- * Currently, the fist acceptable conversion is used; in future, the lowest-cost
- * conversion might be used.
+ * An expression evaluable without conversion is never converted. Otherwise, the
+ * conversion with the lowest total eval_cost of the conversion and operation is used,
+ * or the first in the list if costs are equal.
+ *
+ * To use another conversion for one expression, convert its operand explicitly with
+ * convertTo().
  */
 template <typename Derived,
           typename Tag,
@@ -49,9 +114,11 @@ struct first_directly_evaluable_conversion_unary<Derived,
 
     template <typename ToRhs>
     struct is_evaluable_after_conversion_test
-      : tmp::conjunction<is_directly_evaluable_unary<expr<Convert, ToRhs>, eval_t<Rhs>>,
+      : tmp::conjunction<operand_conversion<ToRhs, Rhs>,
                          is_directly_evaluable_unary<Tag, ToRhs>> {
-        using type = Rebind<Convert<ToRhs, Rhs>>;
+        using type = Rebind<typename operand_conversion<ToRhs, Rhs>::type>;
+        static constexpr int cost =
+          operand_conversion<ToRhs, Rhs>::cost + eval_cost<Tag, ToRhs>::value;
     };
 
     template <typename T>
@@ -61,17 +128,19 @@ struct first_directly_evaluable_conversion_unary<Derived,
                       "Could not find conversions to an applicable evalImpl() function");
     };
 
-    using type =
-      typename tmp::disjunction<is_evaluable_test,
-                                is_evaluable_after_conversion_test<ConvertTo>...,
-                                nothing_matches<void>>::type;
+    using Conversions = tmp::type_list<is_evaluable_after_conversion_test<ConvertTo>...>;
+
+    using type = typename tmp::disjunction<is_evaluable_test,
+                                           cheapest_candidate<Conversions>,
+                                           nothing_matches<void>>::type;
 };
 
 
-/** Choose the first directly evaluable converted type, using either the given
- * binary expression or the tuple-like list of core leaf types for its operands.
+/** Choose the directly evaluable converted type, using either the given binary
+ * expression or the tuple-like list of core leaf types for its operands.
  *
- * For a `Derived` expression of the form `Binary<Lhs, Rhs>`, the order checked is:
+ * For a `Derived` expression of the form `Binary<Lhs, Rhs>`, the options checked are,
+ * in order:
  *
  * 1. `Binary<Lhs, Rhs>` (no conversion)
  * 2. For each type R in RhsConvertTo:
@@ -80,6 +149,10 @@ struct first_directly_evaluable_conversion_unary<Derived,
  *      `Binary<Convert<L, Lhs>, Rhs>`
  * 4. For the Cartesian product of the two ConvertTo lists:
  *      `Binary<Convert<L, Lhs>, Convert<R, Rhs>>`
+ *
+ * As for unary expressions, the first option is used if possible; otherwise, the
+ * conversions with the lowest total eval_cost are used. Each Convert stands for the
+ * operand_conversion of that operand.
  */
 template <typename Derived,
           typename Tag,
@@ -124,24 +197,32 @@ struct first_directly_evaluable_conversion_binary<Derived,
 
     template <typename ToLhs>
     struct convert_left_test
-      : tmp::conjunction<is_directly_evaluable_unary<expr<Convert, ToLhs>, eval_t<Lhs>>,
+      : tmp::conjunction<operand_conversion<ToLhs, Lhs>,
                          is_directly_evaluable_binary<Tag, ToLhs, eval_t<Rhs>>> {
-        using type = Rebind<Convert<ToLhs, Lhs>, Rhs>;
+        using type = Rebind<typename operand_conversion<ToLhs, Lhs>::type, Rhs>;
+        static constexpr int cost = operand_conversion<ToLhs, Lhs>::cost +
+                                    eval_cost<Tag, ToLhs, eval_t<Rhs>>::value;
     };
 
     template <typename ToRhs>
     struct convert_right_test
-      : tmp::conjunction<is_directly_evaluable_unary<expr<Convert, ToRhs>, eval_t<Rhs>>,
+      : tmp::conjunction<operand_conversion<ToRhs, Rhs>,
                          is_directly_evaluable_binary<Tag, eval_t<Lhs>, ToRhs>> {
-        using type = Rebind<Lhs, Convert<ToRhs, Rhs>>;
+        using type = Rebind<Lhs, typename operand_conversion<ToRhs, Rhs>::type>;
+        static constexpr int cost = operand_conversion<ToRhs, Rhs>::cost +
+                                    eval_cost<Tag, eval_t<Lhs>, ToRhs>::value;
     };
 
     template <typename ToLhs, typename ToRhs>
     struct convert_both_test
-      : tmp::conjunction<is_directly_evaluable_unary<expr<Convert, ToLhs>, eval_t<Lhs>>,
-                         is_directly_evaluable_unary<expr<Convert, ToRhs>, eval_t<Rhs>>,
+      : tmp::conjunction<operand_conversion<ToLhs, Lhs>,
+                         operand_conversion<ToRhs, Rhs>,
                          is_directly_evaluable_binary<Tag, ToLhs, ToRhs>> {
-        using type = Rebind<Convert<ToLhs, Lhs>, Convert<ToRhs, Rhs>>;
+        using type = Rebind<typename operand_conversion<ToLhs, Lhs>::type,
+                            typename operand_conversion<ToRhs, Rhs>::type>;
+        static constexpr int cost = operand_conversion<ToLhs, Lhs>::cost +
+                                    operand_conversion<ToRhs, Rhs>::cost +
+                                    eval_cost<Tag, ToLhs, ToRhs>::value;
     };
 
     template <typename T>
@@ -152,14 +233,16 @@ struct first_directly_evaluable_conversion_binary<Derived,
                       "Could not find conversions to an applicable evalImpl() function");
     };
 
-    using type = typename tmp::expanding_disjunction<
-      is_evaluable_test,
-      convert_right_test<RhsConvertTo>...,
-      convert_left_test<LhsConvertTo>...,
-      tmp::apply_cartesian_t<convert_both_test,
-                             tmp::type_list<LhsConvertTo...>,
-                             tmp::type_list<RhsConvertTo...>>,
-      nothing_matches<void>>::type;
+    using Conversions =
+      tmp::concat_t<tmp::type_list<convert_right_test<RhsConvertTo>...>,
+                    tmp::type_list<convert_left_test<LhsConvertTo>...>,
+                    tmp::apply_cartesian_t<convert_both_test,
+                                           tmp::type_list<LhsConvertTo...>,
+                                           tmp::type_list<RhsConvertTo...>>>;
+
+    using type = typename tmp::disjunction<is_evaluable_test,
+                                           cheapest_candidate<Conversions>,
+                                           nothing_matches<void>>::type;
 };
 
 }  // namespace internal
@@ -0,0 +1,505 @@
+/**
+ * @file
+ */
+
+#ifndef WAVE_GEOMETRY_ADJOINTJACOBIANEVALUATOR_HPP
+#define WAVE_GEOMETRY_ADJOINTJACOBIANEVALUATOR_HPP
+
+namespace wave {
+namespace internal {
+
+/** Aliases true_type if expression A contains a subexpression of the same type as any
+ * of the given targets, including inside any Shared subexpression.
+ *
+ * This is used to skip subtrees which cannot contain a target, at compile time. A
+ * Constant leaf is never a target.
+ */
+template <typename A, typename TargetList, typename Enable = void>
+struct contains_any_target;
+
+template <typename A, typename... Targets>
+struct contains_any_target<
+  A,
+  tmp::type_list<Targets...>,
+  tmp::enable_if_t<(is_leaf_expression<A>{} || is_nullary_expression<A>{}) &&
+                   !is_shared<A>{}>>
+  : tmp::bool_constant<tmp::disjunction<std::is_same<A, Targets>...>{} &&
+                       !is_constant_leaf<A>{}> {};
+
+template <typename A, typename... Targets>
+struct contains_any_target<A, tmp::type_list<Targets...>, enable_if_unary_t<A>>
+  : contains_any_target<typename A::RhsDerived, tmp::type_list<Targets...>> {};
+
+template <typename A, typename... Targets>
+struct contains_any_target<A, tmp::type_list<Targets...>, enable_if_binary_t<A>>
+  : tmp::bool_constant<
+      contains_any_target<typename A::LhsDerived, tmp::type_list<Targets...>>{} ||
+      contains_any_target<typename A::RhsDerived, tmp::type_list<Targets...>>{}> {};
+
+template <typename Derived, typename... Targets>
+struct contains_any_target<Shared<Derived>, tmp::type_list<Targets...>>
+  : tmp::bool_constant<
+      tmp::disjunction<std::is_same<Shared<Derived>, Targets>...>{} ||
+      contains_any_target<typename Shared<Derived>::SubexpressionType,
+                          tmp::type_list<Targets...>>{}> {};
+
+template <typename List, typename... Exprs>
+struct concat_shared_nodes;
+
+/** Gives a type_list of the distinct Shared types in an expression.
+ *
+ * Each Shared type appears after every Shared type it contains.
+ */
+template <typename A, typename Enable = void>
+struct shared_nodes {
+    using type = tmp::type_list<>;
+};
+
+template <typename A>
+using shared_nodes_t = typename shared_nodes<A>::type;
+
+template <typename A>
+struct shared_nodes<A, enable_if_unary_t<A>> : shared_nodes<typename A::RhsDerived> {};
+
+template <typename A>
+struct shared_nodes<A, enable_if_binary_t<A>>
+  : concat_shared_nodes<tmp::type_list<>,
+                        typename A::LhsDerived,
+                        typename A::RhsDerived> {};
+
+template <typename Derived>
+struct shared_nodes<Shared<Derived>> {
+    using type =
+      tmp::concat_unique_t<shared_nodes_t<typename Shared<Derived>::SubexpressionType>,
+                           tmp::type_list<Shared<Derived>>>;
+};
+
+/** Appends the Shared types of each expression to List, skipping those already in it */
+template <typename List, typename... Exprs>
+struct concat_shared_nodes {
+    using type = List;
+};
+
+template <typename List, typename First, typename... Rest>
+struct concat_shared_nodes<List, First, Rest...>
+  : concat_shared_nodes<tmp::concat_unique_t<List, shared_nodes_t<First>>, Rest...> {};
+
+/** Adds a leaf's adjoint to the jacobian of a target, if they are the same object */
+template <int Offset, typename Leaf, typename Jacobian, typename Adjoint>
+WAVE_STRONG_INLINE void addAdjointIfSame(const Leaf &leaf,
+                                         const Leaf &target,
+                                         Jacobian &jacobian,
+                                         const Adjoint &adjoint) {
+    if (isSame(leaf, target)) {
+        jacobian.template middleRows<Adjoint::RowsAtCompileTime>(Offset) += adjoint;
+    }
+}
+
+/** Overload for a leaf and target of different types, which are never the same object */
+template <int Offset, typename Leaf, typename Target, typename Jacobian, typename Adjoint>
+WAVE_STRONG_INLINE void addAdjointIfSame(const Leaf &,
+                                         const Target &,
+                                         Jacobian &,
+                                         const Adjoint &) {}
+
+/** The summed adjoint of a Shared node, before it is propagated into its subexpression
+ *
+ * Only one object of each Shared type is buffered. The adjoints of another object of the
+ * same type, which is unusual, are propagated as they arrive.
+ */
+template <typename Scalar, int Rows, typename SharedType>
+struct SharedAdjoint {
+    using Adjoint = Eigen::Matrix<Scalar, Rows, eval_traits<SharedType>::TangentSize>;
+
+    const SharedType *node = nullptr;
+    Adjoint adjoint = Adjoint::Zero();
+};
+
+/** Reverse-mode jacobian evaluator with targets identified by address
+ *
+ * Unlike evaluateWithReverseJacobians(), this does not require the leaves of the
+ * expression tree to have unique types. It makes one backward sweep over an Evaluator
+ * tree, which has cached the value of every node in the forward sweep. The adjoint of
+ * each node (the jacobian of the output with respect to that node) is passed down to its
+ * children. At each leaf, the adjoint is added to the jacobian of every target which is
+ * the same object, as determined by isSame(). A leaf appearing more than once in the
+ * expression thus gets the sum of the contributions of each occurrence.
+ *
+ * The adjoints reaching a Shared node are summed in a buffer instead. Once every output
+ * has been swept, finish() propagates each buffer into its subexpression, so the work
+ * below a Shared node is done once.
+ *
+ * Several outputs may be swept by one evaluator, with their jacobians stacked: an output
+ * swept with row offset `Offset` occupies the rows starting there.
+ *
+ * Subtrees which cannot contain a target type are skipped at compile time.
+ *
+ * @tparam Scalar the scalar type of the outputs
+ * @tparam Rows the total tangent size of the outputs
+ * @tparam SharedList a type_list of the Shared types in the outputs, as given by
+ * shared_nodes_t
+ * @tparam Targets the types of the leaves to find jacobians with respect to
+ */
+template <typename Scalar, int Rows, typename SharedList, typename... Targets>
+class AdjointJacobianEvaluator;
+
+template <typename Scalar, int Rows, typename... SharedTypes, typename... Targets>
+class AdjointJacobianEvaluator<Scalar, Rows, tmp::type_list<SharedTypes...>, Targets...> {
+    using TargetList = tmp::type_list<Targets...>;
+    using SharedList = tmp::type_list<SharedTypes...>;
+
+    template <typename T>
+    using contains_target = contains_any_target<T, TargetList>;
+
+    template <typename T>
+    using stacked_jacobian_t = Eigen::Matrix<Scalar, Rows, eval_traits<T>::TangentSize>;
+
+    // The adjoint of node T, with as many rows as the given adjoint
+    template <typename Adjoint, typename T>
+    using adjoint_t =
+      Eigen::Matrix<Scalar, Adjoint::RowsAtCompileTime, eval_traits<T>::TangentSize>;
+
+ public:
+    using JacobianTuple = std::tuple<stacked_jacobian_t<Targets>...>;
+
+    WAVE_STRONG_INLINE explicit AdjointJacobianEvaluator(const Targets &... targets)
+        : targets{targets...}, jacobians{stacked_jacobian_t<Targets>::Zero()...} {}
+
+    /** Accumulates the adjoints of one output, whose rows start at Offset */
+    template <int Offset, typename Derived>
+    WAVE_STRONG_INLINE void sweep(const Evaluator<Derived> &evaluator) {
+        this->accumulateIf<Offset>(
+          contains_target<Derived>{}, evaluator, identity_t<Derived>{});
+    }
+
+    /** Propagates the summed adjoints of Shared nodes into their subexpressions
+     *
+     * Call once, after sweeping all outputs.
+     */
+    WAVE_STRONG_INLINE void finish() {
+        this->finishShared(std::integral_constant<int, sizeof...(SharedTypes) - 1>{});
+    }
+
+    const JacobianTuple &jacobian() const & {
+        return this->jacobians;
+    }
+
+    JacobianTuple &&jacobian() && {
+        return std::move(this->jacobians);
+    }
+
+ private:
+    // Skip a subtree which cannot contain a target
+    template <int Offset, typename Derived, typename Adjoint>
+    WAVE_STRONG_INLINE void accumulateIf(std::false_type,
+                                         const Evaluator<Derived> &,
+                                         const Adjoint &) {}
+
+    template <int Offset, typename Derived, typename Adjoint>
+    WAVE_STRONG_INLINE void accumulateIf(std::true_type,
+                                         const Evaluator<Derived> &evaluator,
+                                         const Adjoint &adjoint) {
+        this->accumulate<Offset>(evaluator, adjoint);
+    }
+
+    /** Adds the adjoint of a leaf to the jacobian of each target it is */
+    template <int Offset,
+              typename Derived,
+              typename Adjoint,
+              tmp::enable_if_t<is_leaf_expression<Derived>{} && !is_shared<Derived>{},
+                               int> = 0>
+    WAVE_STRONG_INLINE void accumulate(const Evaluator<Derived> &evaluator,
+                                       const Adjoint &adjoint) {
+        this->addToTargets<Offset>(
+          evaluator.expr, adjoint, tmp::make_index_sequence<sizeof...(Targets)>{});
+    }
+
+    /** Adds the adjoint of a Shared node to its buffer, and to any target it is */
+    template <int Offset,
+              typename Derived,
+              typename Adjoint,
+              tmp::enable_if_t<is_shared<Derived>{}, int> = 0>
+    WAVE_STRONG_INLINE void accumulate(const Evaluator<Derived> &evaluator,
+                                       const Adjoint &adjoint) {
+        const Derived &node = evaluator.expr;
+        this->addToTargets<Offset>(
+          node, adjoint, tmp::make_index_sequence<sizeof...(Targets)>{});
+        this->bufferShared<Offset>(
+          contains_target<typename Derived::SubexpressionType>{}, node, adjoint);
+    }
+
+    template <int Offset, typename Derived, typename Adjoint>
+    WAVE_STRONG_INLINE void bufferShared(std::false_type,
+                                         const Shared<Derived> &,
+                                         const Adjoint &) {}
+
+    template <int Offset, typename Derived, typename Adjoint>
+    WAVE_STRONG_INLINE void bufferShared(std::true_type,
+                                         const Shared<Derived> &node,
+                                         const Adjoint &adjoint) {
+        constexpr int I = tmp::find<SharedList, Shared<Derived>>::value;
+        auto &buffer = std::get<I>(this->shared);
+        if (buffer.node == nullptr) {
+            buffer.node = &node;
+        }
+        if (buffer.node == &node) {
+            buffer.adjoint.template middleRows<Adjoint::RowsAtCompileTime>(Offset) +=
+              adjoint;
+        } else {
+            this->accumulate<Offset>(node.evaluator(), adjoint);
+        }
+    }
+
+    /** Passes the adjoint of a unary expression down to its operand */
+    template <int Offset,
+              typename Derived,
+              typename Adjoint,
+              enable_if_unary_t<Derived, int> = 0>
+    WAVE_STRONG_INLINE void accumulate(const Evaluator<Derived> &evaluator,
+                                       const Adjoint &adjoint) {
+        using RhsAdjoint = adjoint_t<Adjoint, typename Derived::RhsDerived>;
+        const RhsAdjoint rhs_adjoint = adjoint * localJacobian(evaluator);
+        this->accumulate<Offset>(evaluator.rhs_eval, rhs_adjoint);
+    }
+
+    /** Passes the adjoint of a binary expression down to the operands which may contain
+     * a target */
+    template <int Offset,
+              typename Derived,
+              typename Adjoint,
+              enable_if_binary_t<Derived, int> = 0>
+    WAVE_STRONG_INLINE void accumulate(const Evaluator<Derived> &evaluator,
+                                       const Adjoint &adjoint) {
+        this->accumulateLhs<Offset>(
+          contains_target<typename Derived::LhsDerived>{}, evaluator, adjoint);
+        this->accumulateRhs<Offset>(
+          contains_target<typename Derived::RhsDerived>{}, evaluator, adjoint);
+    }
+
+    template <int Offset, typename Derived, typename Adjoint>
+    WAVE_STRONG_INLINE void accumulateLhs(std::false_type,
+                                          const Evaluator<Derived> &,
+                                          const Adjoint &) {}
+
+    template <int Offset, typename Derived, typename Adjoint>
+    WAVE_STRONG_INLINE void accumulateLhs(std::true_type,
+                                          const Evaluator<Derived> &evaluator,
+                                          const Adjoint &adjoint) {
+        using LhsAdjoint = adjoint_t<Adjoint, typename Derived::LhsDerived>;
+        const LhsAdjoint lhs_adjoint = adjoint * localLeftJacobian(evaluator);
+        this->accumulate<Offset>(evaluator.lhs_eval, lhs_adjoint);
+    }
+
+    template <int Offset, typename Derived, typename Adjoint>
+    WAVE_STRONG_INLINE void accumulateRhs(std::false_type,
+                                          const Evaluator<Derived> &,
+                                          const Adjoint &) {}
+
+    template <int Offset, typename Derived, typename Adjoint>
+    WAVE_STRONG_INLINE void accumulateRhs(std::true_type,
+                                          const Evaluator<Derived> &evaluator,
+                                          const Adjoint &adjoint) {
+        using RhsAdjoint = adjoint_t<Adjoint, typename Derived::RhsDerived>;
+        const RhsAdjoint rhs_adjoint = adjoint * localRightJacobian(evaluator);
+        this->accumulate<Offset>(evaluator.rhs_eval, rhs_adjoint);
+    }
+
+    template <int Offset, typename Leaf, typename Adjoint, int... Is>
+    WAVE_STRONG_INLINE void addToTargets(const Leaf &leaf,
+                                         const Adjoint &adjoint,
+                                         tmp::index_sequence<Is...>) {
+        const int expand[] = {0,
+                              (addAdjointIfSame<Offset>(leaf,
+                                                        std::get<Is>(this->targets),
+                                                        std::get<Is>(this->jacobians),
+                                                        adjoint),
+                               0)...};
+        (void) expand;
+    }
+
+    // Propagate the buffers in reverse order, so that each is complete before it is
+    // propagated: a Shared type comes after any Shared types it contains
+    template <int I>
+    WAVE_STRONG_INLINE void finishShared(std::integral_constant<int, I>) {
+        using SharedType =
+          typename std::tuple_element<I, std::tuple<SharedTypes...>>::type;
+        using Subexpression = typename SharedType::SubexpressionType;
+        const auto &buffer = std::get<I>(this->shared);
+        if (buffer.node != nullptr) {
+            this->accumulateIf<0>(
+              contains_target<Subexpression>{}, buffer.node->evaluator(), buffer.adjoint);
+        }
+        this->finishShared(std::integral_constant<int, I - 1>{});
+    }
+
+    WAVE_STRONG_INLINE void finishShared(std::integral_constant<int, -1>) {}
+
+    const std::tuple<const Targets &...> targets;
+    JacobianTuple jacobians;
+    std::tuple<SharedAdjoint<Scalar, Rows, SharedTypes>...> shared;
+};
+
+/** Performs the backward sweep of evaluateWithAdjointJacobians() on an Evaluator tree,
+ * whose type may differ from the expression's after adding conversions */
+template <typename PreparedDerived, typename... Targets>
+auto evaluateWithAdjointJacobiansImpl(const Evaluator<PreparedDerived> &v_eval,
+                                      const Targets &... targets)
+  -> std::tuple<plain_output_t<PreparedDerived>,
+                jacobian_t<PreparedDerived, Targets>...> {
+    AdjointJacobianEvaluator<scalar_t<PreparedDerived>,
+                             eval_traits<PreparedDerived>::TangentSize,
+                             shared_nodes_t<PreparedDerived>,
+                             Targets...>
+      j_eval{targets...};
+    j_eval.template sweep<0>(v_eval);
+    j_eval.finish();
+    return std::tuple_cat(std::forward_as_tuple(prepareOutput(v_eval)),
+                          std::move(j_eval).jacobian());
+}
+
+/** Evaluate the result of an expression tree and its jacobians w.r.t. the targets, in
+ * one backward sweep
+ *
+ * Unlike evaluateWithReverseJacobians(expr), the expression's leaves need not have
+ * unique types; targets are identified by address.
+ *
+ * @return a tuple of the value of the expression and the jacobians, in the order of the
+ * targets
+ */
+template <typename Derived, typename... Targets>
+auto evaluateWithAdjointJacobians(const ExpressionBase<Derived> &expr,
+                                  const ExpressionBase<Targets> &... targets)
+  -> std::tuple<plain_output_t<Derived>, jacobian_t<Derived, Targets>...> {
+    // Make the Evaluator tree (forward sweep)
+    const auto &v_eval = prepareEvaluatorTo<plain_output_t<Derived>>(expr.derived());
+    return evaluateWithAdjointJacobiansImpl(v_eval, targets.derived()...);
+}
+
+/** The value and jacobians of one expression w.r.t. a type_list of targets */
+template <typename Derived, typename TargetList>
+struct eval_with_jacobians;
+
+template <typename Derived, typename... Targets>
+struct eval_with_jacobians<Derived, tmp::type_list<Targets...>> {
+    using type = std::tuple<plain_output_t<Derived>, jacobian_t<Derived, Targets>...>;
+};
+
+/** The values and jacobians of a type_list of expressions w.r.t. a type_list of targets
+ */
+template <typename OutputList, typename TargetList>
+struct multi_eval_with_jacobians;
+
+template <typename... Outputs, typename TargetList>
+struct multi_eval_with_jacobians<tmp::type_list<Outputs...>, TargetList> {
+    using type = std::tuple<
+      typename eval_with_jacobians<tmp::remove_cr_t<Outputs>, TargetList>::type...>;
+};
+
+/** Gives the first row of output i, when outputs of the given sizes are stacked */
+constexpr int stackedRowOffset(int) {
+    return 0;
+}
+
+template <typename... Sizes>
+constexpr int stackedRowOffset(int i, int first, Sizes... rest) {
+    return i > 0 ? first + stackedRowOffset(i - 1, rest...) : 0;
+}
+
+/** The rows of stacked outputs with the given tangent sizes */
+template <int... Sizes>
+struct stacked_rows {
+    static constexpr int Rows = stackedRowOffset(sizeof...(Sizes), Sizes...);
+
+    template <int I>
+    using offset = std::integral_constant<int, stackedRowOffset(I, Sizes...)>;
+};
+
+/** Takes one output's value, and its rows of the stacked jacobians */
+template <typename Derived,
+          int Offset,
+          typename PreparedDerived,
+          typename Jacobians,
+          typename... Targets,
+          int... Ts>
+auto splitStackedJacobians(const Evaluator<PreparedDerived> &v_eval,
+                           const Jacobians &jacobians,
+                           tmp::type_list<Targets...>,
+                           tmp::index_sequence<Ts...>) ->
+  typename eval_with_jacobians<Derived, tmp::type_list<Targets...>>::type {
+    using Result =
+      typename eval_with_jacobians<Derived, tmp::type_list<Targets...>>::type;
+    return Result{prepareOutput(v_eval),
+                  std::get<Ts>(jacobians)
+                    .template middleRows<eval_traits<Derived>::TangentSize>(Offset)...};
+}
+
+template <typename... Outputs, int... Is, typename... Targets>
+auto evaluateMultiWithAdjointJacobiansImpl(const std::tuple<Outputs...> &outputs,
+                                           tmp::index_sequence<Is...>,
+                                           const Targets &... targets) ->
+  typename multi_eval_with_jacobians<tmp::type_list<Outputs...>,
+                                     tmp::type_list<Targets...>>::type {
+    // Make the Evaluator trees (forward sweeps)
+    const auto evaluators =
+      std::make_tuple(prepareEvaluatorTo<plain_output_t<tmp::remove_cr_t<Outputs>>>(
+        std::get<Is>(outputs))...);
+
+    // Find the stacked jacobians (backward sweep)
+    using First = typename std::tuple_element<0, std::tuple<Outputs...>>::type;
+    using Stacked = stacked_rows<eval_traits<tmp::remove_cr_t<Outputs>>::TangentSize...>;
+    using SharedList = typename concat_shared_nodes<
+      tmp::type_list<>,
+      typename traits<tmp::remove_cr_t<Outputs>>::PreparedType...>::type;
+    AdjointJacobianEvaluator<scalar_t<tmp::remove_cr_t<First>>,
+                             Stacked::Rows,
+                             SharedList,
+                             Targets...>
+      j_eval{targets...};
+
+    const int expand[] = {0,
+                          (j_eval.template sweep<Stacked::template offset<Is>::value>(
+                             std::get<Is>(evaluators)),
+                           0)...};
+    (void) expand;
+    j_eval.finish();
+
+    return std::make_tuple(
+      splitStackedJacobians<tmp::remove_cr_t<Outputs>,
+                            Stacked::template offset<Is>::value>(
+        std::get<Is>(evaluators),
+        j_eval.jacobian(),
+        tmp::type_list<Targets...>{},
+        tmp::make_index_sequence<sizeof...(Targets)>{})...);
+}
+
+}  // namespace internal
+
+/** Evaluates several expressions and their jacobians w.r.t. the same targets
+ *
+ * The outputs are swept backward together. Each Shared subexpression used by them is
+ * evaluated once, and its jacobians are propagated into its subexpression once, for all
+ * outputs. For example,
+ *
+ *     const auto AB = share(A * B);
+ *     auto res = evalMultiWithJacobians(std::forward_as_tuple(log(AB), AB * p), A, B);
+ *
+ * evaluates A * B and its jacobians with respect to A and B once.
+ *
+ * @param outputs a tuple of expressions, e.g. from std::forward_as_tuple()
+ * @param targets leaves to find jacobians with respect to
+ * @return a tuple with, for each output, the tuple evalWithJacobians(targets...) would
+ * return
+ */
+template <typename... Outputs, typename... Targets>
+auto evalMultiWithJacobians(const std::tuple<Outputs...> &outputs,
+                            const ExpressionBase<Targets> &... targets) ->
+  typename internal::multi_eval_with_jacobians<tmp::type_list<Outputs...>,
+                                               tmp::type_list<Targets...>>::type {
+    static_assert(sizeof...(Outputs) > 0, "At least one output is needed");
+    return internal::evaluateMultiWithAdjointJacobiansImpl(
+      outputs, tmp::make_index_sequence<sizeof...(Outputs)>{}, targets.derived()...);
+}
+
+}  // namespace wave
+
+#endif  // WAVE_GEOMETRY_ADJOINTJACOBIANEVALUATOR_HPP
@@ -0,0 +1,316 @@
+/**
+ * @file
+ */
+
+#ifndef WAVE_GEOMETRY_BATCHJACOBIANEVALUATOR_HPP
+#define WAVE_GEOMETRY_BATCHJACOBIANEVALUATOR_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+namespace wave {
+
+/** A std::vector with the allocator needed for fixed-size Eigen members */
+template <typename T>
+using AlignedVector = std::vector<T, Eigen::aligned_allocator<T>>;
+
+namespace internal {
+
+/** The result type of evalBatchWithJacobians: one contiguous array for the values and
+ * one for each jacobian, in the same order as the tuple from evalWithJacobians().
+ */
+template <typename Derived>
+using batch_with_reverse_jacobians_t =
+  tmp::apply_each_t<AlignedVector, eval_with_reverse_jacobians_t<Derived>>;
+
+/** Resizes each array in a tuple to n elements */
+template <typename Outputs, int... Is>
+void resizeOutputs(Outputs &outputs, std::size_t n, tmp::index_sequence<Is...>) {
+    const int expand[] = {0, (std::get<Is>(outputs).resize(n), 0)...};
+    (void) expand;
+}
+
+/** Evaluates one expression and its reverse-mode jacobians into element i of outputs
+ *
+ * This is the body of evaluateWithReverseJacobians(), except the value and jacobians are
+ * written straight into element i of each array instead of being collected in a tuple.
+ */
+template <typename Derived, typename Outputs, int... Is>
+WAVE_STRONG_INLINE void evaluateBatchElement(const Derived &expr,
+                                             Outputs &outputs,
+                                             std::size_t i,
+                                             tmp::index_sequence<Is...>) {
+    using OutputType = plain_output_t<Derived>;
+    const auto &v_eval = prepareEvaluatorTo<OutputType>(expr);
+
+    // Element i is a reference, or a proxy such as an Eigen::Map which is held by value
+    std::tuple<decltype(std::get<Is>(outputs)[i])...> result{std::get<Is>(outputs)[i]...};
+    std::get<0>(result) = prepareOutput(v_eval);
+    reverseSweepAll(v_eval, result);
+}
+
+/** The number of elements evaluated together as Lanes, when a batch's leaves allow it
+ *
+ * Four doubles fill an AVX register; with SSE, each operation takes two.
+ */
+constexpr int BatchLanes = 4;
+
+/** The leaf type holding N values of a leaf type, one per lane, with Lanes scalars
+ *
+ * Leaf types whose operations are written with laneGreater() and laneSelect() instead of
+ * branches specialize this with a `type`. A batch whose inputs all have one is evaluated
+ * BatchLanes elements at a time; see evaluateBatchRange().
+ */
+template <typename Leaf, int N, typename Enable = void>
+struct lane_leaf {};
+
+template <typename Leaf, int N>
+using lane_leaf_t = typename lane_leaf<tmp::remove_cr_t<Leaf>, N>::type;
+
+/** The type of an element of a range of inputs */
+template <typename Range>
+using range_element_t = decltype(std::declval<const Range &>()[0]);
+
+/** The expression given by make_expr for the given leaf types */
+template <typename MakeExpr, typename... Leaves>
+using made_expr_t = tmp::remove_cr_t<decltype(
+  std::declval<const MakeExpr &>()(std::declval<const Leaves &>()...))>;
+
+/** Evaluates to true_type if a batch can be evaluated as Lanes
+ *
+ * Each input element needs a lane leaf type, make_expr must accept those leaves, and the
+ * expression it gives must have the lane type of the single-element expression's output.
+ */
+template <typename MakeExpr, typename RangeList, typename Enable = void>
+struct batch_uses_lanes : std::false_type {};
+
+template <typename MakeExpr, typename... Ranges>
+struct batch_uses_lanes<
+  MakeExpr,
+  tmp::type_list<Ranges...>,
+  tmp::void_t<
+    made_expr_t<MakeExpr, lane_leaf_t<range_element_t<Ranges>, BatchLanes>...>,
+    lane_leaf_t<plain_output_t<made_expr_t<MakeExpr, range_element_t<Ranges>...>>,
+                BatchLanes>>>
+  : std::is_same<
+      lane_leaf_t<plain_output_t<made_expr_t<MakeExpr, range_element_t<Ranges>...>>,
+                  BatchLanes>,
+      plain_output_t<
+        made_expr_t<MakeExpr, lane_leaf_t<range_element_t<Ranges>, BatchLanes>...>>> {};
+
+/** Packs elements [i, i + N) of a range of leaves into one leaf of Lanes */
+template <int N, typename Range>
+auto packLanes(const Range &input, std::size_t i)
+  -> lane_leaf_t<decltype(input[i]), N> {
+    lane_leaf_t<decltype(input[i]), N> out;
+    for (int k = 0; k < N; ++k) {
+        setLane(out.value(), k, input[i + k].value());
+    }
+    return out;
+}
+
+/** Writes lane k of a value of Lanes into a leaf, or a proxy such as an Eigen::Map */
+template <typename Out, typename Derived>
+void unpackLane(Out &&out, const ExpressionBase<Derived> &lanes, int k) {
+    out.value() = laneOf(lanes.derived().value(), k);
+}
+
+/** Writes lane k of a jacobian of Lanes into a matrix, or a proxy such as an Eigen::Map
+ */
+template <typename Out, typename Derived>
+void unpackLane(Out &&out, const Eigen::MatrixBase<Derived> &lanes, int k) {
+    out = laneOf(lanes, k);
+}
+
+/** Evaluates elements [i, i + BatchLanes) of a batch together, as one expression of
+ * Lanes, into the outputs */
+template <typename Outputs, typename MakeExpr, typename... Ranges, int... Is>
+void evaluateBatchLaneGroup(Outputs &outputs,
+                            const MakeExpr &make_expr,
+                            std::size_t i,
+                            tmp::index_sequence<Is...>,
+                            const Ranges &... inputs) {
+    // The packed leaves live until the end of this statement, after evaluation
+    const auto result =
+      evaluateWithReverseJacobians(make_expr(packLanes<BatchLanes>(inputs, i)...));
+    for (int k = 0; k < BatchLanes; ++k) {
+        const int expand[] = {
+          0, (unpackLane(std::get<Is>(outputs)[i + k], std::get<Is>(result), k), 0)...};
+        (void) expand;
+    }
+}
+
+/** Evaluates as many whole groups of BatchLanes elements as fit in [begin, end), and
+ * returns the index of the first element left */
+template <typename Outputs, typename MakeExpr, typename... Ranges>
+std::size_t evaluateBatchLaneGroups(std::true_type,
+                                    Outputs &outputs,
+                                    const MakeExpr &make_expr,
+                                    std::size_t begin,
+                                    std::size_t end,
+                                    const Ranges &... inputs) {
+    constexpr int NumOutputs = std::tuple_size<Outputs>::value;
+    auto i = begin;
+    for (; i + BatchLanes <= end; i += BatchLanes) {
+        evaluateBatchLaneGroup(
+          outputs, make_expr, i, tmp::make_index_sequence<NumOutputs>{}, inputs...);
+    }
+    return i;
+}
+
+/** Evaluates no groups, for batches whose leaves have no lane type */
+template <typename Outputs, typename MakeExpr, typename... Ranges>
+std::size_t evaluateBatchLaneGroups(std::false_type,
+                                    Outputs &,
+                                    const MakeExpr &,
+                                    std::size_t begin,
+                                    std::size_t,
+                                    const Ranges &...) {
+    return begin;
+}
+
+/** Checks the inputs have equal length, resizes the outputs to match, and returns it */
+template <typename Outputs, typename... Ranges>
+std::size_t prepareBatchOutputs(Outputs &outputs, const Ranges &... inputs) {
+    const std::size_t sizes[] = {inputs.size()...};
+    const auto n = sizes[0];
+    for (const auto size : sizes) {
+        assert(size == n && "All inputs must have the same length");
+        (void) size;
+    }
+
+    constexpr int NumOutputs = std::tuple_size<Outputs>::value;
+    resizeOutputs(outputs, n, tmp::make_index_sequence<NumOutputs>{});
+    return n;
+}
+
+/** Evaluates elements [begin, end) of a batch into the outputs, which must be sized
+ *
+ * If the batch can be evaluated as Lanes (see batch_uses_lanes), each group of
+ * BatchLanes elements is packed and evaluated once. The elements left after the last
+ * whole group are evaluated one at a time.
+ */
+template <typename Outputs, typename MakeExpr, typename... Ranges>
+void evaluateBatchRange(Outputs &outputs,
+                        const MakeExpr &make_expr,
+                        std::size_t begin,
+                        std::size_t end,
+                        const Ranges &... inputs) {
+    const auto rest =
+      evaluateBatchLaneGroups(batch_uses_lanes<MakeExpr, tmp::type_list<Ranges...>>{},
+                              outputs,
+                              make_expr,
+                              begin,
+                              end,
+                              inputs...);
+    for (std::size_t i = rest; i < end; ++i) {
+        evaluateBatchElement(make_expr(inputs[i]...),
+                             outputs,
+                             i,
+                             tmp::make_index_sequence<std::tuple_size<Outputs>::value>{});
+    }
+}
+
+/** Number of elements evaluated by a thread between checks for more work
+ *
+ * Large enough that threads write separate cache lines of the outputs except at the
+ * edges of a grain, and that claiming work is rare compared to evaluating.
+ */
+constexpr std::size_t BatchGrainSize = 256;
+
+}  // namespace internal
+
+/** Evaluates one expression shape over many bindings of its leaves, with all jacobians.
+ *
+ * This is the batched form of `make_expr(inputs[i]...).evalWithJacobians()`, for
+ * evaluating the same residual over many measurements. All results are written into
+ * contiguous arrays which are reused between calls.
+ *
+ * If the inputs are all leaves with a lane type, such as rotation matrices, relative
+ * rotations and translations, make_expr is also called with leaves of Lanes, and groups
+ * of internal::BatchLanes elements are evaluated together as one expression.
+ *
+ * @param outputs a tuple of arrays, one for the values followed by one per jacobian, as
+ * given by internal::batch_with_reverse_jacobians_t. Each is resized to the number of
+ * inputs.
+ * @param make_expr function object taking one element of each input and returning the
+ * expression to evaluate. The expression must have unique leaves.
+ * @param inputs random-access ranges of leaves (e.g. std::vector) of equal length. The
+ * ranges must return references to their elements, which the expression may refer to,
+ * or objects which live until the expression is evaluated, like those of a StridedView.
+ */
+template <typename Outputs, typename MakeExpr, typename... Ranges>
+void evalBatchWithJacobiansTo(Outputs &outputs,
+                              const MakeExpr &make_expr,
+                              const Ranges &... inputs) {
+    const auto n = internal::prepareBatchOutputs(outputs, inputs...);
+    internal::evaluateBatchRange(outputs, make_expr, 0, n, inputs...);
+}
+
+/** Evaluates one expression shape over many bindings of its leaves, with all jacobians.
+ *
+ * @returns a tuple of arrays: the values, followed by the jacobians with respect to each
+ * leaf, in the same order as evalWithJacobians().
+ *
+ * @see evalBatchWithJacobiansTo(), to reuse storage between calls.
+ */
+template <typename MakeExpr,
+          typename... Ranges,
+          typename Derived = tmp::remove_cr_t<decltype(
+            std::declval<const MakeExpr &>()(std::declval<const Ranges &>()[0]...))>>
+auto evalBatchWithJacobians(const MakeExpr &make_expr, const Ranges &... inputs)
+  -> internal::batch_with_reverse_jacobians_t<Derived> {
+    internal::batch_with_reverse_jacobians_t<Derived> outputs;
+    evalBatchWithJacobiansTo(outputs, make_expr, inputs...);
+    return outputs;
+}
+
+/** Evaluates one expression shape over many bindings of its leaves, with all jacobians,
+ * using the threads of a pool.
+ *
+ * The results are the same as from evalBatchWithJacobiansTo(). Elements are split across
+ * threads in grains of contiguous indices, so each output array is written in large
+ * blocks by each thread. Grains hold whole groups of BatchLanes elements, grouped as by
+ * a single thread.
+ *
+ * @param pool the threads to use. Its size sets the number of threads.
+ * @param make_expr as for evalBatchWithJacobiansTo(). It is called concurrently, so must
+ * not modify shared state.
+ */
+template <typename Outputs, typename MakeExpr, typename... Ranges>
+void parallelEvalBatchWithJacobiansTo(ThreadPool &pool,
+                                      Outputs &outputs,
+                                      const MakeExpr &make_expr,
+                                      const Ranges &... inputs) {
+    const auto n = internal::prepareBatchOutputs(outputs, inputs...);
+    constexpr std::size_t W = internal::BatchLanes;
+    const auto num_groups = (n + W - 1) / W;
+    pool.parallelFor(
+      num_groups, internal::BatchGrainSize / W, [&](std::size_t begin, std::size_t end) {
+          internal::evaluateBatchRange(
+            outputs, make_expr, begin * W, std::min(end * W, n), inputs...);
+      });
+}
+
+/** Evaluates one expression shape over many bindings of its leaves, with all jacobians,
+ * using the threads of a pool.
+ *
+ * @see parallelEvalBatchWithJacobiansTo(), to reuse storage between calls.
+ */
+template <typename MakeExpr,
+          typename... Ranges,
+          typename Derived = tmp::remove_cr_t<decltype(
+            std::declval<const MakeExpr &>()(std::declval<const Ranges &>()[0]...))>>
+auto parallelEvalBatchWithJacobians(ThreadPool &pool,
+                                    const MakeExpr &make_expr,
+                                    const Ranges &... inputs)
+  -> internal::batch_with_reverse_jacobians_t<Derived> {
+    internal::batch_with_reverse_jacobians_t<Derived> outputs;
+    parallelEvalBatchWithJacobiansTo(pool, outputs, make_expr, inputs...);
+    return outputs;
+}
+
+}  // namespace wave
+
+#endif  // WAVE_GEOMETRY_BATCHJACOBIANEVALUATOR_HPP
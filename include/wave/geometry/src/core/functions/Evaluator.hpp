@@ -8,12 +8,79 @@
 namespace wave {
 namespace internal {
 
-/** Functor to evaluate an expression tree
+/** The result of evaluating a node, with intermediates its jacobians can reuse
+ *
+ * An operation may provide, alongside its `evalImpl()`,
+ *
+ *     evalWithAuxImpl(Tag, operands...) -> EvalWithAux<Value, Aux>
+ *
+ * giving the same value and an Aux struct holding whatever its jacobians would otherwise
+ * recompute, such as the sine and cosine of an angle. The Evaluator then keeps the Aux,
+ * and the node's jacobians are found by calling
  *
- * For now, the expression is evaluated as-is
- * In future, optimizations could go here. For example,
- * q1.inverse() * q2.inverse() -> (q2 * q1).inverse()
+ *     jacobianImpl(Tag, value, aux, rhs)
+ *     leftJacobianImpl(Tag, value, aux, lhs, rhs)
+ *     rightJacobianImpl(Tag, value, aux, lhs, rhs)
  *
+ * instead of the overloads without aux. See localJacobian().
+ */
+template <typename Value, typename Aux = void>
+struct EvalWithAux {
+    Value value;
+    Aux aux;
+};
+
+/** The result of evaluating a node with no evalWithAuxImpl() */
+template <typename Value>
+struct EvalWithAux<Value, void> {
+    Value value;
+};
+
+/** The Aux type given by evalWithAuxImpl() for the node Tag, or void if there is none */
+template <typename Tag, typename Operands, typename = void>
+struct eval_aux {
+    using type = void;
+};
+
+template <typename Tag, typename... Operands>
+struct eval_aux<
+  Tag,
+  tmp::type_list<Operands...>,
+  tmp::void_t<decltype(evalWithAuxImpl(Tag{}, std::declval<const Operands &>()...))>> {
+    using type = decltype(
+      evalWithAuxImpl(Tag{}, std::declval<const Operands &>()...).aux);
+};
+
+template <typename Tag, typename... Operands>
+using eval_aux_t = typename eval_aux<Tag, tmp::type_list<Operands...>>::type;
+
+/** Evaluates a node without aux */
+template <typename Value,
+          typename Aux,
+          typename Tag,
+          typename... Operands,
+          TICK_REQUIRES(std::is_void<Aux>{})>
+WAVE_STRONG_INLINE auto evalNode(Tag, const Operands &... operands)
+  -> EvalWithAux<Value, Aux> {
+    return {evalImpl(Tag{}, operands...)};
+}
+
+/** Evaluates a node with aux */
+template <typename Value,
+          typename Aux,
+          typename Tag,
+          typename... Operands,
+          TICK_REQUIRES(!std::is_void<Aux>{})>
+WAVE_STRONG_INLINE auto evalNode(Tag, const Operands &... operands)
+  -> EvalWithAux<Value, Aux> {
+    return evalWithAuxImpl(Tag{}, operands...);
+}
+
+/** Functor to evaluate an expression tree
+ *
+ * The expression is evaluated as-is. Optimizations such as
+ * q1.inverse() * q2.inverse() -> (q2 * q1).inverse() are applied beforehand, by
+ * RewriteExpr.
  */
 template <typename Derived, typename = void>
 struct Evaluator;
@@ -26,13 +93,18 @@ struct Evaluator<Derived, enable_if_leaf_t<Derived>> {
     WAVE_STRONG_INLINE explicit Evaluator(const Derived &expr)
         : expr{expr}, result{evalImpl(get_expr_tag_t<Derived>(), expr)} {}
 
-    const EvalType &operator()() const {
+    const EvalType &operator()() const & {
         return this->result;
     }
 
+    /** Moves the result out of an expiring Evaluator */
+    EvalType &&operator()() && {
+        return std::move(this->result);
+    }
+
  public:
     const wave_ref_sel_t<Derived> expr;
-    const EvalType result;
+    EvalType result;
 };
 
 /** Specialization for nullary expression */
@@ -43,13 +115,18 @@ struct Evaluator<Derived, enable_if_nullary_t<Derived>> {
     WAVE_STRONG_INLINE explicit Evaluator(const Derived &expr)
         : expr{expr}, result{evalImpl(get_expr_tag_t<Derived>())} {}
 
-    const EvalType &operator()() const {
+    const EvalType &operator()() const & {
         return this->result;
     }
 
+    /** Moves the result out of an expiring Evaluator */
+    EvalType &&operator()() && {
+        return std::move(this->result);
+    }
+
  public:
     const wave_ref_sel_t<Derived> expr;
-    const EvalType result;
+    EvalType result;
 };
 
 /** Specialization for unary expression */
@@ -57,20 +134,32 @@ template <typename Derived>
 struct Evaluator<Derived, enable_if_unary_t<Derived>> {
     using EvalType = eval_t<Derived>;
     using RhsEval = Evaluator<typename Derived::RhsDerived>;
+    using Aux = eval_aux_t<get_expr_tag_t<Derived>, typename RhsEval::EvalType>;
 
     WAVE_STRONG_INLINE explicit Evaluator(const Derived &expr)
         : expr{expr},
           rhs_eval{expr.rhs()},
-          result{evalImpl(get_expr_tag_t<Derived>(), this->rhs_eval())} {}
+          node{evalNode<EvalType, Aux>(get_expr_tag_t<Derived>(), this->rhs_eval())} {}
 
-    const EvalType &operator()() const {
-        return this->result;
+    const EvalType &operator()() const & {
+        return this->node.value;
+    }
+
+    /** Moves the result out of an expiring Evaluator */
+    EvalType &&operator()() && {
+        return std::move(this->node.value);
+    }
+
+    /** The intermediates kept by evalWithAuxImpl(), if Aux is not void */
+    template <typename A = Aux>
+    const A &aux() const {
+        return this->node.aux;
     }
 
  public:
     const wave_ref_sel_t<Derived> expr;
     const RhsEval rhs_eval;
-    const EvalType result;
+    EvalWithAux<EvalType, Aux> node;
 };
 
 /** Specialization for a binary expression */
@@ -79,25 +168,139 @@ struct Evaluator<Derived, enable_if_binary_t<Derived>> {
     using EvalType = eval_t<Derived>;
     using LhsEval = Evaluator<typename Derived::LhsDerived>;
     using RhsEval = Evaluator<typename Derived::RhsDerived>;
+    using Aux = eval_aux_t<get_expr_tag_t<Derived>,
+                           typename LhsEval::EvalType,
+                           typename RhsEval::EvalType>;
 
     WAVE_STRONG_INLINE explicit Evaluator(const Derived &expr)
         : expr{expr},
           lhs_eval{expr.lhs()},
           rhs_eval{expr.rhs()},
-          result{
-            evalImpl(get_expr_tag_t<Derived>(), this->lhs_eval(), this->rhs_eval())} {}
+          node{evalNode<EvalType, Aux>(
+            get_expr_tag_t<Derived>(), this->lhs_eval(), this->rhs_eval())} {}
 
-    const EvalType &operator()() const {
-        return this->result;
+    const EvalType &operator()() const & {
+        return this->node.value;
+    }
+
+    /** Moves the result out of an expiring Evaluator */
+    EvalType &&operator()() && {
+        return std::move(this->node.value);
+    }
+
+    /** The intermediates kept by evalWithAuxImpl(), if Aux is not void */
+    template <typename A = Aux>
+    const A &aux() const {
+        return this->node.aux;
     }
 
  public:
     const wave_ref_sel_t<Derived> expr;
     const LhsEval lhs_eval;
     const RhsEval rhs_eval;
-    const EvalType result;
+    EvalWithAux<EvalType, Aux> node;
 };
 
+/** The local jacobian of a unary node w.r.t. its operand
+ *
+ * This calls jacobianImpl(), passing the node's aux if it was evaluated with one.
+ */
+template <typename Derived,
+          TICK_REQUIRES(std::is_void<typename Evaluator<Derived>::Aux>{})>
+WAVE_STRONG_INLINE auto localJacobian(const Evaluator<Derived> &evaluator)
+  -> decltype(
+    jacobianImpl(get_expr_tag_t<Derived>{}, evaluator(), evaluator.rhs_eval())) {
+    return jacobianImpl(get_expr_tag_t<Derived>{}, evaluator(), evaluator.rhs_eval());
+}
+
+template <typename Derived,
+          TICK_REQUIRES(!std::is_void<typename Evaluator<Derived>::Aux>{})>
+WAVE_STRONG_INLINE auto localJacobian(const Evaluator<Derived> &evaluator)
+  -> decltype(jacobianImpl(
+    get_expr_tag_t<Derived>{}, evaluator(), evaluator.aux(), evaluator.rhs_eval())) {
+    return jacobianImpl(
+      get_expr_tag_t<Derived>{}, evaluator(), evaluator.aux(), evaluator.rhs_eval());
+}
+
+/** The local jacobian of a binary node w.r.t. its lhs
+ *
+ * This calls leftJacobianImpl(), passing the node's aux if it was evaluated with one.
+ */
+template <typename Derived,
+          TICK_REQUIRES(std::is_void<typename Evaluator<Derived>::Aux>{})>
+WAVE_STRONG_INLINE auto localLeftJacobian(const Evaluator<Derived> &evaluator)
+  -> decltype(leftJacobianImpl(get_expr_tag_t<Derived>{},
+                               evaluator(),
+                               evaluator.lhs_eval(),
+                               evaluator.rhs_eval())) {
+    return leftJacobianImpl(get_expr_tag_t<Derived>{},
+                            evaluator(),
+                            evaluator.lhs_eval(),
+                            evaluator.rhs_eval());
+}
+
+template <typename Derived,
+          TICK_REQUIRES(!std::is_void<typename Evaluator<Derived>::Aux>{})>
+WAVE_STRONG_INLINE auto localLeftJacobian(const Evaluator<Derived> &evaluator)
+  -> decltype(leftJacobianImpl(get_expr_tag_t<Derived>{},
+                               evaluator(),
+                               evaluator.aux(),
+                               evaluator.lhs_eval(),
+                               evaluator.rhs_eval())) {
+    return leftJacobianImpl(get_expr_tag_t<Derived>{},
+                            evaluator(),
+                            evaluator.aux(),
+                            evaluator.lhs_eval(),
+                            evaluator.rhs_eval());
+}
+
+/** The local jacobian of a binary node w.r.t. its rhs
+ *
+ * This calls rightJacobianImpl(), passing the node's aux if it was evaluated with one.
+ */
+template <typename Derived,
+          TICK_REQUIRES(std::is_void<typename Evaluator<Derived>::Aux>{})>
+WAVE_STRONG_INLINE auto localRightJacobian(const Evaluator<Derived> &evaluator)
+  -> decltype(rightJacobianImpl(get_expr_tag_t<Derived>{},
+                                evaluator(),
+                                evaluator.lhs_eval(),
+                                evaluator.rhs_eval())) {
+    return rightJacobianImpl(get_expr_tag_t<Derived>{},
+                             evaluator(),
+                             evaluator.lhs_eval(),
+                             evaluator.rhs_eval());
+}
+
+template <typename Derived,
+          TICK_REQUIRES(!std::is_void<typename Evaluator<Derived>::Aux>{})>
+WAVE_STRONG_INLINE auto localRightJacobian(const Evaluator<Derived> &evaluator)
+  -> decltype(rightJacobianImpl(get_expr_tag_t<Derived>{},
+                                evaluator(),
+                                evaluator.aux(),
+                                evaluator.lhs_eval(),
+                                evaluator.rhs_eval())) {
+    return rightJacobianImpl(get_expr_tag_t<Derived>{},
+                             evaluator(),
+                             evaluator.aux(),
+                             evaluator.lhs_eval(),
+                             evaluator.rhs_eval());
+}
+
+/** The type of the local jacobian of a unary node */
+template <typename Derived>
+using unary_local_jacobian_t =
+  decltype(localJacobian(std::declval<const Evaluator<Derived> &>()));
+
+/** The type of the local jacobian of a binary node w.r.t. its lhs */
+template <typename Derived>
+using left_local_jacobian_t =
+  decltype(localLeftJacobian(std::declval<const Evaluator<Derived> &>()));
+
+/** The type of the local jacobian of a binary node w.r.t. its rhs */
+template <typename Derived>
+using right_local_jacobian_t =
+  decltype(localRightJacobian(std::declval<const Evaluator<Derived> &>()));
+
 }  // namespace internal
 }  // namespace wave
 
@@ -39,6 +39,8 @@ inline constexpr bool isSameType(const ExpressionBase<A> &,
 
 
 /** Determines whether `a` contains an expression of the type of `b`.
+ *
+ * A Constant leaf is never counted, so no jacobian is found through it.
  *
  * @warning experimental
  */
@@ -46,7 +48,8 @@ template <typename A, typename B, typename Enable = void>
 struct contains_same_type;
 
 template <typename A, typename B>
-struct contains_same_type<A, B, enable_if_leaf_t<A>> : std::is_same<A, B> {};
+struct contains_same_type<A, B, enable_if_leaf_t<A>>
+  : tmp::bool_constant<std::is_same<A, B>{} && !is_constant_leaf<A>{}> {};
 
 template <typename A, typename B>
 struct contains_same_type<A, B, enable_if_unary_t<A>>
@@ -0,0 +1,327 @@
+/**
+ * @file
+ *
+ * Forward-mode jacobians as products of local jacobians, multiplied in the order with
+ * the fewest flops
+ */
+
+#ifndef WAVE_GEOMETRY_JACOBIANCHAIN_HPP
+#define WAVE_GEOMETRY_JACOBIANCHAIN_HPP
+
+namespace wave {
+namespace internal {
+
+/** Aliases true_type if T is an IdentityMatrix, which need not be multiplied */
+template <typename T>
+struct is_identity_matrix : std::false_type {};
+
+template <typename Scalar, int N>
+struct is_identity_matrix<IdentityMatrix<Scalar, N>> : std::true_type {};
+
+/** Gives element I of an index_sequence */
+template <typename Dims, int I>
+struct dim_at;
+
+template <int D, int... Ds>
+struct dim_at<tmp::index_sequence<D, Ds...>, 0> : std::integral_constant<int, D> {};
+
+template <int D, int... Ds, int I>
+struct dim_at<tmp::index_sequence<D, Ds...>, I>
+  : dim_at<tmp::index_sequence<Ds...>, I - 1> {};
+
+/** The cheapest order to multiply a chain of matrices, found by dynamic programming
+ *
+ * Matrix k of the chain has size (dk x dk+1), where Dims is
+ * `index_sequence<d0, ..., dn>`. This gives the product of matrices I to J - 1 with the
+ * fewest scalar multiplications, as `cost`, and the index `split` at which it is divided
+ * into (I..split-1) * (split..J-1). The compiler memoizes each instantiation, so finding
+ * the order takes O(n^3) steps.
+ *
+ * Of equal costs, the lowest split is chosen, multiplying from right to left.
+ */
+template <typename Dims, int I, int J, typename Enable = void>
+struct chain_order;
+
+/** The cost of splitting the product of matrices I to J - 1 at K */
+template <typename Dims, int I, int J, int K>
+struct chain_split {
+    static constexpr int split = K;
+    static constexpr int cost = chain_order<Dims, I, K>::cost +
+                                chain_order<Dims, K, J>::cost +
+                                dim_at<Dims, I>::value * dim_at<Dims, K>::value *
+                                  dim_at<Dims, J>::value;
+};
+
+/** The cheapest chain_split of matrices I to J - 1 at K or later */
+template <typename Dims, int I, int J, int K, typename Enable = void>
+struct best_chain_split
+  : tmp::conditional_t<(chain_split<Dims, I, J, K>::cost <=
+                        best_chain_split<Dims, I, J, K + 1>::cost),
+                       chain_split<Dims, I, J, K>,
+                       best_chain_split<Dims, I, J, K + 1>> {};
+
+template <typename Dims, int I, int J, int K>
+struct best_chain_split<Dims, I, J, K, tmp::enable_if_t<K == J - 1>>
+  : chain_split<Dims, I, J, K> {};
+
+// A single matrix is not multiplied
+template <typename Dims, int I, int J>
+struct chain_order<Dims, I, J, tmp::enable_if_t<J == I + 1>> {
+    static constexpr int cost = 0;
+};
+
+template <typename Dims, int I, int J>
+struct chain_order<Dims, I, J, tmp::enable_if_t<(J > I + 1)>>
+  : best_chain_split<Dims, I, J, I + 1> {};
+
+/** Holds the local jacobians on the path from the root of an expression tree to a target
+ *
+ * If the target's type appears once in the tree, the jacobian of the root w.r.t. the
+ * target is the product of the jacobian of each node on the path w.r.t. the next, from
+ * the root down. Like TypedJacobianEvaluator, each node on the path stores its local
+ * jacobian, but they are not multiplied yet. Identity factors are left out.
+ *
+ * - Dims: an index_sequence `<d0, ..., dn>` of the factors' sizes, as for chain_order
+ * - Local, local: the type and value of the first factor
+ * - Rest, rest: the path holding the remaining factors
+ *
+ * Use path_factor to get factor I, counting from the root.
+ */
+template <typename Derived, typename Target, typename Enable = void>
+struct JacobianPath;
+
+template <typename Target>
+struct JacobianPath<Target, Target> {
+    using Dims = tmp::index_sequence<eval_traits<Target>::TangentSize>;
+
+    WAVE_STRONG_INLINE explicit JacobianPath(const Evaluator<Target> &) {}
+};
+
+/** A step down the path, from Derived to its operand Child, with the given type of local
+ * jacobian. The local jacobian is stored unless it is an identity.
+ */
+template <typename Derived,
+          typename Child,
+          typename Target,
+          typename LocalJacobian,
+          bool IsIdentity = is_identity_matrix<tmp::remove_cr_t<LocalJacobian>>{}>
+struct JacobianPathStep {
+    using Rest = JacobianPath<Child, Target>;
+    using Local = ref_sel_t<LocalJacobian>;
+    using Dims = typename tmp::concat_index_sequence<
+      tmp::index_sequence<eval_traits<Derived>::TangentSize>,
+      typename Rest::Dims>::type;
+
+    WAVE_STRONG_INLINE JacobianPathStep(LocalJacobian &&local,
+                                        const Evaluator<Child> &child)
+        : rest{child}, local{std::forward<LocalJacobian>(local)} {}
+
+    // Nested path and results cache
+    const Rest rest;
+    Local local;
+};
+
+/** Gets factor I of a JacobianPath, counting from the root */
+template <typename Path, int I>
+struct path_factor {
+    using Next = path_factor<typename Path::Rest, I - 1>;
+
+    static const typename Next::type &get(const Path &path) {
+        return Next::get(path.rest);
+    }
+    using type = typename Next::type;
+};
+
+template <typename Path>
+struct path_factor<Path, 0> {
+    using type = typename Path::Local;
+
+    static const type &get(const Path &path) {
+        return path.local;
+    }
+};
+
+template <typename Derived, typename Child, typename Target, typename LocalJacobian>
+struct JacobianPathStep<Derived, Child, Target, LocalJacobian, true>
+  : JacobianPath<Child, Target> {
+    WAVE_STRONG_INLINE JacobianPathStep(LocalJacobian &&, const Evaluator<Child> &child)
+        : JacobianPath<Child, Target>{child} {}
+};
+
+template <typename Derived, typename Target>
+struct JacobianPath<
+  Derived,
+  Target,
+  tmp::enable_if_t<is_unary_expression<Derived>{} && !std::is_same<Derived, Target>{}>>
+  : JacobianPathStep<Derived,
+                     typename Derived::RhsDerived,
+                     Target,
+                     unary_local_jacobian_t<Derived>> {
+    WAVE_STRONG_INLINE explicit JacobianPath(const Evaluator<Derived> &evaluator)
+        : JacobianPath::JacobianPathStep{localJacobian(evaluator), evaluator.rhs_eval} {}
+};
+
+/** The path continues into the lhs, which contains the only leaf of the target's type
+ */
+template <typename Derived, typename Target>
+struct JacobianPath<
+  Derived,
+  Target,
+  tmp::enable_if_t<is_binary_expression<Derived>{} &&
+                   contains_same_type<typename Derived::LhsDerived, Target>{}>>
+  : JacobianPathStep<Derived,
+                     typename Derived::LhsDerived,
+                     Target,
+                     left_local_jacobian_t<Derived>> {
+    static_assert(!contains_same_type<typename Derived::RhsDerived, Target>{},
+                  "The target's type must appear once in the expression");
+
+    WAVE_STRONG_INLINE explicit JacobianPath(const Evaluator<Derived> &evaluator)
+        : JacobianPath::JacobianPathStep{localLeftJacobian(evaluator),
+                                         evaluator.lhs_eval} {}
+};
+
+template <typename Derived, typename Target>
+struct JacobianPath<
+  Derived,
+  Target,
+  tmp::enable_if_t<is_binary_expression<Derived>{} &&
+                   !contains_same_type<typename Derived::LhsDerived, Target>{}>>
+  : JacobianPathStep<Derived,
+                     typename Derived::RhsDerived,
+                     Target,
+                     right_local_jacobian_t<Derived>> {
+    WAVE_STRONG_INLINE explicit JacobianPath(const Evaluator<Derived> &evaluator)
+        : JacobianPath::JacobianPathStep{localRightJacobian(evaluator),
+                                         evaluator.rhs_eval} {}
+};
+
+/** Aliases the estimated cost of multiplying the factors of a JacobianPath */
+template <typename Dims>
+struct chain_product_cost : std::integral_constant<int, 0> {};
+
+template <int D0, int D1, int... Ds>
+struct chain_product_cost<tmp::index_sequence<D0, D1, Ds...>>
+  : std::integral_constant<
+      int,
+      chain_order<tmp::index_sequence<D0, D1, Ds...>, 0, sizeof...(Ds) + 1>::cost> {};
+
+/** Aliases the cost of multiplying a chain from right to left, as TypedJacobianEvaluator
+ * does */
+template <typename Dims>
+struct right_to_left_chain_cost : std::integral_constant<int, 0> {};
+
+template <int D0, int D1, int D2, int... Ds>
+struct right_to_left_chain_cost<tmp::index_sequence<D0, D1, D2, Ds...>>
+  : std::integral_constant<
+      int,
+      D0 * D1 * dim_at<tmp::index_sequence<D2, Ds...>, sizeof...(Ds)>::value +
+        right_to_left_chain_cost<tmp::index_sequence<D1, D2, Ds...>>::value> {};
+
+/** Aliases true_type if the chain is cheaper to multiply in an order other than right to
+ * left */
+template <typename Dims>
+struct is_chain_reordered
+  : tmp::bool_constant<(chain_product_cost<Dims>::value <
+                        right_to_left_chain_cost<Dims>::value)> {};
+
+/** Multiplies factors I to J - 1 of a JacobianPath, in the order given by chain_order
+ */
+template <typename Scalar, typename Dims, int I, int J, typename Enable = void>
+struct ChainProduct {
+    using Result =
+      Eigen::Matrix<Scalar, dim_at<Dims, I>::value, dim_at<Dims, J>::value>;
+
+    template <typename Path>
+    static Result run(const Path &path) {
+        constexpr int K = chain_order<Dims, I, J>::split;
+        return ChainProduct<Scalar, Dims, I, K>::run(path) *
+               ChainProduct<Scalar, Dims, K, J>::run(path);
+    }
+};
+
+template <typename Scalar, typename Dims, int I, int J>
+struct ChainProduct<Scalar, Dims, I, J, tmp::enable_if_t<J == I + 1>> {
+    template <typename Path>
+    static const typename path_factor<Path, I>::type &run(const Path &path) {
+        return path_factor<Path, I>::get(path);
+    }
+};
+
+template <typename Jacobian, typename Scalar, int D, typename Path>
+Jacobian multiplyJacobianPath(tmp::index_sequence<D>, const Path &) {
+    return Jacobian::Identity();
+}
+
+template <typename Jacobian, typename Scalar, int... Ds, typename Path>
+Jacobian multiplyJacobianPath(tmp::index_sequence<Ds...>, const Path &path) {
+    using Dims = tmp::index_sequence<Ds...>;
+    return ChainProduct<Scalar, Dims, 0, sizeof...(Ds) - 1>::run(path);
+}
+
+template <typename Derived, typename Target>
+auto evaluateChainJacobianImpl(std::true_type,
+                               const Evaluator<Derived> &v_eval,
+                               const Target &) -> jacobian_t<Derived, Target> {
+    using Path = JacobianPath<Derived, Target>;
+    return multiplyJacobianPath<jacobian_t<Derived, Target>, scalar_t<Derived>>(
+      typename Path::Dims{}, Path{v_eval});
+}
+
+template <typename Derived, typename Target>
+auto evaluateChainJacobianImpl(std::false_type,
+                               const Evaluator<Derived> &v_eval,
+                               const Target &target) -> jacobian_t<Derived, Target> {
+    return TypedJacobianEvaluator<Derived, Target>{v_eval, target}.jacobian();
+}
+
+/** Evaluate the jacobian of a prepared expression w.r.t. a target, as the product of the
+ * local jacobians on the path to it, multiplied in the cheapest order
+ *
+ * Unlike TypedJacobianEvaluator, which multiplies from the target up, the order depends
+ * on the sizes of the factors. For example, the jacobian of `T1 * (T2 * (T3 * p))` w.r.t.
+ * T3 is two (3 x 3) factors times a (3 x 6) factor, which are cheaper to multiply from
+ * the left.
+ *
+ * If right to left is as cheap as any order, TypedJacobianEvaluator is used instead.
+ * It does the same work while keeping lazy products.
+ *
+ * The target's type must appear once in the expression.
+ */
+template <typename Derived,
+          typename Target,
+          tmp::enable_if_t<contains_same_type<Derived, Target>{}, int> = 0>
+auto evaluateChainJacobianImpl(const Evaluator<Derived> &v_eval, const Target &target)
+  -> jacobian_t<Derived, Target> {
+    using Path = JacobianPath<Derived, Target>;
+    return evaluateChainJacobianImpl(
+      is_chain_reordered<typename Path::Dims>{}, v_eval, target);
+}
+
+template <typename Derived,
+          typename Target,
+          tmp::enable_if_t<!contains_same_type<Derived, Target>{}, int> = 0>
+auto evaluateChainJacobianImpl(const Evaluator<Derived> &, const Target &)
+  -> zero_t<Derived, Target> {
+    return zero_t<Derived, Target>{};
+}
+
+/** Evaluate the result of an expression tree and any number of jacobians, each as an
+ * optimally ordered product of local jacobians
+ *
+ * Each leaf type must appear once in the expression.
+ */
+template <typename Derived, typename... Targets>
+auto evaluateWithChainJacobians(const ExpressionBase<Derived> &expr,
+                                const ExpressionBase<Targets> &... targets)
+  -> std::tuple<plain_output_t<Derived>, jacobian_t<Derived, Targets>...> {
+    using OutputType = plain_output_t<Derived>;
+    const auto &v_eval = prepareEvaluatorTo<OutputType>(expr.derived());
+    return std::tuple<OutputType, jacobian_t<Derived, Targets>...>{
+      prepareOutput(v_eval), evaluateChainJacobianImpl(v_eval, targets.derived())...};
+}
+
+}  // namespace internal
+}  // namespace wave
+
+#endif  // WAVE_GEOMETRY_JACOBIANCHAIN_HPP
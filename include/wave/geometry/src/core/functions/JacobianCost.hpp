@@ -0,0 +1,234 @@
+/**
+ * @file
+ *
+ * Static estimates of the cost of finding jacobians in forward and reverse mode, and the
+ * choice between them
+ */
+
+#ifndef WAVE_GEOMETRY_JACOBIANCOST_HPP
+#define WAVE_GEOMETRY_JACOBIANCOST_HPP
+
+namespace wave {
+namespace internal {
+
+/** Estimated cost of a node's own jacobian with respect to one operand
+ *
+ * No jacobians are tabulated; the cost of evaluating the node, from eval_cost, stands in
+ * for them. Only the cost relative to the products below matters.
+ */
+template <typename Derived, typename Enable = void>
+struct self_jacobian_cost;
+
+template <typename Derived>
+struct self_jacobian_cost<Derived, enable_if_unary_t<Derived>>
+  : eval_cost<get_expr_tag_t<Derived>,
+              clean_eval_t<typename traits<Derived>::RhsDerived>> {};
+
+template <typename Derived>
+struct self_jacobian_cost<Derived, enable_if_binary_t<Derived>>
+  : eval_cost<get_expr_tag_t<Derived>,
+              clean_eval_t<typename traits<Derived>::LhsDerived>,
+              clean_eval_t<typename traits<Derived>::RhsDerived>> {};
+
+/** Cost of a product of (Rows x Inner) and (Inner x Cols) matrices */
+constexpr int matrixProductCost(int rows, int inner, int cols) {
+    return rows * inner * cols;
+}
+
+/** Sum of the given costs */
+constexpr int sumOfCosts() {
+    return 0;
+}
+
+template <typename... Costs>
+constexpr int sumOfCosts(int first, Costs... rest) {
+    return first + sumOfCosts(rest...);
+}
+
+/** Estimated cost of the local jacobians on the JacobianPath from Derived to Target */
+template <typename Derived, typename Target, typename Enable = void>
+struct path_self_jacobian_cost : std::integral_constant<int, 0> {};
+
+template <typename Derived, typename Target>
+struct path_self_jacobian_cost<
+  Derived,
+  Target,
+  tmp::enable_if_t<is_unary_expression<Derived>{} &&
+                   contains_same_type<Derived, Target>{}>>
+  : std::integral_constant<
+      int,
+      self_jacobian_cost<Derived>::value +
+        path_self_jacobian_cost<typename Derived::RhsDerived, Target>::value> {};
+
+template <typename Derived, typename Target>
+struct path_self_jacobian_cost<
+  Derived,
+  Target,
+  tmp::enable_if_t<is_binary_expression<Derived>{} &&
+                   contains_same_type<Derived, Target>{}>>
+  : std::integral_constant<
+      int,
+      self_jacobian_cost<Derived>::value +
+        path_self_jacobian_cost<typename Derived::LhsDerived, Target>::value +
+        path_self_jacobian_cost<typename Derived::RhsDerived, Target>::value> {};
+
+/** Estimated cost of the jacobian of Derived w.r.t. Target, by evaluateWithChainJacobians
+ *
+ * Each node on the path to the target finds its own jacobian, then these are multiplied
+ * in the order given by chain_order. Nothing is done for a target not in Derived.
+ */
+template <typename Derived, typename Target, typename Enable = void>
+struct forward_jacobian_cost : std::integral_constant<int, 0> {};
+
+template <typename Derived, typename Target>
+struct forward_jacobian_cost<Derived,
+                             Target,
+                             tmp::enable_if_t<contains_same_type<Derived, Target>{}>>
+  : std::integral_constant<
+      int,
+      path_self_jacobian_cost<Derived, Target>::value +
+        chain_product_cost<typename JacobianPath<Derived, Target>::Dims>::value> {};
+
+/** Estimated cost of the backward sweep of AdjointJacobianEvaluator below Derived
+ *
+ * Each node which may contain a target finds its own jacobian w.r.t. each such operand,
+ * and multiplies it by its (Rows x Tangent) adjoint. The product is free at the root,
+ * whose adjoint is an identity. Leaves add their adjoint to each target's jacobian.
+ *
+ * @tparam Rows the tangent size of the output
+ * @tparam IsRoot whether the adjoint of Derived is an identity
+ */
+template <typename Derived,
+          int Rows,
+          typename TargetList,
+          bool IsRoot = false,
+          typename Enable = void>
+struct reverse_jacobian_cost
+  : std::integral_constant<int,
+                           contains_any_target<Derived, TargetList>{}
+                             ? Rows * eval_traits<Derived>::TangentSize
+                             : 0> {};
+
+/** Cost of passing the adjoint of Derived to its operand Child, if Child may contain a
+ * target */
+template <typename Derived, typename Child, int Rows, typename TargetList, bool IsRoot>
+struct reverse_edge_cost
+  : std::integral_constant<
+      int,
+      contains_any_target<Child, TargetList>{}
+        ? self_jacobian_cost<Derived>::value +
+            (IsRoot ? 0
+                    : matrixProductCost(Rows,
+                                        eval_traits<Derived>::TangentSize,
+                                        eval_traits<Child>::TangentSize)) +
+            reverse_jacobian_cost<Child, Rows, TargetList>::value
+        : 0> {};
+
+template <typename Derived, int Rows, typename TargetList, bool IsRoot>
+struct reverse_jacobian_cost<Derived,
+                             Rows,
+                             TargetList,
+                             IsRoot,
+                             enable_if_unary_t<Derived>>
+  : reverse_edge_cost<Derived, typename Derived::RhsDerived, Rows, TargetList, IsRoot> {
+};
+
+template <typename Derived, int Rows, typename TargetList, bool IsRoot>
+struct reverse_jacobian_cost<Derived,
+                             Rows,
+                             TargetList,
+                             IsRoot,
+                             enable_if_binary_t<Derived>>
+  : std::integral_constant<
+      int,
+      reverse_edge_cost<Derived, typename Derived::LhsDerived, Rows, TargetList, IsRoot>::
+          value +
+        reverse_edge_cost<Derived,
+                          typename Derived::RhsDerived,
+                          Rows,
+                          TargetList,
+                          IsRoot>::value> {};
+
+/** Aliases true_type if the jacobians of Derived w.r.t. Targets are estimated to be
+ * cheaper to find in one backward sweep than by one forward pass per target.
+ *
+ * Forward mode repeats the work on the path to each target, though it multiplies the
+ * jacobians on each path in the cheapest order. Reverse mode visits each node once,
+ * carrying adjoints as tall as the output's tangent. So reverse mode is preferred for
+ * many targets and small outputs, e.g. a residual of a long chain of poses, and forward
+ * mode for one target with a large output. Ties go to forward mode.
+ *
+ * @tparam Derived a prepared expression, as evaluated
+ */
+template <typename Derived, typename... Targets>
+struct prefer_reverse_jacobians
+  : tmp::bool_constant<(
+      reverse_jacobian_cost<Derived,
+                            eval_traits<Derived>::TangentSize,
+                            tmp::type_list<Targets...>,
+                            true>::value <
+      sumOfCosts(forward_jacobian_cost<Derived, Targets>::value...))> {};
+
+/** Aliases true_type if the jacobians of an expression w.r.t. the targets should be
+ * found in reverse mode, by AdjointJacobianEvaluator.
+ *
+ * Forward mode, by evaluateWithChainJacobians, needs a tree with unique types. For such
+ * a tree, the mode with the lower estimated cost is used; see prefer_reverse_jacobians.
+ */
+template <typename Derived, typename... Targets>
+struct use_reverse_jacobians
+  : tmp::disjunction<tmp::bool_constant<!unique_leaves_t<Derived>{}>,
+                     prefer_reverse_jacobians<prepared_t<Derived>, Targets...>> {};
+
+/** Evaluate one Jacobian of an expression.
+ *
+ * Either forward-mode evaluateWithChainJacobians or reverse-mode AdjointJacobianEvaluator
+ * is used, as chosen by use_reverse_jacobians.
+ *
+ * @note this also calculates the value and discards it
+ */
+template <typename Derived,
+          typename TargetDerived,
+          tmp::enable_if_t<!use_reverse_jacobians<Derived, TargetDerived>{}, int> = 0>
+auto evaluateJacobianAuto(const ExpressionBase<Derived> &expr,
+                          const ExpressionBase<TargetDerived> &target)
+  -> jacobian_t<Derived, TargetDerived> {
+    return std::get<1>(evaluateWithChainJacobians(expr.derived(), target.derived()));
+}
+
+template <typename Derived,
+          typename TargetDerived,
+          tmp::enable_if_t<use_reverse_jacobians<Derived, TargetDerived>{}, int> = 0>
+auto evaluateJacobianAuto(const ExpressionBase<Derived> &expr,
+                          const ExpressionBase<TargetDerived> &target)
+  -> jacobian_t<Derived, TargetDerived> {
+    return std::get<1>(evaluateWithAdjointJacobians(expr.derived(), target.derived()));
+}
+
+/** Evaluate the result of an expression tree and any number of jacobians
+ *
+ * Either evaluateWithChainJacobians or AdjointJacobianEvaluator is used, as chosen by
+ * use_reverse_jacobians.
+ */
+template <typename Derived,
+          typename... Targets,
+          tmp::enable_if_t<!use_reverse_jacobians<Derived, Targets...>{}, int> = 0>
+auto evaluateWithJacobiansAuto(const ExpressionBase<Derived> &expr,
+                               const ExpressionBase<Targets> &... targets)
+  -> std::tuple<plain_output_t<Derived>, jacobian_t<Derived, Targets>...> {
+    return evaluateWithChainJacobians(expr.derived(), targets.derived()...);
+}
+
+template <typename Derived,
+          typename... Targets,
+          tmp::enable_if_t<use_reverse_jacobians<Derived, Targets...>{}, int> = 0>
+auto evaluateWithJacobiansAuto(const ExpressionBase<Derived> &expr,
+                               const ExpressionBase<Targets> &... targets)
+  -> std::tuple<plain_output_t<Derived>, jacobian_t<Derived, Targets>...> {
+    return evaluateWithAdjointJacobians(expr.derived(), targets.derived()...);
+}
+
+}  // namespace internal
+}  // namespace wave
+
+#endif  // WAVE_GEOMETRY_JACOBIANCOST_HPP
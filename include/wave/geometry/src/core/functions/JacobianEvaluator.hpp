@@ -24,11 +24,13 @@ struct JacobianEvaluator<Derived, Derived, enable_if_leaf_t<Derived>> {
 
     WAVE_STRONG_INLINE JacobianEvaluator(const Evaluator<Derived> &evaluator,
                                          const Derived &target)
-        : evaluator{evaluator}, is_same{isSame(evaluator.expr, target)} {}
+        : evaluator{evaluator},
+          is_same{contains_same_type<Derived, Derived>{} &&
+                  isSame(evaluator.expr, target)} {}
 
     /** Find (trivial) jacobian of the leaf expression
      *
-     * @returns identity if types match, zero otherwise
+     * @returns identity if types match, zero otherwise (or for a Constant)
      */
 
     WAVE_STRONG_INLINE boost::optional<identity_t<Derived>> jacobian() const {
@@ -52,6 +54,9 @@ struct JacobianEvaluator<Derived, Derived, enable_if_leaf_t<Derived>> {
 /** Specialization for leaf expression of different type */
 template <typename Derived, typename Target>
 struct JacobianEvaluator<Derived, Target, enable_if_leaf_t<Derived>> {
+    static_assert(!is_shared<Derived>{},
+                  "Shared subexpressions are only supported by AdjointJacobianEvaluator");
+
     WAVE_STRONG_INLINE JacobianEvaluator(const Evaluator<Derived> &, const Target &) {}
 
     /** Finds (trivial) jacobian of the leaf expression
@@ -84,10 +89,7 @@ struct JacobianEvaluator<Derived, Target, enable_if_unary_t<Derived>> {
     WAVE_STRONG_INLINE boost::optional<Jacobian> jacobian() const {
         const auto &rhs_jac = this->rhs_eval.jacobian();
         if (rhs_jac) {
-            return Jacobian{jacobianImpl(get_expr_tag_t<Derived>{},
-                                         this->evaluator(),
-                                         this->evaluator.rhs_eval()) *
-                            (*rhs_jac)};
+            return Jacobian{localJacobian(this->evaluator) * (*rhs_jac)};
         } else {
             return boost::none;
         }
@@ -123,28 +125,12 @@ struct JacobianEvaluator<
         const auto &lhs_jac = this->lhs_eval.jacobian();
         const auto &rhs_jac = this->rhs_eval.jacobian();
         if (lhs_jac && rhs_jac) {
-            return Jacobian{leftJacobianImpl(get_expr_tag_t<Derived>{},
-                                             this->evaluator(),
-                                             this->evaluator.lhs_eval(),
-                                             this->evaluator.rhs_eval()) *
-                              (*lhs_jac) +
-                            rightJacobianImpl(get_expr_tag_t<Derived>{},
-                                              this->evaluator(),
-                                              this->evaluator.lhs_eval(),
-                                              this->evaluator.rhs_eval()) *
-                              (*rhs_jac)};
+            return Jacobian{localLeftJacobian(this->evaluator) * (*lhs_jac) +
+                            localRightJacobian(this->evaluator) * (*rhs_jac)};
         } else if (lhs_jac) {
-            return Jacobian{leftJacobianImpl(get_expr_tag_t<Derived>{},
-                                             this->evaluator(),
-                                             this->evaluator.lhs_eval(),
-                                             this->evaluator.rhs_eval()) *
-                            (*lhs_jac)};
+            return Jacobian{localLeftJacobian(this->evaluator) * (*lhs_jac)};
         } else if (rhs_jac) {
-            return Jacobian{rightJacobianImpl(get_expr_tag_t<Derived>{},
-                                              this->evaluator(),
-                                              this->evaluator.lhs_eval(),
-                                              this->evaluator.rhs_eval()) *
-                            (*rhs_jac)};
+            return Jacobian{localRightJacobian(this->evaluator) * (*rhs_jac)};
         } else {
             return boost::none;
         }
@@ -176,11 +162,7 @@ struct JacobianEvaluator<
     WAVE_STRONG_INLINE boost::optional<Jacobian> jacobian() const {
         const auto &lhs_jac = this->lhs_eval.jacobian();
         if (lhs_jac) {
-            return Jacobian{leftJacobianImpl(get_expr_tag_t<Derived>{},
-                                             this->evaluator(),
-                                             this->evaluator.lhs_eval(),
-                                             this->evaluator.rhs_eval()) *
-                            (*lhs_jac)};
+            return Jacobian{localLeftJacobian(this->evaluator) * (*lhs_jac)};
         } else {
             return boost::none;
         }
@@ -212,17 +194,32 @@ struct JacobianEvaluator<
     WAVE_STRONG_INLINE boost::optional<Jacobian> jacobian() const {
         const auto &rhs_jac = this->rhs_eval.jacobian();
         if (rhs_jac) {
-            return Jacobian{rightJacobianImpl(get_expr_tag_t<Derived>{},
-                                              this->evaluator(),
-                                              this->evaluator.lhs_eval(),
-                                              this->evaluator.rhs_eval()) *
-                            (*rhs_jac)};
+            return Jacobian{localRightJacobian(this->evaluator) * (*rhs_jac)};
         } else {
             return boost::none;
         }
     }
 };
 
+/** Specialization for binary expression where neither side contains target, e.g. when
+ * the target is a Constant */
+template <typename Derived, typename Target>
+struct JacobianEvaluator<
+  Derived,
+  Target,
+  tmp::enable_if_t<is_binary_expression<Derived>{} &&
+                   !contains_same_type<typename Derived::LhsDerived, Target>::value &&
+                   !contains_same_type<typename Derived::RhsDerived, Target>::value>> {
+    using Jacobian = jacobian_t<Derived, Target>;
+
+    WAVE_STRONG_INLINE JacobianEvaluator(const Evaluator<Derived> &, const Target &) {}
+
+    /** @returns none ("zero") since the target is not in the expression */
+    WAVE_STRONG_INLINE boost::optional<Jacobian> jacobian() const {
+        return boost::none;
+    }
+};
+
 /** Evaluate a jacobian using an existing Evaluator tree
  */
 template <typename Derived, typename Target>
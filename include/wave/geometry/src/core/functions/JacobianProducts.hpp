@@ -0,0 +1,189 @@
+/**
+ * @file
+ *
+ * Products of the jacobians of an expression with given vectors, found without forming
+ * the jacobians themselves
+ */
+
+#ifndef WAVE_GEOMETRY_JACOBIANPRODUCTS_HPP
+#define WAVE_GEOMETRY_JACOBIANPRODUCTS_HPP
+
+namespace wave {
+namespace internal {
+
+template <typename Derived, typename Adjoint, typename = void>
+struct eval_with_vjp_impl {
+    using type = NotAllowed;
+};
+
+template <typename Derived, typename Adjoint>
+struct eval_with_vjp_impl<Derived,
+                          Adjoint,
+                          tmp::enable_if_t<unique_leaves_t<Derived>{}>> {
+    using type = tmp::apply_t<
+      std::tuple,
+      plain_output_t<Derived>,
+      tmp::apply_each_t<reverse_adjoint_t,
+                        Adjoint,
+                        typename unique_leaves_t<Derived>::type>>;
+};
+
+/** The return type of evaluateWithVectorJacobianProducts(): the value of Derived, then
+ * one (K x N) product for each leaf with tangent size N, where Adjoint is (K x M).
+ *
+ * @warning this alias gives NotAllowed if unique_leaves_t<Derived>::value is false.
+ */
+template <typename Derived, typename Adjoint>
+using eval_with_vjp_t = typename eval_with_vjp_impl<Derived, Adjoint>::type;
+
+/** Evaluate the result of an expression tree, and the product of an adjoint with its
+ * jacobian w.r.t. each leaf
+ *
+ * The backward sweep is seeded with `adjoint` instead of an identity, so each product
+ * is found as (K x N) without forming the (M x N) jacobian. For a row vector adjoint,
+ * e.g. a residual r transposed, the products are the gradients r^T J.
+ *
+ * @param adjoint a (K x M) matrix, where M is the tangent size of the expression
+ * @return a tuple of the value of the expression and the products, in the order of the
+ * jacobians from evaluateWithReverseJacobians()
+ */
+template <typename Derived,
+          typename AdjointDerived,
+          TICK_REQUIRES(unique_leaves_t<Derived>{})>
+auto evaluateWithVectorJacobianProducts(const ExpressionBase<Derived> &expr,
+                                        const Eigen::MatrixBase<AdjointDerived> &adjoint)
+  -> eval_with_vjp_t<Derived, typename AdjointDerived::PlainObject> {
+    using Adjoint = typename AdjointDerived::PlainObject;
+    static_assert(Adjoint::ColsAtCompileTime == eval_traits<Derived>::TangentSize,
+                  "The adjoint must have one column per element of the tangent");
+
+    // Make the Evaluator tree (forward sweep)
+    using OutputType = plain_output_t<Derived>;
+    const auto &v_eval = prepareEvaluatorTo<OutputType>(expr.derived());
+
+    eval_with_vjp_t<Derived, Adjoint> result;
+    std::get<0>(result) = prepareOutput(v_eval);
+    reverseSweep<0>(v_eval, Adjoint{adjoint}, no_constant_leaves{}, result);
+    return result;
+}
+
+/** Type of a product of the jacobian of Derived with a (N x K) tangent */
+template <typename Derived, int K>
+using forward_tangent_t =
+  Eigen::Matrix<scalar_t<Derived>, eval_traits<Derived>::TangentSize, K>;
+
+/** The number of columns K of the tangents in a tuple, or 1 if there are none */
+template <typename Tangents>
+struct tangent_cols : std::integral_constant<int, 1> {};
+
+template <typename First, typename... Rest>
+struct tangent_cols<std::tuple<First, Rest...>>
+  : std::integral_constant<int, tmp::remove_cr_t<First>::ColsAtCompileTime> {};
+
+/** Forward sweep of evaluateWithJacobianVectorProduct()
+ *
+ * Returns the product of the jacobian of the node with the tangents of its leaves. The
+ * tangent of leaf number Offset (counted as in constant_leaf_mask_t) is element Offset of
+ * `tangents`. Subtrees whose leaves are all Constant are skipped at compile time.
+ */
+template <int Offset,
+          typename Derived,
+          typename Tangents,
+          tmp::enable_if_t<is_constant_expression<Derived>{}, int> = 0>
+WAVE_STRONG_INLINE auto forwardTangent(const Evaluator<Derived> &, const Tangents &)
+  -> forward_tangent_t<Derived, tangent_cols<Tangents>::value> {
+    return forward_tangent_t<Derived, tangent_cols<Tangents>::value>::Zero();
+}
+
+template <int Offset,
+          typename Derived,
+          typename Tangents,
+          tmp::enable_if_t<is_leaf_expression<Derived>{} && !is_constant_leaf<Derived>{},
+                           int> = 0>
+WAVE_STRONG_INLINE auto forwardTangent(const Evaluator<Derived> &,
+                                       const Tangents &tangents)
+  -> const typename std::tuple_element<Offset, Tangents>::type & {
+    using Tangent = tmp::remove_cr_t<typename std::tuple_element<Offset, Tangents>::type>;
+    static_assert(Tangent::RowsAtCompileTime == eval_traits<Derived>::TangentSize,
+                  "Each tangent must have the tangent size of its leaf");
+    static_assert(Tangent::ColsAtCompileTime == tangent_cols<Tangents>::value,
+                  "All tangents must have the same number of columns");
+    return std::get<Offset>(tangents);
+}
+
+template <int Offset,
+          typename Derived,
+          typename Tangents,
+          tmp::enable_if_t<is_unary_expression<Derived>{} &&
+                             !is_constant_expression<Derived>{},
+                           int> = 0>
+WAVE_STRONG_INLINE auto forwardTangent(const Evaluator<Derived> &evaluator,
+                                       const Tangents &tangents)
+  -> forward_tangent_t<Derived, tangent_cols<Tangents>::value> {
+    return localJacobian(evaluator) *
+           forwardTangent<Offset>(evaluator.rhs_eval, tangents);
+}
+
+template <int Offset,
+          typename Derived,
+          typename Tangents,
+          tmp::enable_if_t<is_binary_expression<Derived>{} &&
+                             !is_constant_expression<Derived>{},
+                           int> = 0>
+WAVE_STRONG_INLINE auto forwardTangent(const Evaluator<Derived> &evaluator,
+                                       const Tangents &tangents)
+  -> forward_tangent_t<Derived, tangent_cols<Tangents>::value> {
+    using Lhs = typename traits<Derived>::LhsDerived;
+    using Rhs = typename traits<Derived>::RhsDerived;
+    constexpr int RhsOffset = Offset + leaf_count<Lhs>::value;
+    forward_tangent_t<Derived, tangent_cols<Tangents>::value> out;
+
+    // Only the operands which are not constant contribute
+    if (is_constant_expression<Lhs>{}) {
+        out.setZero();
+    } else {
+        out.noalias() = localLeftJacobian(evaluator) *
+                        forwardTangent<Offset>(evaluator.lhs_eval, tangents);
+    }
+    if (!is_constant_expression<Rhs>{}) {
+        out += localRightJacobian(evaluator) *
+               forwardTangent<RhsOffset>(evaluator.rhs_eval, tangents);
+    }
+    return out;
+}
+
+/** Evaluate the result of an expression tree, and the product of its jacobians with
+ * tangents of its leaves
+ *
+ * Each leaf's (N x K) tangent is multiplied by the local jacobians in one forward sweep,
+ * giving the (M x K) directional derivative sum_i J_i dx_i without forming any J_i.
+ *
+ * @param tangents one tangent per leaf, in the order of the jacobians from
+ * evaluateWithReverseJacobians()
+ * @return a tuple of the value of the expression and the product
+ */
+template <typename Derived,
+          typename... TangentDerived,
+          TICK_REQUIRES(unique_leaves_t<Derived>{})>
+auto evaluateWithJacobianVectorProduct(
+  const ExpressionBase<Derived> &expr,
+  const Eigen::MatrixBase<TangentDerived> &... tangents)
+  -> std::tuple<plain_output_t<Derived>,
+                forward_tangent_t<Derived,
+                                  tangent_cols<std::tuple<TangentDerived...>>::value>> {
+    static_assert(sizeof...(TangentDerived) == leaf_count<Derived>::value,
+                  "Pass one tangent for each leaf of the expression");
+
+    // Make the Evaluator tree, and propagate the tangents alongside it
+    using OutputType = plain_output_t<Derived>;
+    const auto &v_eval = prepareEvaluatorTo<OutputType>(expr.derived());
+    return std::make_tuple(
+      prepareOutput(v_eval),
+      forward_tangent_t<Derived, tangent_cols<std::tuple<TangentDerived...>>::value>{
+        forwardTangent<0>(v_eval, std::forward_as_tuple(tangents.derived()...))});
+}
+
+}  // namespace internal
+}  // namespace wave
+
+#endif  // WAVE_GEOMETRY_JACOBIANPRODUCTS_HPP
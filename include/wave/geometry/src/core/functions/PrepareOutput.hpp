@@ -12,18 +12,21 @@ namespace internal {
  *
  * This function is enabled when the Destination type is already produced by the
  * expression, so no additional Convert is applied to the root. However, the expression is
- * modified according to the PreparedType of each node.
+ * modified according to the PreparedType of each node, then rewritten by RewriteExpr.
  *
- * @returns an Evaluator of the expression's PreparedType
+ * @tparam Policy which rewrite rules to apply; the default keeps every leaf, so any may
+ * be a jacobian target. See RewriteExpr
+ * @returns an Evaluator of the expression's prepared_t
  * @note The expression stored in `prepareEvaluatorTo<T>(expr).expr`) is *not*
  * necessarily the same as the input `expr`.
  */
 template <
   typename Destination,
+  typename Policy = RewriteKeepingLeaves,
   typename Derived,
   tmp::enable_if_t<std::is_same<Destination, eval_output_t<arg_t<Derived>>>{}, int> = 0>
 WAVE_STRONG_INLINE auto prepareEvaluatorTo(Derived &&expr)
-  -> Evaluator<typename traits<arg_t<Derived>>::PreparedType> {
+  -> Evaluator<prepared_t<arg_t<Derived>, Policy>> {
     // First, transform the expression
     const auto &evaluable_expr =
       PrepareExpr<arg_t<Derived>>::run(std::forward<Derived>(expr));
@@ -32,25 +35,31 @@ WAVE_STRONG_INLINE auto prepareEvaluatorTo(Derived &&expr)
     static_assert(std::is_same<ExprType, typename traits<arg_t<Derived>>::PreparedType>{},
                   "Internal sanity check");
 
+    // Then apply rewrite rules
+    const auto &rewritten_expr = RewriteRoot<ExprType, Policy>::run(evaluable_expr);
+
     // Construct Evaluator tree
-    return internal::Evaluator<ExprType>{evaluable_expr};
+    return internal::Evaluator<prepared_t<arg_t<Derived>, Policy>>{rewritten_expr};
 }
 
 /** Prepare an expression tree with the given Target, and initialize an Evaluator.
  *
  * Applies a conversion to the root of the tree to produce the desired Destination type,
- * then modifies it according to the PreparedType of each node.
+ * then modifies it according to the PreparedType of each node and rewrites it.
  *
- * @returns an Evaluator of the expression's PreparedType
+ * @tparam Policy which rewrite rules to apply; the default keeps every leaf, so any may
+ * be a jacobian target. See RewriteExpr
+ * @returns an Evaluator of the expression's prepared_t
  * @note The expression stored in `prepareEvaluatorTo<T>(expr).expr`) is *not*
  * necessarily the same as the input `expr`.
  */
 template <
   typename Destination,
+  typename Policy = RewriteKeepingLeaves,
   typename Derived,
   tmp::enable_if_t<!std::is_same<Destination, eval_output_t<arg_t<Derived>>>{}, int> = 0>
-WAVE_STRONG_INLINE auto prepareEvaluatorTo(Derived &&expr) -> Evaluator<
-  typename traits<Convert<eval_t<Destination>, arg_t<Derived>>>::PreparedType> {
+WAVE_STRONG_INLINE auto prepareEvaluatorTo(Derived &&expr)
+  -> Evaluator<prepared_t<Convert<eval_t<Destination>, arg_t<Derived>>, Policy>> {
     // Add the needed conversion
     using ConvertedType = Convert<eval_t<Destination>, arg_t<Derived>>;
 
@@ -60,7 +69,7 @@ WAVE_STRONG_INLINE auto prepareEvaluatorTo(Derived &&expr) -> Evaluator<
     static_assert(std::is_same<Destination, eval_output_t<ConvertedType>>{},
                   "Internal sanity check");
 
-    return prepareEvaluatorTo<Destination>(std::move(converted_expr));
+    return prepareEvaluatorTo<Destination, Policy>(std::move(converted_expr));
 }
 
 /** Applies output functor to the result of an evaluator tree
@@ -81,15 +90,27 @@ auto prepareOutput(const Evaluator<Derived> &evaluator)
     return prepareLeafForOutput<Derived>(evaluator());
 };
 
+/** Applies output functor to the result of an expiring evaluator, moving the result out
+ * of it instead of copying
+ */
+template <typename Derived>
+auto prepareOutput(Evaluator<Derived> &&evaluator)
+  -> decltype(prepareLeafForOutput<Derived>(std::move(evaluator)())) {
+    return prepareLeafForOutput<Derived>(std::move(evaluator)());
+};
+
 /** Evaluates an expression tree into the given type
  */
 template <typename Destination, typename Derived>
 auto evaluateTo(Derived &&expr) -> Destination {
     // Construct Evaluator tree
-    const auto &evaluator = prepareEvaluatorTo<Destination>(std::forward<Derived>(expr));
+    // No jacobians are needed, so constant leaves can be removed
+    auto evaluator =
+      prepareEvaluatorTo<Destination, RewriteAll>(std::forward<Derived>(expr));
 
-    // Evaluate and apply output functor (e.g. wrap in Framed)
-    return prepareOutput(evaluator);
+    // Evaluate and apply output functor (e.g. wrap in Framed). The evaluator is not used
+    // again, so its result can be moved out.
+    return prepareOutput(std::move(evaluator));
 }
 
 }  // namespace internal
@@ -5,164 +5,11 @@
 #ifndef WAVE_GEOMETRY_REVERSEJACOBIANEVALUATOR_HPP
 #define WAVE_GEOMETRY_REVERSEJACOBIANEVALUATOR_HPP
 
+#include <bitset>
+
 namespace wave {
 namespace internal {
 
-/** Functor to evaluate an expression tree with variables identified only by type
- *
- * @warning experimental
- */
-template <typename Derived, typename Target, typename = void>
-struct ReverseJacobianEvaluator;
-
-/** Helper template to get the evaluated type of an eigen matrix */
-template <typename T>
-using eigen_plain_t = typename tmp::remove_cr_t<T>::PlainObject;
-
-/** Specialization for leaf expression */
-template <typename Derived, typename Adjoint>
-struct ReverseJacobianEvaluator<Derived, Adjoint, enable_if_leaf_t<Derived>> {
-    WAVE_STRONG_INLINE ReverseJacobianEvaluator(const Evaluator<Derived> &evaluator,
-                                                const Adjoint &adjoint)
-        : evaluator{evaluator}, adjoint{adjoint} {}
-
-
-    auto jacobian() const -> std::tuple<const Adjoint &> {
-        return std::forward_as_tuple(adjoint);
-    }
-
- private:
-    const Evaluator<Derived> &evaluator;
-    const ref_sel_t<Adjoint> adjoint;
-};
-
-/** Specialization for unary expression, if types match */
-template <typename Derived, typename Adjoint>
-struct ReverseJacobianEvaluator<Derived, Adjoint, enable_if_unary_t<Derived>> {
- private:
-    using SelfJacobian = decltype(
-      jacobianImpl(get_expr_tag_t<Derived>{},
-                   std::declval<eval_t<Derived>>(),
-                   std::declval<eval_t<typename traits<Derived>::RhsDerived>>()));
-    using RhsAdjoint = decltype(std::declval<Adjoint>() * std::declval<SelfJacobian>());
-
-
- private:
-    // Wrapped Evaluator and
-    const Evaluator<Derived> &evaluator;
-
-    // Results cache
-    ref_sel_t<SelfJacobian> self_jac;
-    ref_sel_t<Adjoint> adjoint;
-    ref_sel_t<RhsAdjoint> rhs_adjoint;
-
-    // Nested jacobian-evaluators
-    const ReverseJacobianEvaluator<typename traits<Derived>::RhsDerived, RhsAdjoint>
-      rhs_eval;
-
-
- public:
-    WAVE_STRONG_INLINE ReverseJacobianEvaluator(const Evaluator<Derived> &evaluator,
-                                                const Adjoint &adjoint_in)
-        : evaluator{evaluator},
-          self_jac{jacobianImpl(
-            get_expr_tag_t<Derived>{}, this->evaluator(), this->evaluator.rhs_eval())},
-          adjoint{adjoint_in},
-          rhs_adjoint{adjoint * self_jac},
-          rhs_eval{evaluator.rhs_eval, rhs_adjoint} {}
-
-    using JacobianTuple = decltype(rhs_eval.jacobian());
-    auto jacobian() const -> JacobianTuple {
-        return this->rhs_eval.jacobian();
-    }
-};
-
-/** Specialization for a binary expression */
-template <typename Derived, typename Adjoint>
-struct ReverseJacobianEvaluator<Derived, Adjoint, enable_if_binary_t<Derived>> {
- private:
-    using LhsSelfJacobian = decltype(
-      leftJacobianImpl(get_expr_tag_t<Derived>{},
-                       std::declval<eval_t<Derived>>(),
-                       std::declval<eval_t<typename traits<Derived>::LhsDerived>>(),
-                       std::declval<eval_t<typename traits<Derived>::RhsDerived>>()));
-    using RhsSelfJacobian = decltype(
-      rightJacobianImpl(get_expr_tag_t<Derived>{},
-                        std::declval<eval_t<Derived>>(),
-                        std::declval<eval_t<typename traits<Derived>::LhsDerived>>(),
-                        std::declval<eval_t<typename traits<Derived>::RhsDerived>>()));
-    using LhsAdjoint =
-      decltype(std::declval<Adjoint>() * std::declval<LhsSelfJacobian>());
-    using RhsAdjoint =
-      decltype(std::declval<Adjoint>() * std::declval<RhsSelfJacobian>());
-
-
- private:
-    // Wrapped Evaluator
-    const Evaluator<Derived> &evaluator;
-
-    // Results cache
-    ref_sel_t<LhsSelfJacobian> lhs_jac;
-    ref_sel_t<RhsSelfJacobian> rhs_jac;
-    ref_sel_t<Adjoint> adjoint;
-    ref_sel_t<LhsAdjoint> lhs_adjoint;
-    ref_sel_t<RhsAdjoint> rhs_adjoint;
-
-    // Nested jacobian-evaluators
-    const ReverseJacobianEvaluator<typename traits<Derived>::LhsDerived, LhsAdjoint>
-      lhs_eval;
-    const ReverseJacobianEvaluator<typename traits<Derived>::RhsDerived, RhsAdjoint>
-      rhs_eval;
-
- public:
-    WAVE_STRONG_INLINE ReverseJacobianEvaluator(const Evaluator<Derived> &evaluator,
-                                                const Adjoint &adjoint_in)
-        : evaluator{evaluator},
-          lhs_jac{leftJacobianImpl(get_expr_tag_t<Derived>{},
-                                   this->evaluator(),
-                                   this->evaluator.lhs_eval(),
-                                   this->evaluator.rhs_eval())},
-          rhs_jac{rightJacobianImpl(get_expr_tag_t<Derived>{},
-                                    this->evaluator(),
-                                    this->evaluator.lhs_eval(),
-                                    this->evaluator.rhs_eval())},
-          adjoint{adjoint_in},
-          lhs_adjoint{adjoint * lhs_jac},
-          rhs_adjoint{adjoint * rhs_jac},
-          lhs_eval{evaluator.lhs_eval, lhs_adjoint},
-          rhs_eval{evaluator.rhs_eval, rhs_adjoint} {}
-
-
-    using JacobianTuple =
-      decltype(std::tuple_cat(lhs_eval.jacobian(), rhs_eval.jacobian()));
-    auto jacobian() const -> JacobianTuple {
-        return std::tuple_cat(lhs_eval.jacobian(), rhs_eval.jacobian());
-    }
-};
-
-/** Helper to make a tuple of values from a tuple of references.
- *
- * This is needed because in the case `size == 1`, calling tuple's constructor
- * tuple<Matrix>(tuple<const Matrix&>) will try to construct a Matrix from a tuple
- * (because of the changes to tuple.cnstr in https://cplusplus.github.io/LWG/issue2549,
- * combined with Eigen::Matrix's overly greedy templated constructor).
- */
-template <typename Target, typename T>
-Target makeTupleFromTuple(T &&t) {
-    return Target{std::forward<T>(t)};
-};
-
-// case for size == 1
-template <typename Target, typename T>
-Target makeTupleFromTuple(const std::tuple<T> &t) {
-    return Target{std::get<0>(t)};
-};
-
-template <typename Target, typename T>
-Target makeTupleFromTuple(std::tuple<T> &&t) {
-    return Target{std::get<0>(std::move(t))};
-};
-
 template <typename Derived, typename = void>
 struct eval_with_reverse_jacobians_impl {
     using type = NotAllowed;
@@ -184,33 +31,203 @@ struct eval_with_reverse_jacobians_impl<Derived,
  *
  * We need this alias so we can use the return type in ExpressionBase<Derived>, while
  * Derived is an incomplete type.
- *
- * @todo It could also be used *inside* ReverseJacobianEvaluator itself, but that was
- * written separately assuming a complete type for Derived. Therefore, for now, we just
- * make sure the two types match.
  */
 template <typename Derived>
 using eval_with_reverse_jacobians_t =
   typename eval_with_reverse_jacobians_impl<Derived>::type;
 
 
-/** Evaluate the result of an expression tree and all jacobians
+/** The number of leaves of an expression tree, each of which gets a jacobian from
+ * evaluateWithReverseJacobians(). Constant leaves are not counted. */
+template <typename Derived, typename Enable = void>
+struct leaf_count;
+
+template <typename Derived>
+struct leaf_count<Derived, enable_if_leaf_t<Derived>>
+  : std::integral_constant<int, is_constant_leaf<Derived>{} ? 0 : 1> {};
+
+template <typename Derived>
+struct leaf_count<Derived, enable_if_unary_t<Derived>>
+  : leaf_count<typename traits<Derived>::RhsDerived> {};
+
+template <typename Derived>
+struct leaf_count<Derived, enable_if_binary_t<Derived>>
+  : std::integral_constant<int,
+                           leaf_count<typename traits<Derived>::LhsDerived>::value +
+                             leaf_count<typename traits<Derived>::RhsDerived>::value> {};
+
+// Operands may be stored by reference
+template <typename Derived>
+struct leaf_count<Derived &> : leaf_count<tmp::remove_cr_t<Derived>> {};
+
+template <typename Derived>
+struct leaf_count<Derived &&> : leaf_count<tmp::remove_cr_t<Derived>> {};
+
+/** A mask of leaves to hold constant, for evaluateWithReverseJacobians()
  *
- * @return a tuple of the value of the expression and all jacobians
+ * Bit i is set if the i-th leaf is constant, in the order of the jacobians returned by
+ * evalWithJacobians(). A subtree is held constant by setting the bits of all its leaves.
  */
-template <
-  typename Derived,
-  typename ExprJacobianTuple =
-    typename ReverseJacobianEvaluator<Derived, identity_t<Derived>>::JacobianTuple,
-  typename JacobianTuple = tmp::apply_each_t<eigen_plain_t, ExprJacobianTuple>>
-WAVE_STRONG_INLINE auto evaluateWithReverseJacobiansImpl(const Evaluator<Derived> &v_eval)
-  -> tmp::concat_t<std::tuple<plain_output_t<Derived>>, JacobianTuple> {
-    // Make the ReverseJacobianEvaluator tree
-    internal::ReverseJacobianEvaluator<Derived, identity_t<Derived>> j_eval{
-      v_eval, identity_t<Derived>{}};
-
-    return std::tuple_cat(std::forward_as_tuple(prepareOutput(v_eval)),
-                          makeTupleFromTuple<JacobianTuple>(j_eval.jacobian()));
+template <typename Derived>
+using constant_leaf_mask_t = std::bitset<leaf_count<Derived>::value>;
+
+/** A mask holding no leaves constant, for a backward sweep with no run-time checks */
+struct no_constant_leaves {};
+
+/** True if any leaf numbered in [begin, begin + count) is not constant */
+template <std::size_t N>
+WAVE_STRONG_INLINE bool anyFreeLeaf(const std::bitset<N> &constant,
+                                    int begin,
+                                    int count) {
+    for (int i = begin; i < begin + count; ++i) {
+        if (!constant[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+constexpr bool anyFreeLeaf(no_constant_leaves, int, int count) {
+    return count > 0;
+}
+
+/** The adjoint of node T, with as many rows as the given adjoint */
+template <typename Adjoint, typename T>
+using reverse_adjoint_t = Eigen::Matrix<scalar_t<T>,
+                                        Adjoint::RowsAtCompileTime,
+                                        eval_traits<T>::TangentSize>;
+
+/** Backward sweep of evaluateWithReverseJacobians()
+ *
+ * This keeps only the adjoints on the current path, and does not find the jacobians
+ * leading into a subtree with no free leaf. The jacobian of leaf number Offset (counted
+ * as in constant_leaf_mask_t) is written to element Offset + 1 of result.
+ *
+ * @tparam Mask a constant_leaf_mask_t, or no_constant_leaves
+ * @tparam Result a tuple whose elements, after the value, are the jacobians or writable
+ * references to them
+ */
+template <int Offset,
+          typename Derived,
+          typename Adjoint,
+          typename Mask,
+          typename Result,
+          tmp::enable_if_t<is_constant_expression<Derived>{}, int> = 0>
+WAVE_STRONG_INLINE void reverseSweep(const Evaluator<Derived> &,
+                                     const Adjoint &,
+                                     const Mask &,
+                                     Result &) {}
+
+template <int Offset,
+          typename Derived,
+          typename Adjoint,
+          typename Mask,
+          typename Result,
+          tmp::enable_if_t<is_leaf_expression<Derived>{} && !is_constant_leaf<Derived>{},
+                           int> = 0>
+WAVE_STRONG_INLINE void reverseSweep(const Evaluator<Derived> &,
+                                     const Adjoint &adjoint,
+                                     const Mask &,
+                                     Result &result) {
+    std::get<Offset + 1>(result) = adjoint;
+}
+
+/** Continues the backward sweep into a child, given the product of the parent's adjoint
+ * and the local jacobian.
+ *
+ * The adjoint of a leaf is its jacobian, so the product is assigned straight to the
+ * leaf's element of result. Otherwise, it is evaluated once for the child's subtree.
+ */
+template <int Offset,
+          typename Child,
+          typename Product,
+          typename Mask,
+          typename Result,
+          tmp::enable_if_t<is_leaf_expression<Child>{} && !is_constant_leaf<Child>{},
+                           int> = 0>
+WAVE_STRONG_INLINE void reverseSweepChild(const Evaluator<Child> &,
+                                          const Product &product,
+                                          const Mask &,
+                                          Result &result) {
+    std::get<Offset + 1>(result).noalias() = product;
+}
+
+template <int Offset,
+          typename Child,
+          typename Product,
+          typename Mask,
+          typename Result,
+          tmp::enable_if_t<!is_leaf_expression<Child>{} || is_constant_leaf<Child>{},
+                           int> = 0>
+WAVE_STRONG_INLINE void reverseSweepChild(const Evaluator<Child> &child,
+                                          const Product &product,
+                                          const Mask &constant,
+                                          Result &result) {
+    const reverse_adjoint_t<Product, Child> adjoint = product;
+    reverseSweep<Offset>(child, adjoint, constant, result);
+}
+
+template <int Offset,
+          typename Derived,
+          typename Adjoint,
+          typename Mask,
+          typename Result,
+          tmp::enable_if_t<is_unary_expression<Derived>{} &&
+                             !is_constant_expression<Derived>{},
+                           int> = 0>
+WAVE_STRONG_INLINE void reverseSweep(const Evaluator<Derived> &evaluator,
+                                     const Adjoint &adjoint,
+                                     const Mask &constant,
+                                     Result &result) {
+    // The caller has checked this subtree has a free leaf
+    reverseSweepChild<Offset>(
+      evaluator.rhs_eval, adjoint * localJacobian(evaluator), constant, result);
+}
+
+template <int Offset,
+          typename Derived,
+          typename Adjoint,
+          typename Mask,
+          typename Result,
+          tmp::enable_if_t<is_binary_expression<Derived>{} &&
+                             !is_constant_expression<Derived>{},
+                           int> = 0>
+WAVE_STRONG_INLINE void reverseSweep(const Evaluator<Derived> &evaluator,
+                                     const Adjoint &adjoint,
+                                     const Mask &constant,
+                                     Result &result) {
+    using Lhs = typename traits<Derived>::LhsDerived;
+    using Rhs = typename traits<Derived>::RhsDerived;
+    constexpr int RhsOffset = Offset + leaf_count<Lhs>::value;
+
+    if (anyFreeLeaf(constant, Offset, leaf_count<Lhs>::value)) {
+        reverseSweepChild<Offset>(evaluator.lhs_eval,
+                                  adjoint * localLeftJacobian(evaluator),
+                                  constant,
+                                  result);
+    }
+    if (anyFreeLeaf(constant, RhsOffset, leaf_count<Rhs>::value)) {
+        reverseSweepChild<RhsOffset>(evaluator.rhs_eval,
+                                     adjoint * localRightJacobian(evaluator),
+                                     constant,
+                                     result);
+    }
+}
+
+/** Performs the backward sweep of evaluateWithReverseJacobians(expr) on an Evaluator
+ * tree, whose type may differ from the expression's after adding conversions
+ *
+ * @param result a tuple of the value, which is not written, then the destination of
+ * each jacobian
+ */
+template <typename PreparedDerived, typename Result>
+WAVE_STRONG_INLINE void reverseSweepAll(const Evaluator<PreparedDerived> &v_eval,
+                                        Result &result) {
+    constexpr int NumLeaves = leaf_count<PreparedDerived>::value;
+    static_assert(std::tuple_size<Result>::value == NumLeaves + 1,
+                  "Pass one destination for each leaf of the expression");
+    reverseSweep<0>(
+      v_eval, identity_t<PreparedDerived>{}, no_constant_leaves{}, result);
 }
 
 /** Evaluate the result of an expression tree and all jacobians
@@ -220,21 +237,171 @@ WAVE_STRONG_INLINE auto evaluateWithReverseJacobiansImpl(const Evaluator<Derived
 template <typename Derived, TICK_REQUIRES(unique_leaves_t<Derived>{})>
 WAVE_STRONG_INLINE auto evaluateWithReverseJacobians(const ExpressionBase<Derived> &expr)
   -> eval_with_reverse_jacobians_t<Derived> {
-    // @todo better checks for validity of arguments
-    // @todo debug-mode checks
-    // assert(containsSame(expr, target));
+    // Make the Evaluator tree (forward sweep)
+    using OutputType = plain_output_t<Derived>;
+    const auto &v_eval = prepareEvaluatorTo<OutputType>(expr.derived());
 
+    // Write the jacobians directly into the returned tuple (backward sweep)
+    eval_with_reverse_jacobians_t<Derived> result;
+    std::get<0>(result) = prepareOutput(v_eval);
+    reverseSweepAll(v_eval, result);
+    return result;
+}
+
+/** Zeroes the jacobians of constant leaves in a result tuple, whose first element is the
+ * value */
+template <typename Result, std::size_t N, int... Is>
+WAVE_STRONG_INLINE void zeroConstantJacobians(const std::bitset<N> &constant,
+                                              Result &result,
+                                              tmp::index_sequence<Is...>) {
+    const int expand[] = {
+      0, (constant[Is] ? (std::get<Is + 1>(result).setZero(), 0) : 0)...};
+    (void) expand;
+}
+
+/** Performs the backward sweep of evaluateWithReverseJacobians(expr, constant) on an
+ * Evaluator tree, whose type may differ from the expression's after adding conversions
+ */
+template <typename PreparedDerived, typename Result, std::size_t N>
+WAVE_STRONG_INLINE void evaluateWithReverseJacobiansMaskedImpl(
+  const Evaluator<PreparedDerived> &v_eval,
+  const std::bitset<N> &constant,
+  Result &result) {
+    static_assert(leaf_count<PreparedDerived>::value == N,
+                  "Internal sanity check: preparing should not change the leaves");
+    std::get<0>(result) = prepareOutput(v_eval);
+    zeroConstantJacobians(constant, result, tmp::make_index_sequence<N>{});
+    if (anyFreeLeaf(constant, 0, N)) {
+        reverseSweep<0>(v_eval, identity_t<PreparedDerived>{}, constant, result);
+    }
+}
+
+/** Evaluate the result of an expression tree and the jacobians of its free leaves
+ *
+ * The jacobians of leaves set in `constant` are zero. No work is done to find them:
+ * adjoints are not propagated into subtrees whose leaves are all constant, so the cost
+ * scales with the number of free leaves.
+ *
+ * @param constant the leaves to hold constant, as described for constant_leaf_mask_t
+ * @return a tuple of the value of the expression and all jacobians
+ */
+template <typename Derived, TICK_REQUIRES(unique_leaves_t<Derived>{})>
+auto evaluateWithReverseJacobians(const ExpressionBase<Derived> &expr,
+                                  const constant_leaf_mask_t<Derived> &constant)
+  -> eval_with_reverse_jacobians_t<Derived> {
     // Make the Evaluator tree (forward sweep)
     using OutputType = plain_output_t<Derived>;
     const auto &v_eval = prepareEvaluatorTo<OutputType>(expr.derived());
 
-    // Make the ReverseJacobianEvaluator tree
-    return evaluateWithReverseJacobiansImpl(v_eval);
+    eval_with_reverse_jacobians_t<Derived> result;
+    evaluateWithReverseJacobiansMaskedImpl(v_eval, constant, result);
+    return result;
+}
+
+template <typename D>
+std::true_type isMatrixBase(const Eigen::MatrixBase<D> *);
+std::false_type isMatrixBase(...);
+
+/** Aliases true_type if every T is an Eigen matrix expression, to which a jacobian can
+ * be assigned */
+template <typename... T>
+using are_jacobian_destinations = tmp::conjunction<decltype(
+  isMatrixBase(std::declval<tmp::remove_cr_t<T> *>()))...>;
+
+/** Evaluate the result of an expression tree, writing all jacobians to the given
+ * destinations
+ *
+ * A destination may be any writable matrix expression of the jacobian's size: a block of
+ * a larger jacobian, an Eigen::Ref, or an Eigen::Map over a raw pointer with any stride
+ * and storage order. The final product for each leaf is assigned straight to its
+ * destination, with no intermediate jacobian.
+ *
+ * @param jacobians one destination per leaf, in the order of the jacobians from
+ * evaluateWithReverseJacobians()
+ * @return the value of the expression
+ */
+template <typename Derived,
+          typename... JacobianOut,
+          TICK_REQUIRES(unique_leaves_t<Derived>{} &&
+                        are_jacobian_destinations<JacobianOut...>{})>
+auto evaluateWithReverseJacobiansInto(const ExpressionBase<Derived> &expr,
+                                      JacobianOut &&... jacobians)
+  -> plain_output_t<Derived> {
+    static_assert(sizeof...(JacobianOut) == leaf_count<Derived>::value,
+                  "Pass one destination for each leaf of the expression");
+    using OutputType = plain_output_t<Derived>;
+    const auto &v_eval = prepareEvaluatorTo<OutputType>(expr.derived());
+
+    OutputType value{prepareOutput(v_eval)};
+    auto result = std::forward_as_tuple(value, std::forward<JacobianOut>(jacobians)...);
+    reverseSweepAll(v_eval, result);
+    return value;
+}
+
+/** A map of a dense, row-major jacobian of Derived w.r.t. T, as used by e.g. Ceres */
+template <typename Derived, typename T>
+using row_major_jacobian_map_t = Eigen::Map<
+  Eigen::Matrix<scalar_t<Derived>,
+                eval_traits<Derived>::TangentSize,
+                eval_traits<T>::TangentSize,
+                // Eigen does not allow a row-major column vector
+                (eval_traits<T>::TangentSize == 1 &&
+                 eval_traits<Derived>::TangentSize != 1)
+                  ? Eigen::ColMajor
+                  : Eigen::RowMajor>>;
+
+template <typename Derived>
+using row_major_jacobian_maps_t = tmp::apply_t<
+  std::tuple,
+  plain_output_t<Derived> &,
+  tmp::apply_each_t<row_major_jacobian_map_t,
+                    Derived,
+                    typename unique_leaves_t<Derived>::type>>;
+
+template <typename Derived, int... Is>
+auto evaluateWithReverseJacobiansIntoPointers(const ExpressionBase<Derived> &expr,
+                                              scalar_t<Derived> *const *jacobians,
+                                              tmp::index_sequence<Is...>)
+  -> plain_output_t<Derived> {
+    using OutputType = plain_output_t<Derived>;
+    const auto &v_eval = prepareEvaluatorTo<OutputType>(expr.derived());
+
+    OutputType value{prepareOutput(v_eval)};
+    constant_leaf_mask_t<Derived> constant;
+    if (jacobians == nullptr) {
+        constant.set();
+    } else {
+        const int expand[] = {0, (constant[Is] = (jacobians[Is] == nullptr), 0)...};
+        (void) expand;
+    }
 
-    using RetType = tmp::remove_cr_t<decltype(evaluateWithReverseJacobiansImpl(v_eval))>;
-    static_assert(
-      std::is_constructible<eval_with_reverse_jacobians_t<Derived>, RetType>{},
-      "Internal sanity check: expected reverse evaluator return type");
+    if (anyFreeLeaf(constant, 0, leaf_count<Derived>::value)) {
+        // A null entry gives a Map which is never written, as its leaf is held constant
+        using Result = row_major_jacobian_maps_t<Derived>;
+        Result result{
+          value, typename std::tuple_element<Is + 1, Result>::type{jacobians[Is]}...};
+        reverseSweep<0>(v_eval, identity_t<Derived>{}, constant, result);
+    }
+    return value;
+}
+
+/** Evaluate the result of an expression tree, writing all jacobians to raw arrays
+ *
+ * Each jacobian is written as a dense, row-major array, as in e.g. a Ceres cost function.
+ * Jacobians with a null pointer are not found, as if their leaves were held constant by
+ * evaluateWithReverseJacobians(expr, constant). If `jacobians` itself is null, only the
+ * value is found. For other layouts, pass an Eigen::Map to the overload above.
+ *
+ * @param jacobians one pointer per leaf, in the order of the jacobians from
+ * evaluateWithReverseJacobians()
+ * @return the value of the expression
+ */
+template <typename Derived, TICK_REQUIRES(unique_leaves_t<Derived>{})>
+auto evaluateWithReverseJacobiansInto(const ExpressionBase<Derived> &expr,
+                                      scalar_t<Derived> *const *jacobians)
+  -> plain_output_t<Derived> {
+    return evaluateWithReverseJacobiansIntoPointers(
+      expr, jacobians, tmp::make_index_sequence<leaf_count<Derived>::value>{});
 }
 
 }  // namespace internal
@@ -0,0 +1,268 @@
+/**
+ * @file
+ */
+
+#ifndef WAVE_GEOMETRY_REWRITEEXPR_HPP
+#define WAVE_GEOMETRY_REWRITEEXPR_HPP
+
+namespace wave {
+namespace internal {
+
+/** Rewrite policy which applies no rules */
+struct RewriteNone {};
+
+/** Rewrite policy which applies only rules keeping every leaf, in order
+ *
+ * For evaluators giving jacobians, since any leaf may be a target.
+ */
+struct RewriteKeepingLeaves {};
+
+/** Rewrite policy which applies every rule, including those removing Identity and Zero
+ * leaves
+ *
+ * For evaluation without jacobians.
+ */
+struct RewriteAll {};
+
+/** A rule rewriting a prepared expression into a cheaper, equivalent one
+ *
+ * The primary template rewrites nothing. A specialization defines `type`, the rewritten
+ * expression, and a static function `run(const Derived &)` constructing it.
+ *
+ * Rules may only rearrange the nodes above the leaves, reusing the same leaf objects. The
+ * jacobians of the rewritten expression, found through the evaluators as usual, are then
+ * those of the original expression. An operation introduced by a rule must provide its
+ * own jacobians, like any other operation.
+ *
+ * Each rule is checked before it is used: the rewritten expression must be evaluable
+ * without conversions, and have the same plain output type as the original. See
+ * RewriteExpr.
+ *
+ * A rule which makes the value cheaper but its jacobians dearer also defines
+ * `using ValueOnly = std::true_type`, and is then used only under RewriteAll.
+ */
+template <typename Derived, typename Enable = void>
+struct rewrite_rule {
+    using type = Derived;
+};
+
+/** Aliases true_type if Rule may be used under Policy; see rewrite_rule */
+template <typename Rule, typename Policy, typename Enable = void>
+struct is_rule_allowed : std::true_type {};
+
+template <typename Rule, typename Policy>
+struct is_rule_allowed<Rule, Policy, tmp::void_t<typename Rule::ValueOnly>>
+  : tmp::bool_constant<!Rule::ValueOnly::value || std::is_same<Policy, RewriteAll>{}> {};
+
+/** Gives a type_list of the leaves in an expression, in order */
+template <typename Derived, typename Enable = void>
+struct leaf_list {
+    using type = tmp::type_list<tmp::remove_cr_t<Derived>>;
+};
+
+template <typename Derived>
+using leaf_list_t = typename leaf_list<Derived>::type;
+
+template <typename Derived>
+struct leaf_list<Derived, enable_if_unary_t<Derived>>
+  : leaf_list<typename traits<Derived>::RhsDerived> {};
+
+template <typename Derived>
+struct leaf_list<Derived, enable_if_binary_t<Derived>> {
+    using type = tmp::concat_t<leaf_list_t<typename traits<Derived>::LhsDerived>,
+                               leaf_list_t<typename traits<Derived>::RhsDerived>>;
+};
+
+/** Aliases true_type if an expression is evaluable as is: it is a leaf, or no
+ * conversions would be added to it by PrepareExpr */
+template <typename Derived, typename Enable = void>
+struct is_prepared
+  : std::is_same<typename traits<Derived>::PreparedType, tmp::remove_cr_t<Derived>> {};
+
+template <typename Derived>
+struct is_prepared<Derived, enable_if_leaf_or_nullary_t<tmp::remove_cr_t<Derived>>>
+  : std::true_type {};
+
+/** Aliases true_type if Candidate may replace the prepared expression Original */
+template <typename Original, typename Candidate, typename Policy>
+struct is_valid_rewrite
+  : tmp::conjunction<
+      tmp::bool_constant<!std::is_same<Policy, RewriteNone>{} &&
+                         !std::is_same<Original, Candidate>{}>,
+      is_prepared<Candidate>,
+      std::is_same<plain_output_t<tmp::remove_cr_t<Candidate>>, plain_output_t<Original>>,
+      tmp::bool_constant<!std::is_same<Policy, RewriteKeepingLeaves>{} ||
+                         std::is_same<leaf_list_t<Candidate>, leaf_list_t<Original>>{}>> {
+};
+
+/** The type returned by RewriteExpr<Derived>::run(), given the rewritten type
+ *
+ * An unchanged expression is returned by reference. So is a leaf parameter stored by
+ * reference, so the new tree refers to the same object. Anything else is a new
+ * expression or a leaf stored by value, returned by value.
+ */
+template <typename Derived, typename Rewritten>
+using rewrite_return_t = tmp::conditional_t<
+  std::is_same<Derived, Rewritten>{} ||
+    (is_leaf_expression<tmp::remove_cr_t<Rewritten>>{} &&
+     !std::is_reference<Rewritten>{}),
+  const tmp::remove_cr_t<Rewritten> &,
+  tmp::remove_cr_t<Rewritten>>;
+
+/** Applies rewrite rules to a prepared expression tree, from the leaves up
+ *
+ * Each node is first rebuilt with its rewritten operands, then one rule is applied to it
+ * if valid. If the rebuilt node would need a conversion, the original is kept instead.
+ *
+ * Defining WAVE_GEOMETRY_NO_REWRITE disables all rules, e.g. for comparison.
+ *
+ * @tparam Derived a prepared expression, which is unchanged by PrepareExpr
+ * @tparam Policy one of RewriteNone, RewriteKeepingLeaves and RewriteAll
+ */
+template <typename Derived, typename Policy, typename Enable = void>
+struct RewriteExpr;
+
+template <typename Derived, typename Policy>
+struct RewriteExpr<Derived,
+                   Policy,
+                   enable_if_leaf_or_nullary_t<tmp::remove_cr_t<Derived>>> {
+    using type = Derived;
+
+    static auto run(const tmp::remove_cr_t<Derived> &leaf)
+      -> const tmp::remove_cr_t<Derived> & {
+        return leaf;
+    }
+};
+
+/** Common part of the unary and binary cases, given the node rebuilt from the rewritten
+ * operands */
+template <typename Derived, typename Policy, typename Rebuilt>
+struct rewrite_node {
+ protected:
+    // Keep the original node if the rebuilt one is unchanged, or needs conversions
+    using use_rebuilt = tmp::bool_constant<!std::is_same<Rebuilt, Derived>{} &&
+                                           is_prepared<Rebuilt>{}>;
+    using Node = tmp::conditional_t<use_rebuilt{}, Rebuilt, Derived>;
+    using Rule = rewrite_rule<Node>;
+
+#ifdef WAVE_GEOMETRY_NO_REWRITE
+    using use_rule = std::false_type;
+#else
+    using use_rule =
+      tmp::conjunction<is_rule_allowed<Rule, Policy>,
+                       is_valid_rewrite<Node, typename Rule::type, Policy>>;
+#endif
+
+ public:
+    using type = tmp::conditional_t<use_rule{}, typename Rule::type, Node>;
+
+ protected:
+    static auto applyRule(std::true_type, const Node &node)
+      -> rewrite_return_t<Node, typename Rule::type> {
+        return Rule::run(node);
+    }
+
+    static auto applyRule(std::false_type, const Node &node) -> const Node & {
+        return node;
+    }
+};
+
+/** A unary expression rebuilt with its rewritten operand */
+template <typename Derived, typename Policy>
+using rebuilt_unary_t = typename traits<Derived>::template rebind<
+  typename RewriteExpr<typename traits<Derived>::RhsDerived, Policy>::type>;
+
+/** A binary expression rebuilt with its rewritten operands */
+template <typename Derived, typename Policy>
+using rebuilt_binary_t = typename traits<Derived>::template rebind<
+  typename RewriteExpr<typename traits<Derived>::LhsDerived, Policy>::type,
+  typename RewriteExpr<typename traits<Derived>::RhsDerived, Policy>::type>;
+
+template <typename Derived, typename Policy>
+struct RewriteExpr<Derived, Policy, enable_if_unary_t<Derived>>
+  : rewrite_node<Derived, Policy, rebuilt_unary_t<Derived, Policy>> {
+ private:
+    using Base = rewrite_node<Derived, Policy, rebuilt_unary_t<Derived, Policy>>;
+    using RhsRewrite = RewriteExpr<typename traits<Derived>::RhsDerived, Policy>;
+    using Rebuilt = rebuilt_unary_t<Derived, Policy>;
+
+    static auto rebuild(std::true_type, const Derived &expr) -> Rebuilt {
+        return Rebuilt{RhsRewrite::run(expr.rhs())};
+    }
+
+    static auto rebuild(std::false_type, const Derived &expr) -> const Derived & {
+        return expr;
+    }
+
+ public:
+    static auto run(const Derived &expr)
+      -> rewrite_return_t<Derived, typename Base::type> {
+        return Base::applyRule(typename Base::use_rule{},
+                               rebuild(typename Base::use_rebuilt{}, expr));
+    }
+};
+
+template <typename Derived, typename Policy>
+struct RewriteExpr<Derived, Policy, enable_if_binary_t<Derived>>
+  : rewrite_node<Derived, Policy, rebuilt_binary_t<Derived, Policy>> {
+ private:
+    using Base = rewrite_node<Derived, Policy, rebuilt_binary_t<Derived, Policy>>;
+    using LhsRewrite = RewriteExpr<typename traits<Derived>::LhsDerived, Policy>;
+    using RhsRewrite = RewriteExpr<typename traits<Derived>::RhsDerived, Policy>;
+    using Rebuilt = rebuilt_binary_t<Derived, Policy>;
+
+    static auto rebuild(std::true_type, const Derived &expr) -> Rebuilt {
+        return Rebuilt{LhsRewrite::run(expr.lhs()), RhsRewrite::run(expr.rhs())};
+    }
+
+    static auto rebuild(std::false_type, const Derived &expr) -> const Derived & {
+        return expr;
+    }
+
+ public:
+    static auto run(const Derived &expr)
+      -> rewrite_return_t<Derived, typename Base::type> {
+        return Base::applyRule(typename Base::use_rule{},
+                               rebuild(typename Base::use_rebuilt{}, expr));
+    }
+};
+
+/** An rvalue operand, which its parent stores by value, is rewritten as such */
+template <typename Derived, typename Policy>
+struct RewriteExpr<Derived &&,
+                   Policy,
+                   tmp::enable_if_t<!is_leaf_expression<Derived>{} &&
+                                    !is_nullary_expression<Derived>{}>>
+  : RewriteExpr<Derived, Policy> {
+ private:
+    using Rewritten = typename RewriteExpr<Derived, Policy>::type;
+
+ public:
+    using type =
+      tmp::conditional_t<std::is_same<Rewritten, Derived>{}, Derived &&, Rewritten>;
+};
+
+/** Rewrites the root of a prepared expression tree
+ *
+ * The whole tree is kept as is if rewriting would change the type of its evaluated
+ * output, or reduce it to a leaf, which an Evaluator would refer to but not own.
+ */
+template <typename Derived,
+          typename Policy,
+          typename Rewritten = typename RewriteExpr<Derived, Policy>::type>
+struct RewriteRoot
+  : tmp::conditional_t<!is_leaf_expression<tmp::remove_cr_t<Rewritten>>{} &&
+                         std::is_same<eval_output_t<Rewritten>, eval_output_t<Derived>>{},
+                       RewriteExpr<Derived, Policy>,
+                       RewriteExpr<Derived, RewriteNone>> {};
+
+/** The type of the expression tree evaluated for Derived, after preparing and rewriting
+ * it */
+template <typename Derived, typename Policy = RewriteKeepingLeaves>
+using prepared_t =
+  typename RewriteRoot<typename traits<Derived>::PreparedType, Policy>::type;
+
+}  // namespace internal
+}  // namespace wave
+
+#endif  // WAVE_GEOMETRY_REWRITEEXPR_HPP
@@ -51,10 +51,7 @@ struct TypedJacobianEvaluator<
     const Evaluator<Derived> &evaluator;
     const TypedJacobianEvaluator<typename Derived::RhsDerived, Target> rhs_eval;
 
-    using SelfJacobian =
-      decltype(jacobianImpl(get_expr_tag_t<Derived>{},
-                            std::declval<eval_t<Derived>>(),
-                            std::declval<eval_t<typename Derived::RhsDerived>>()));
+    using SelfJacobian = unary_local_jacobian_t<Derived>;
     using RhsJacobian = decltype(rhs_eval.jacobian());
     using Jacobian = decltype(std::declval<SelfJacobian>() * std::declval<RhsJacobian>());
 
@@ -68,8 +65,7 @@ struct TypedJacobianEvaluator<
                                               const Target &target)
         : evaluator{evaluator},
           rhs_eval{evaluator.rhs_eval, target},
-          self_jac{jacobianImpl(
-            get_expr_tag_t<Derived>{}, this->evaluator(), this->evaluator.rhs_eval())},
+          self_jac{localJacobian(this->evaluator)},
           jac{self_jac * this->rhs_eval.jacobian()} {}
 
     /** Calculate the jacobian w.r.t. the given expression
@@ -97,16 +93,8 @@ struct TypedJacobianEvaluator<
     const TypedJacobianEvaluator<typename Derived::LhsDerived, Target> lhs_eval;
     const TypedJacobianEvaluator<typename Derived::RhsDerived, Target> rhs_eval;
 
-    using LhsSelfJacobian =
-      decltype(leftJacobianImpl(get_expr_tag_t<Derived>{},
-                                std::declval<eval_t<Derived>>(),
-                                std::declval<eval_t<typename Derived::LhsDerived>>(),
-                                std::declval<eval_t<typename Derived::RhsDerived>>()));
-    using RhsSelfJacobian =
-      decltype(rightJacobianImpl(get_expr_tag_t<Derived>{},
-                                 std::declval<eval_t<Derived>>(),
-                                 std::declval<eval_t<typename Derived::LhsDerived>>(),
-                                 std::declval<eval_t<typename Derived::RhsDerived>>()));
+    using LhsSelfJacobian = left_local_jacobian_t<Derived>;
+    using RhsSelfJacobian = right_local_jacobian_t<Derived>;
     using LhsJacobian = decltype(lhs_eval.jacobian());
     using RhsJacobian = decltype(rhs_eval.jacobian());
     using Jacobian =
@@ -124,14 +112,8 @@ struct TypedJacobianEvaluator<
         : evaluator{evaluator},
           lhs_eval{evaluator.lhs_eval, target},
           rhs_eval{evaluator.rhs_eval, target},
-          lhs_jac{leftJacobianImpl(get_expr_tag_t<Derived>{},
-                                   this->evaluator(),
-                                   this->evaluator.lhs_eval(),
-                                   this->evaluator.rhs_eval())},
-          rhs_jac{rightJacobianImpl(get_expr_tag_t<Derived>{},
-                                    this->evaluator(),
-                                    this->evaluator.lhs_eval(),
-                                    this->evaluator.rhs_eval())},
+          lhs_jac{localLeftJacobian(this->evaluator)},
+          rhs_jac{localRightJacobian(this->evaluator)},
           jac{lhs_jac * this->lhs_eval.jacobian() + rhs_jac * this->rhs_eval.jacobian()} {
     }
 
@@ -161,11 +143,7 @@ struct TypedJacobianEvaluator<
     const Evaluator<Derived> &evaluator;
     const TypedJacobianEvaluator<typename Derived::LhsDerived, Target> lhs_eval;
 
-    using LhsSelfJacobian =
-      decltype(leftJacobianImpl(get_expr_tag_t<Derived>{},
-                                std::declval<eval_t<Derived>>(),
-                                std::declval<eval_t<typename Derived::LhsDerived>>(),
-                                std::declval<eval_t<typename Derived::RhsDerived>>()));
+    using LhsSelfJacobian = left_local_jacobian_t<Derived>;
     using LhsJacobian = decltype(lhs_eval.jacobian());
     using Jacobian =
       decltype(std::declval<LhsSelfJacobian>() * std::declval<LhsJacobian>());
@@ -179,10 +157,7 @@ struct TypedJacobianEvaluator<
                                               const Target &target)
         : evaluator{evaluator},
           lhs_eval{evaluator.lhs_eval, target},
-          lhs_jac{leftJacobianImpl(get_expr_tag_t<Derived>{},
-                                   this->evaluator(),
-                                   this->evaluator.lhs_eval(),
-                                   this->evaluator.rhs_eval())},
+          lhs_jac{localLeftJacobian(this->evaluator)},
           jac{lhs_jac * this->lhs_eval.jacobian()} {}
 
 
@@ -210,11 +185,7 @@ struct TypedJacobianEvaluator<
     const Evaluator<Derived> &evaluator;
     const TypedJacobianEvaluator<typename Derived::RhsDerived, Target> rhs_eval;
 
-    using RhsSelfJacobian =
-      decltype(rightJacobianImpl(get_expr_tag_t<Derived>{},
-                                 std::declval<eval_t<Derived>>(),
-                                 std::declval<eval_t<typename Derived::LhsDerived>>(),
-                                 std::declval<eval_t<typename Derived::RhsDerived>>()));
+    using RhsSelfJacobian = right_local_jacobian_t<Derived>;
     using RhsJacobian = decltype(rhs_eval.jacobian());
     using Jacobian =
       decltype(std::declval<RhsSelfJacobian>() * std::declval<RhsJacobian>());
@@ -228,10 +199,7 @@ struct TypedJacobianEvaluator<
                                               const Target &target)
         : evaluator{evaluator},
           rhs_eval{evaluator.rhs_eval, target},
-          rhs_jac{rightJacobianImpl(get_expr_tag_t<Derived>{},
-                                    this->evaluator(),
-                                    this->evaluator.lhs_eval(),
-                                    this->evaluator.rhs_eval())},
+          rhs_jac{localRightJacobian(this->evaluator)},
           jac{rhs_jac * this->rhs_eval.jacobian()} {}
 
 
@@ -301,55 +269,6 @@ WAVE_STRONG_INLINE auto evaluateWithTypedJacobians(
         .jacobian()...);
 }
 
-/** Evaluate one Jacobian of an expression, using forward-mode AD.
- *
- * Either TypedJacobianEvaluator or untyped JacobianEvaluator is used, depending on
- * whether the expression is a tree with unique types.
- *
- * @note this also calculates the value and discards it
- */
-template <typename Derived,
-          typename TargetDerived,
-          tmp::enable_if_t<unique_leaves_t<Derived>{}, int> = 0>
-auto evaluateJacobianAuto(const ExpressionBase<Derived> &expr,
-                          const ExpressionBase<TargetDerived> &target)
-  -> jacobian_t<Derived, TargetDerived> {
-    return evaluateTypedJacobian(expr.derived(), target.derived());
-}
-
-template <typename Derived,
-          typename TargetDerived,
-          tmp::enable_if_t<!unique_leaves_t<Derived>{}, int> = 0>
-auto evaluateJacobianAuto(const ExpressionBase<Derived> &expr,
-                          const ExpressionBase<TargetDerived> &target)
-  -> jacobian_t<Derived, TargetDerived> {
-    return evaluateJacobian(expr.derived(), target.derived());
-}
-
-/** Evaluate the result of an expression tree and any number of jacobians
- *
- * Either TypedJacobianEvaluator or untyped JacobianEvaluator is used, depending on
- * whether the expression is a tree with unique types.
- */
-template <typename Derived,
-          typename... Targets,
-          tmp::enable_if_t<unique_leaves_t<Derived>{}, int> = 0>
-auto evaluateWithJacobiansAuto(const ExpressionBase<Derived> &expr,
-                               const ExpressionBase<Targets> &... targets)
-  -> std::tuple<plain_output_t<Derived>, jacobian_t<Derived, Targets>...> {
-    return evaluateWithTypedJacobians(expr.derived(), targets.derived()...);
-}
-
-template <typename Derived,
-          typename... Targets,
-          tmp::enable_if_t<!unique_leaves_t<Derived>{}, int> = 0>
-auto evaluateWithJacobiansAuto(const ExpressionBase<Derived> &expr,
-                               const ExpressionBase<Targets> &... targets)
-  -> std::tuple<plain_output_t<Derived>, jacobian_t<Derived, Targets>...> {
-    return evaluateWithJacobians(expr.derived(), targets.derived()...);
-}
-
-
 }  // namespace internal
 }  // namespace wave
 
@@ -0,0 +1,100 @@
+/**
+ * @file
+ */
+
+#ifndef WAVE_GEOMETRY_CONSTANT_HPP
+#define WAVE_GEOMETRY_CONSTANT_HPP
+
+namespace wave {
+
+/** Wraps a leaf expression which is never differentiated, such as a measurement.
+ *
+ * Constant is itself a leaf expression with the same evaluation behaviour as Leaf. It
+ * differs only in jacobians: the jacobian with respect to a Constant is zero, and this is
+ * known at compile time. No jacobian-evaluator finds the local jacobian of a parent with
+ * respect to a Constant, or with respect to a subexpression whose leaves are all
+ * Constant, and the reverse-mode sweep propagates no adjoint into them:
+ *
+ *     const auto meas = constant(meas_Rij);
+ *     const auto res = log(inverse(meas) * inverse(R_i) * R_j).evalWithJacobians();
+ *
+ * gives the jacobians w.r.t. R_i and R_j only. A Constant is not listed in
+ * unique_leaves_t, so the same Constant type may appear more than once.
+ *
+ * To hold a framed leaf constant, wrap the Framed leaf: Constant<Framed<Leaf, ...>>.
+ *
+ * @tparam Leaf the wrapped leaf expression, held by value
+ */
+template <typename Leaf>
+class Constant : public internal::base_tmpl_t<Leaf, Constant<Leaf>> {
+    TICK_TRAIT_CHECK(internal::is_leaf_expression<Leaf>);
+    static_assert(!std::is_reference<Leaf>{},
+                  "Template parameter to Constant cannot be a reference.");
+    static_assert(!internal::is_constant_leaf<Leaf>{} && !internal::is_shared<Leaf>{},
+                  "Constant must wrap a plain or Framed leaf");
+
+    using Tag = internal::expr<Constant::template Constant>;
+
+ public:
+    /** Forward args to the wrapped leaf's constructor */
+    template <class... Args,
+              tmp::enable_if_t<std::is_constructible<Leaf, Args...>{} &&
+                                 !(sizeof...(Args) == 1 &&
+                                   tmp::conjunction<
+                                     std::is_same<tmp::decay_t<Args>, Constant>...>{}),
+                               int> = 0>
+    explicit Constant(Args &&... args) : leaf_{std::forward<Args>(args)...} {}
+
+    // Leave default constructors and assignment operators
+    Constant(const Constant &) = default;
+    Constant(Constant &&) = default;
+    Constant &operator=(const Constant &) = default;
+    Constant &operator=(Constant &&) = default;
+
+    /** Get value() of the wrapped leaf */
+    auto value() const -> decltype(std::declval<const Leaf &>().value()) {
+        return this->leaf_.value();
+    }
+
+    /** Returns the wrapped leaf */
+    const Leaf &leaf() const noexcept {
+        return this->leaf_;
+    }
+
+ private:
+    Leaf leaf_;
+
+    // Evaluate as the wrapped leaf would
+    friend auto evalImpl(Tag, const Constant &c) -> decltype(
+      evalImpl(internal::get_expr_tag_t<Leaf>{}, std::declval<const Leaf &>())) {
+        return evalImpl(internal::get_expr_tag_t<Leaf>{}, c.leaf_);
+    }
+};
+
+namespace internal {
+
+/** Constant is a leaf with the traits of the wrapped leaf, including frames */
+template <typename Leaf>
+struct traits<Constant<Leaf>> : traits<Leaf> {
+    using Tag = expr<Constant>;
+    using PreparedType = Constant<Leaf>;
+    using EvalType = eval_t<Leaf>;
+
+    // A Constant has no jacobian, so it is not one of the leaves
+    using UniqueLeaves = has_unique_leaves_constant;
+};
+
+}  // namespace internal
+
+/** Wraps a leaf to be held constant in jacobian evaluation
+ *
+ * @see Constant
+ */
+template <typename Leaf>
+auto constant(Leaf &&leaf) -> Constant<tmp::remove_cr_t<Leaf>> {
+    return Constant<tmp::remove_cr_t<Leaf>>{std::forward<Leaf>(leaf)};
+}
+
+}  // namespace wave
+
+#endif  // WAVE_GEOMETRY_CONSTANT_HPP
@@ -33,6 +33,33 @@ auto jacobianImpl(expr<Convert, To>, const Res &, const From &) -> identity_t<Re
 };
 
 }  // namespace internal
+
+/** Converts an expression to another leaf type within an expression tree
+ *
+ * Conversions needed by an operation are normally chosen by their cost; see
+ * first_directly_evaluable_conversion_unary. Converting an operand with convertTo() fixes
+ * the conversion used instead. For example,
+ *
+ *     convertTo<RotationMd>(a1) * convertTo<RotationMd>(a2)
+ *
+ * composes angle-axis rotations as rotation matrices, rather than as quaternions.
+ *
+ * @tparam ToLeaf The leaf type to convert to, which may be Framed
+ */
+template <typename ToLeaf, typename Derived>
+auto convertTo(const ExpressionBase<Derived> &expr)
+  -> Convert<internal::eval_t<ToLeaf>, Derived> {
+    return Convert<internal::eval_t<ToLeaf>, Derived>{expr.derived()};
+}
+
+// Overload for rvalue
+template <typename ToLeaf, typename Derived>
+auto convertTo(ExpressionBase<Derived> &&expr)
+  -> Convert<internal::eval_t<ToLeaf>, internal::arg_t<Derived>> {
+    return Convert<internal::eval_t<ToLeaf>, internal::arg_t<Derived>>{
+      std::move(expr).derived()};
+}
+
 }  // namespace wave
 
 #endif  // WAVE_GEOMETRY_CONVERT_HPP
@@ -0,0 +1,102 @@
+/**
+ * @file
+ */
+
+#ifndef WAVE_GEOMETRY_SHARED_HPP
+#define WAVE_GEOMETRY_SHARED_HPP
+
+namespace wave {
+
+/** A subexpression which is evaluated once and may be used by several parents.
+ *
+ * Expressions are trees, so a subexpression used twice, as in `log(A * B)` and
+ * `(A * B) * p`, is normally evaluated twice. Shared binds a name to it instead:
+ *
+ *     const auto AB = share(A * B);
+ *     const auto res = evalMultiWithJacobians(std::forward_as_tuple(log(AB), AB * p),
+ *                                             A, B, p);
+ *
+ * The subexpression is evaluated when the Shared is constructed, and its Evaluator tree
+ * is kept. Parents refer to the Shared like any other leaf, so it must be an lvalue
+ * which outlives them; for this reason, it cannot be copied.
+ *
+ * Jacobians with respect to the leaves of the subexpression are found in reverse mode:
+ * the adjoints from all uses of the Shared are summed, then propagated into the
+ * subexpression once. A Shared is also a valid target itself.
+ *
+ * @tparam Derived the type of the shared subexpression
+ */
+template <typename Derived>
+class Shared : public internal::base_tmpl_t<Derived, Shared<Derived>> {
+    static_assert(!internal::is_leaf_expression<Derived>{},
+                  "A leaf cannot be shared; use it directly");
+
+    using Tag = internal::expr<Shared::template Shared>;
+
+ public:
+    using SubexpressionType = internal::prepared_t<Derived>;
+    using EvaluatorType = internal::Evaluator<SubexpressionType>;
+    using EvalType = internal::clean_eval_t<Derived>;
+
+    /** Evaluates the subexpression */
+    template <typename Arg,
+              TICK_REQUIRES(std::is_same<tmp::remove_cr_t<Arg>, Derived>{})>
+    explicit Shared(Arg &&expr)
+        : evaluator_{internal::prepareEvaluatorTo<internal::eval_output_t<Derived>>(
+            std::forward<Arg>(expr))} {}
+
+    Shared(Shared &&) = default;
+    Shared(const Shared &) = delete;
+    Shared &operator=(const Shared &) = delete;
+    Shared &operator=(Shared &&) = delete;
+
+    /** Get value() of the evaluated subexpression */
+    auto value() const -> decltype(std::declval<const EvalType &>().value()) {
+        return this->evaluator_().value();
+    }
+
+    /** Returns the Evaluator tree of the subexpression */
+    const EvaluatorType &evaluator() const noexcept {
+        return this->evaluator_;
+    }
+
+ private:
+    EvaluatorType evaluator_;
+
+    // Use the cached result in evaluation
+    friend auto evalImpl(Tag, const Shared &s) -> const EvalType & {
+        return s.evaluator_();
+    }
+};
+
+namespace internal {
+
+/** Shared is a leaf with the traits of its subexpression's result */
+template <typename Derived>
+struct traits<Shared<Derived>> : traits<clean_eval_t<Derived>> {
+    using Tag = expr<Shared>;
+    using PreparedType = Shared<Derived>;
+    using EvalType = clean_eval_t<Derived>;
+    using PlainType = typename traits<clean_eval_t<Derived>>::PlainType;
+
+    // Add frames, if any, as the subexpression would
+    using OutputFunctor = typename traits<Derived>::OutputFunctor;
+
+    // The leaves inside a Shared are reached only by the untyped reverse evaluator
+    using UniqueLeaves = std::false_type;
+};
+
+}  // namespace internal
+
+/** Evaluates an expression once, for use in several other expressions
+ *
+ * @see Shared
+ */
+template <typename Derived>
+auto share(Derived &&expr) -> Shared<tmp::remove_cr_t<Derived>> {
+    return Shared<tmp::remove_cr_t<Derived>>{std::forward<Derived>(expr)};
+}
+
+}  // namespace wave
+
+#endif  // WAVE_GEOMETRY_SHARED_HPP
@@ -0,0 +1,121 @@
+/**
+ * @file
+ */
+
+#ifndef WAVE_GEOMETRY_STRIDEDVIEW_HPP
+#define WAVE_GEOMETRY_STRIDEDVIEW_HPP
+
+#include <cassert>
+#include <cstddef>
+
+namespace wave {
+namespace internal {
+
+/** The Eigen::Map type an element of StridedView<T> is made from
+ *
+ * This is T itself if T is an Eigen::Map, or the ImplType of T if T is a leaf expression
+ * (including Framed) stored as a Map.
+ */
+template <typename T, typename Enable = void>
+struct strided_element_map {
+    using type = T;
+};
+
+template <typename T>
+struct strided_element_map<T, tmp::enable_if_t<is_expression<T>{}>> {
+    using type = typename traits<T>::ImplType;
+};
+
+/** The pointer type and number of coefficients of an Eigen::Map type */
+template <typename MapType>
+struct strided_map_traits {
+    using Pointer = typename MapType::PointerType;
+    static constexpr int Size = MapType::SizeAtCompileTime;
+};
+
+// Eigen::Map<Quaternion> is not a MapBase, so it uses its coefficients instead
+template <typename Scalar, int Options, int MapOptions>
+struct strided_map_traits<Eigen::Map<Eigen::Quaternion<Scalar, Options>, MapOptions>>
+  : strided_map_traits<Eigen::Map<Eigen::Matrix<Scalar, 4, 1>>> {};
+
+template <typename Scalar, int Options, int MapOptions>
+struct strided_map_traits<
+  Eigen::Map<const Eigen::Quaternion<Scalar, Options>, MapOptions>>
+  : strided_map_traits<Eigen::Map<const Eigen::Matrix<Scalar, 4, 1>>> {};
+
+}  // namespace internal
+
+/** A range of objects referring to an external array of scalars, with a given stride
+ *
+ * Element i is made from an Eigen::Map of the coefficients starting at
+ * `data + i * stride`. Since the elements refer to the external memory, expressions can
+ * read it and results can be assigned to it without copies. For example,
+ *
+ *     StridedView<RigidTransformLayoutMapd<Layout>> poses{ptr, n, 10};
+ *
+ * views n poses whose 7 coefficients are followed by 3 unrelated scalars.
+ *
+ * A StridedView can be used as an input range, or output range, of
+ * evalBatchWithJacobiansTo(). Outputs are not resized, so a view must already have the
+ * length of the inputs.
+ *
+ * @tparam T The element type: a fixed-size Eigen::Map (e.g. of a jacobian matrix), or
+ * a leaf expression, optionally Framed, whose ImplType is one
+ */
+template <typename T>
+class StridedView {
+    using MapType = typename internal::strided_element_map<T>::type;
+    using MapTraits = internal::strided_map_traits<MapType>;
+
+ public:
+    using Pointer = typename MapTraits::Pointer;
+    using value_type = T;
+
+    /** Views `size` elements starting at `data`, `stride` scalars apart
+     *
+     * By default the elements are packed, with no gaps between them.
+     */
+    StridedView(Pointer data, std::size_t size, std::ptrdiff_t stride = MapTraits::Size)
+        : data_{data}, size_{size}, stride_{stride} {
+        assert(stride >= MapTraits::Size && "Elements of a StridedView cannot overlap");
+    }
+
+    /** Returns an object referring to element i
+     *
+     * Though returned by value, the object refers to the viewed memory, and assigning to
+     * it writes there.
+     */
+    T operator[](std::size_t i) const {
+        return T{MapType{data_ + static_cast<std::ptrdiff_t>(i) * stride_}};
+    }
+
+    /** Returns the number of elements */
+    std::size_t size() const noexcept {
+        return size_;
+    }
+
+    /** Returns the distance between the first scalars of consecutive elements */
+    std::ptrdiff_t stride() const noexcept {
+        return stride_;
+    }
+
+    /** Returns a pointer to the first viewed scalar */
+    Pointer data() const noexcept {
+        return data_;
+    }
+
+    /** Checks the view has length n, since it cannot be resized */
+    void resize(std::size_t n) const noexcept {
+        assert(n == size_ && "A StridedView cannot be resized");
+        (void) n;
+    }
+
+ private:
+    Pointer data_;
+    std::size_t size_;
+    std::ptrdiff_t stride_;
+};
+
+}  // namespace wave
+
+#endif  // WAVE_GEOMETRY_STRIDEDVIEW_HPP
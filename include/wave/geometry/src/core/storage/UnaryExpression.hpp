@@ -21,7 +21,7 @@ struct UnaryExpressionBase {
     // Disable if copy ctor would apply - https://stackoverflow.com/a/39646176
     template <class Arg,
               tmp::enable_if_t<!std::is_same<tmp::decay_t<Arg>, Derived>{} &&
-                                 std::is_constructible<RhsDerived, Arg &&>{},
+                                 std::is_constructible<RhsStore, Arg &&>{},
                                int> = 0>
     explicit UnaryExpressionBase(Arg &&arg) : rhs_{std::forward<Arg>(arg)} {}
 
@@ -95,8 +95,8 @@ struct binary_traits_base<Tmpl<LhsDerived_, RhsDerived_>> {
       rebind,
       LhsPrepared,
       RhsPrepared,
-      typename traits<LhsEval>::ConvertTo,
-      typename traits<RhsEval>::ConvertTo>::type;
+      operand_convert_to_t<LhsPrepared>,
+      operand_convert_to_t<RhsPrepared>>::type;
 
     using ConvertedTraits = traits_safe_t<ConvertedType, This, binary_traits_base>;
     using ConvertedLhs = typename ConvertedTraits::LhsDerived;
@@ -146,7 +146,7 @@ struct unary_traits_base<Tmpl<RhsDerived_>> {
       Tag,
       rebind,
       RhsPrepared,
-      typename traits<RhsEval>::ConvertTo>::type;
+      operand_convert_to_t<RhsPrepared>>::type;
 
     using ConvertedRhs =
       typename traits_safe_t<ConvertedType, This, unary_traits_base>::RhsDerived;
@@ -190,7 +190,7 @@ struct unary_traits_base_tag<Tmpl<Aux, RhsDerived_>, Tag_> {
       Tag,
       rebind,
       RhsPrepared,
-      typename traits<RhsEval>::ConvertTo>::type;
+      operand_convert_to_t<RhsPrepared>>::type;
 
     using ConvertedRhs =
       typename traits_safe_t<ConvertedType, This, unary_traits_base_tag>::RhsDerived;
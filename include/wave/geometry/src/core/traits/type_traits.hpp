@@ -158,6 +158,42 @@ using enable_if_leaf_or_nullary_t =
                             is_nullary_expression<Derived>{},
                           T>::type;
 
+/** Determines whether T is a Shared subexpression */
+template <typename T>
+struct is_shared : std::false_type {};
+
+template <typename Derived>
+struct is_shared<Shared<Derived>> : std::true_type {};
+
+/** Determines whether T is a Constant leaf */
+template <typename T>
+struct is_constant_leaf : std::false_type {};
+
+template <typename Leaf>
+struct is_constant_leaf<Constant<Leaf>> : std::true_type {};
+
+template <typename T>
+struct is_constant_leaf<const T> : is_constant_leaf<T> {};
+
+template <typename T>
+struct is_constant_leaf<T &> : is_constant_leaf<T> {};
+
+template <typename T>
+struct is_constant_leaf<T &&> : is_constant_leaf<T> {};
+
+/** Determines whether all leaves of an expression are Constant, so that no jacobian is
+ * found through it */
+template <typename Derived, typename Enable = void>
+struct is_constant_expression : is_constant_leaf<Derived> {};
+
+template <typename Derived>
+struct is_constant_expression<Derived, enable_if_unary_t<Derived>>
+  : is_constant_expression<typename traits<Derived>::RhsDerived> {};
+
+template <typename Derived>
+struct is_constant_expression<Derived, enable_if_binary_t<Derived>>
+  : tmp::bool_constant<is_constant_expression<typename traits<Derived>::LhsDerived>{} &&
+                       is_constant_expression<typename traits<Derived>::RhsDerived>{}> {};
 
 /** Empty tag of an expression template for tag dispatching */
 template <template <typename...> class Tmpl, typename... Aux>
@@ -245,6 +281,12 @@ using rjacobian_t = jacobian_t<Derived, typename traits<Derived>::RhsDerived>;
 template <typename Derived>
 using identity_t = IdentityMatrix<scalar_t<Derived>, eval_traits<Derived>::TangentSize>;
 
+/** Helper alias for zero jacobian type of one expression wrt another */
+template <typename Derived, typename WrtDerived>
+using zero_t = ZeroMatrix<scalar_t<Derived>,
+                          eval_traits<Derived>::TangentSize,
+                          eval_traits<WrtDerived>::TangentSize>;
+
 //
 // Eval type helpers for incomplete types
 //
@@ -352,6 +394,15 @@ struct has_unique_leaves_leaf : std::true_type {
     using type = tmp::type_list<Derived>;
 };
 
+/** Determines whether a Constant leaf has unique types.
+ *
+ * This is trivially true. A Constant has no jacobian, so it is not listed in `type`, and
+ * the same Constant type may appear more than once in an expression.
+ */
+struct has_unique_leaves_constant : std::true_type {
+    using type = tmp::type_list<>;
+};
+
 /** Determines whether a unary expression has unique types.
  *
  * Can be used for an incomplete type Derived, as long as traits are complete.
@@ -198,7 +198,8 @@ auto evaluateNumericalJacobian(const ExpressionBase<Derived> &expr,
                                const ExpressionBase<TargetDerived> &target)
   -> internal::jacobian_t<Derived, TargetDerived> {
     using OutputType = internal::plain_output_t<Derived>;
-    const auto &v_eval = internal::prepareEvaluatorTo<OutputType>(expr.derived());
+    const auto &v_eval =
+      internal::prepareEvaluatorTo<OutputType, internal::RewriteNone>(expr.derived());
 
     return internal::evaluateNumericalJacobianImpl(v_eval, target.derived());
 }
@@ -217,7 +218,8 @@ auto evaluateNumericalJacobians(const ExpressionBase<Derived> &expr,
   -> std::tuple<internal::jacobian_t<Derived, Targets>...> {
     // Get the correct evaluator
     using OutputType = internal::plain_output_t<Derived>;
-    const auto &v_eval = internal::prepareEvaluatorTo<OutputType>(expr.derived());
+    const auto &v_eval =
+      internal::prepareEvaluatorTo<OutputType, internal::RewriteNone>(expr.derived());
 
     return std::make_tuple(
       internal::evaluateNumericalJacobianImpl(v_eval, targets.derived())...);
@@ -0,0 +1,73 @@
+/**
+ * @file
+ */
+
+#ifndef WAVE_GEOMETRY_BATCHBASE_HPP
+#define WAVE_GEOMETRY_BATCHBASE_HPP
+
+namespace wave {
+namespace internal {
+
+/** Base for traits of a batch leaf expression.
+ *
+ * A batch leaf holds many objects of the same kind (its ElementType) in
+ * structure-of-arrays layout: an Eigen N*K array with one column per coefficient of the
+ * element. Each column is contiguous, so operations written as coefficient-wise array
+ * expressions over the columns are vectorized by Eigen across the whole batch, using
+ * the widest packets enabled at compile time (e.g. AVX2 or AVX-512 with -march=native).
+ *
+ * Frame descriptors are attached once per batch with Framed, so frames are checked at
+ * compile time as for single leaves.
+ *
+ * Batch leaves support evaluation only. Jacobians are not implemented.
+ */
+template <typename Derived>
+struct batch_leaf_traits_base;
+
+template <template <typename...> class Tmpl, typename ImplType_>
+struct batch_leaf_traits_base<Tmpl<ImplType_>> : leaf_traits_base<Tmpl<ImplType_>> {
+    template <typename NewImplType>
+    using rebind = Tmpl<NewImplType>;
+
+    using ImplType = ImplType_;
+    using Scalar = typename ImplType::Scalar;
+    using PlainType = Tmpl<typename ImplType::PlainObject>;
+
+    // Evaluate batches by reference, to avoid copying every lane of a leaf into the
+    // evaluator tree
+    using EvalType = const Tmpl<ImplType_> &;
+};
+
+/** Gives size(), get() and set() element access to Framed<> versions of batches.
+ *
+ * The elements returned and accepted have the same frames as the batch.
+ */
+template <typename Leaf, typename... Frames>
+struct FramedLeafAccess<Framed<Leaf, Frames...>,
+                        TICK_CLASS_REQUIRES(internal::is_batch_leaf<Leaf>{})>
+  : FramedLeafAccessBase<Framed<Leaf, Frames...>> {
+    using ElementType = typename traits<Leaf>::ElementType;
+    using FramedElementType =
+      typename internal::add_frames<Frames...>::template to<ElementType>;
+
+ public:
+    /** Returns the number of elements in the batch */
+    Eigen::Index size() const noexcept {
+        return this->leaf().size();
+    }
+
+    /** Returns a copy of the i'th element of the batch */
+    auto get(Eigen::Index i) const -> FramedElementType {
+        return internal::WrapWithFrames<Frames...>{}(this->leaf().get(i));
+    }
+
+    /** Sets the i'th element of the batch */
+    void set(Eigen::Index i, const FramedElementType &element) {
+        this->leaf().set(i, ElementType{element.value()});
+    }
+};
+
+}  // namespace internal
+}  // namespace wave
+
+#endif  // WAVE_GEOMETRY_BATCHBASE_HPP
@@ -43,6 +43,20 @@ auto operator*(RigidTransformBase<L> &&lhs, TranslationBase<R> &&rhs)
                                                              std::move(rhs).derived()};
 }
 
+/** Takes the adjoint of a rigid transform, to be applied to a twist
+ *
+ * `adjoint(T) * xi` gives an AdjointAction. The adjoint is never formed as a matrix.
+ */
+template <typename L>
+auto adjoint(const RigidTransformBase<L> &lhs) -> AdjointOf<L> {
+    return AdjointOf<L>{lhs.derived()};
+}
+// Overload for rvalue
+template <typename L>
+auto adjoint(RigidTransformBase<L> &&lhs) -> AdjointOf<internal::arg_t<L>> {
+    return AdjointOf<internal::arg_t<L>>{std::move(lhs).derived()};
+}
+
 
 namespace internal {
 
@@ -90,23 +104,13 @@ auto evalImpl(expr<Inverse>, const RigidTransformBase<Rhs> &rhs) -> plain_eval_t
 template <typename Val, typename Rhs>
 auto jacobianImpl(expr<Inverse>,
                   const RigidTransformBase<Val> &val,
-                  const RigidTransformBase<Rhs> &) -> jacobian_t<Val, Rhs> {
-    using Scalar = scalar_t<Val>;
-    using Mat3 = Eigen::Matrix<Scalar, 3, 3>;
-
+                  const RigidTransformBase<Rhs> &)
+  -> BlockLowerTriangular<scalar_t<Val>, 3> {
     // The derivative of the inverse can be found by applying the adjoint identity
     // (see http://ethaneade.com/lie.pdf) to be negative adjoint of the inverted SE(3)
-    // @todo factor out adjoint
-    const auto &R = Mat3{val.derived().rotation().value()};
-    const auto &t = val.derived().translation().value();
-    jacobian_t<Val, Rhs> adj{};
-
-    adj.template topLeftCorner<3, 3>() = R;
-    adj.template bottomLeftCorner<3, 3>() = crossMatrix(t) * R;
-    adj.template topRightCorner<3, 3>().setZero();
-    adj.template bottomRightCorner<3, 3>() = R;
-
-    return -adj;
+    using Mat3 = Eigen::Matrix<scalar_t<Val>, 3, 3>;
+    return -adjointMatrix(Mat3{val.derived().rotation().value()},
+                          val.derived().translation().value());
 }
 
 /** Implementation of Compose for any rigid transform
@@ -147,6 +151,21 @@ auto rightJacobianImpl(expr<Compose>,
     return out;
 }
 
+/** Jacobian of Compose wrt the rhs, when the lhs is a rigid transform
+ *
+ * This is the adjoint of the lhs, kept as its rotation and translation.
+ */
+template <typename Val, typename Lhs, typename Rhs>
+auto rightJacobianImpl(expr<Compose>,
+                       const TransformBase<Val> &,
+                       const RigidTransformBase<Lhs> &lhs,
+                       const TransformBase<Rhs> &) -> AdjointMatrix<scalar_t<Val>> {
+    // From http://ethaneade.com/lie.pdf - note we swap order of rotation and translation
+    using Mat3 = Eigen::Matrix<scalar_t<Val>, 3, 3>;
+    return adjointMatrix(Mat3{lhs.derived().rotation().value()},
+                         lhs.derived().translation().value());
+}
+
 /** Implements Transform for any rigid transform
  *
  * More efficient implementations may be available for specific types (e.g. 4x4 matrix)
@@ -181,86 +200,173 @@ auto rightJacobianImpl(expr<Transform>,
     return jacobian_t<Val, Rhs>{lhs.derived().rotation().value()};
 }
 
-/** Implementation of LogMap for any rigid transform
- */
-template <typename Rhs>
-auto evalImpl(expr<LogMap>, const RigidTransformBase<Rhs> &rhs) ->
-  typename traits<Rhs>::TangentType {
+/** Implements AdjointAction for any rigid transform and twist */
+template <typename Lhs, typename Rhs>
+auto evalImpl(expr<AdjointAction>,
+              const RigidTransformBase<Lhs> &lhs,
+              const TwistBase<Rhs> &rhs) -> plain_eval_t<Rhs> {
     using Scalar = scalar_t<Rhs>;
-    using Vec3 = Eigen::Matrix<Scalar, 3, 1>;
     using Mat3 = Eigen::Matrix<Scalar, 3, 3>;
+    using Vec3 = Eigen::Matrix<Scalar, 3, 1>;
 
-    // Logmap of rotation part: delegate to RelativeRotation code
-    const Vec3 omega = eval(log(rhs.derived().rotation())).value();
+    const Mat3 R{lhs.derived().rotation().value()};
+    const Vec3 w = R * rhs.derived().rotation().value();
+    const Vec3 v = lhs.derived().translation().value().cross(w) +
+                   R * rhs.derived().translation().value();
+    return plain_eval_t<Rhs>{w, v};
+}
 
-    // Logmap of translation part: not trivial (see http://ethaneade.com/lie.pdf)
-    // @todo optimize
-    Vec3 ln_t;
-    const auto theta2 = omega.squaredNorm();
-    const auto theta = std::sqrt(theta2);
-    if (theta2 > Eigen::NumTraits<Scalar>::epsilon()) {
-        const auto A = std::sin(theta) / theta;
-        const auto B = (1 - std::cos(theta)) / theta2;
-        const Mat3 cross = crossMatrix(omega);
-        const Mat3 cross2 = cross * cross;
+/** Jacobian of AdjointAction wrt the transform
+ *
+ * For the result (w, v), this is the negative of the adjoint of se(3) at the result,
+ * whose upper-right block is zero.
+ */
+template <typename Val, typename Lhs, typename Rhs>
+auto leftJacobianImpl(expr<AdjointAction>,
+                      const TwistBase<Val> &val,
+                      const RigidTransformBase<Lhs> &,
+                      const TwistBase<Rhs> &) -> BlockLowerTriangular<scalar_t<Val>, 3> {
+    using Mat3 = Eigen::Matrix<scalar_t<Val>, 3, 3>;
+    const Mat3 w_cross = crossMatrix(-val.derived().rotation().value());
+    const Mat3 v_cross = crossMatrix(-val.derived().translation().value());
+    return BlockLowerTriangular<scalar_t<Val>, 3>{w_cross, v_cross, w_cross};
+}
 
-        const Mat3 Vinv =
-          Mat3::Identity() - cross / 2 + (1 - A / 2 / B) / theta2 * cross2;
+/** Jacobian of AdjointAction wrt the twist is the adjoint of the transform */
+template <typename Val, typename Lhs, typename Rhs>
+auto rightJacobianImpl(expr<AdjointAction>,
+                       const TwistBase<Val> &,
+                       const RigidTransformBase<Lhs> &lhs,
+                       const TwistBase<Rhs> &) -> AdjointMatrix<scalar_t<Val>> {
+    using Mat3 = Eigen::Matrix<scalar_t<Val>, 3, 3>;
+    return adjointMatrix(Mat3{lhs.derived().rotation().value()},
+                         lhs.derived().translation().value());
+}
 
-        ln_t = Vinv * rhs.derived().translation().value();
+/** Eade's "B" term of the jacobians of the SE(3) exp and log maps
+ *
+ * See http://ethaneade.org/exp_diff.pdf. The coefficients use the angle of the rotation
+ * part omega, kept by evalWithAuxImpl(), so no transcendental functions are called.
+ */
+template <typename VecDerived, typename VecDerived2>
+auto twistCouplingTerm(const Eigen::MatrixBase<VecDerived> &omega,
+                       const Eigen::MatrixBase<VecDerived2> &u,
+                       const RotationAngleAux<typename VecDerived::Scalar> &aux)
+  -> Eigen::Matrix<typename VecDerived::Scalar, 3, 3> {
+    using Scalar = typename VecDerived::Scalar;
+    using Mat3 = Eigen::Matrix<Scalar, 3, 3>;
+    const Scalar theta2 = aux.angle2;
+    const Scalar a = aux.sin_angle / aux.angle;
+    const Scalar b = (Scalar{1} - aux.cos_angle) / theta2;
+    const Scalar c = (Scalar{1} - a) / theta2;
+
+    // For small angles, where these lose digits, use Taylor expansions. The W terms are
+    // divided by theta^4, so they switch to their series at a larger angle.
+    const auto large = laneGreater(theta2, taylorThreshold<1, Scalar>());
+    const Scalar b_ = laneSelect(
+      large,
+      b,
+      Scalar{Scalar{0.5} - theta2 * (Scalar{1.0 / 24} - theta2 * Scalar{1.0 / 720})});
+    const Scalar c_ = laneSelect(
+      large,
+      c,
+      Scalar{Scalar{1.0 / 6} -
+             theta2 * (Scalar{1.0 / 120} - theta2 * Scalar{1.0 / 5040})});
+    const auto large_w = laneGreater(theta2, taylorThreshold<2, Scalar>());
+    const Scalar w1 = laneSelect(
+      large_w,
+      Scalar{(a - 2 * b) / theta2},
+      Scalar{-Scalar{1.0 / 12} +
+             theta2 * (Scalar{1.0 / 180} - theta2 * Scalar{1.0 / 6720})});
+    const Scalar w2 = laneSelect(
+      large_w,
+      Scalar{(b - 3 * c) / theta2},
+      Scalar{-Scalar{1.0 / 60} +
+             theta2 * (Scalar{1.0 / 1260} - theta2 * Scalar{1.0 / 60480})});
 
-    } else {
-        // small theta2; use limit as theta -> 0
-        // @todo: use Taylor series, not just the limit!
-        const Mat3 cross = crossMatrix(omega);
+    // Calculate Eade's "W" term
+    const Mat3 W = (c_ - b_) * Mat3::Identity() + w1 * crossMatrix(omega) +
+                   w2 * omega * omega.transpose();
 
-        const Mat3 Vinv = Mat3::Identity() - cross / 2;
+    return b_ * crossMatrix(u) + c_ * (omega * u.transpose() + u * omega.transpose()) +
+           omega.dot(u) * W;
+}
 
-        ln_t = Vinv * rhs.derived().translation().value();
-    }
-    return typename traits<Rhs>::TangentType{omega, ln_t};
+/** Implementation of LogMap for any rigid transform, keeping the angle for the jacobian
+ */
+template <typename Rhs>
+auto evalWithAuxImpl(expr<LogMap>, const RigidTransformBase<Rhs> &rhs)
+  -> EvalWithAux<typename traits<Rhs>::TangentType, RotationAngleAux<scalar_t<Rhs>>> {
+    using Scalar = scalar_t<Rhs>;
+    using Vec3 = Eigen::Matrix<Scalar, 3, 1>;
+    using Mat3 = Eigen::Matrix<Scalar, 3, 3>;
+
+    // Logmap of rotation part: delegate to the rotation code, which gives the angle
+    const auto rot_log = evalWithAuxImpl(expr<LogMap>{}, rhs.derived().rotation());
+    const Vec3 omega = rot_log.value.value();
+    const auto &aux = rot_log.aux;
+
+    // Logmap of translation part: not trivial (see http://ethaneade.com/lie.pdf)
+    const Scalar theta2 = aux.angle2;
+    const Scalar A = aux.sin_angle / aux.angle;
+    const Scalar B = (1 - aux.cos_angle) / theta2;
+
+    // For small angles, use the Taylor expansion of D, which loses about eps / theta^4 to
+    // cancellation. It is the same coefficient as in the rotation log jacobian.
+    const auto large = laneGreater(theta2, taylorThreshold<2, Scalar>());
+    const Scalar D = laneSelect(
+      large,
+      Scalar{(1 - A / 2 / B) / theta2},
+      Scalar{Scalar{1.0 / 12} +
+             theta2 * (Scalar{1.0 / 720} + theta2 * Scalar{1.0 / 30240})});
+
+    const auto cross = crossMatrix(omega);
+    const Mat3 cross2 = cross * cross;
+    const Mat3 Vinv = Mat3::Identity() - cross / 2 + D * cross2;
+    const Vec3 ln_t = Vinv * rhs.derived().translation().value();
+    return {typename traits<Rhs>::TangentType{omega, ln_t}, aux};
 }
 
-/** Jacobian of LogMap for any rigid transform */
+/** Implementation of LogMap for any rigid transform
+ */
+template <typename Rhs>
+auto evalImpl(expr<LogMap>, const RigidTransformBase<Rhs> &rhs) ->
+  typename traits<Rhs>::TangentType {
+    return evalWithAuxImpl(expr<LogMap>{}, rhs).value;
+}
+
+/** Jacobian of LogMap for any rigid transform, given the angle kept by
+ * evalWithAuxImpl() */
 template <typename Val, typename Rhs>
 auto jacobianImpl(expr<LogMap>,
                   const TwistBase<Val> &val,
-                  const RigidTransformBase<Rhs> &rhs) -> jacobian_t<Val, Rhs> {
+                  const RotationAngleAux<scalar_t<Rhs>> &aux,
+                  const RigidTransformBase<Rhs> &rhs)
+  -> BlockLowerTriangular<scalar_t<Val>, 3> {
     using Scalar = scalar_t<Val>;
     using Mat3 = Eigen::Matrix<Scalar, 3, 3>;
 
     // From http://ethaneade.org/exp_diff.pdf - note we swap order of rotation and
     // translation
 
-    using std::cos;
-    using std::sin;
     // First get Jacobian of logmap of rotation part only
-    const auto &Drot =
-      jacobianImpl(expr<LogMap>{}, val.derived().rotation(), rhs.derived().rotation());
-
-    const auto &omega = val.derived().rotation().value();
-    const auto &u = val.derived().translation().value();
-    const auto theta2 = omega.squaredNorm();
-    const auto theta = sqrt(theta2);
-    const auto a = sin(theta) / theta;
-    const auto b = (1 - cos(theta)) / theta2;
-    const auto c = (1 - a) / theta2;
-    // Calculate Eade's "W" term
-    const Mat3 W = (c - b) * Mat3::Identity() +
-                   (a - 2 * b) / theta2 * crossMatrix(omega) +
-                   (b - 3 * c) / theta2 * omega * omega.transpose();
-
-    // Calculate Eade's "B" term
-    const Mat3 B = b * crossMatrix(u) +
-                   c * (omega * u.transpose() + u * omega.transpose()) + omega.dot(u) * W;
+    const Mat3 Drot = jacobianImpl(
+      expr<LogMap>{}, val.derived().rotation(), aux, rhs.derived().rotation());
+    const Mat3 B = twistCouplingTerm(
+      val.derived().rotation().value(), val.derived().translation().value(), aux);
 
+    // R wrt R, t wrt R, and t wrt t. R does not depend on t.
+    return BlockLowerTriangular<Scalar, 3>{Drot, Mat3{-Drot * B * Drot}, Drot};
+}
 
-    Eigen::Matrix<Scalar, 6, 6> out{};
-    out.template topLeftCorner<3, 3>() = Drot;                 // R wrt R
-    out.template bottomLeftCorner<3, 3>() = -Drot * B * Drot;  // t wrt R
-    out.template topRightCorner<3, 3>().setZero();             // R wrt t
-    out.template bottomRightCorner<3, 3>() = Drot;             // t wrt t
-    return out;
+/** Jacobian of LogMap for any rigid transform */
+template <typename Val, typename Rhs>
+auto jacobianImpl(expr<LogMap>,
+                  const TwistBase<Val> &val,
+                  const RigidTransformBase<Rhs> &rhs)
+  -> BlockLowerTriangular<scalar_t<Val>, 3> {
+    return jacobianImpl(
+      expr<LogMap>{}, val, rotationAngleAux(val.derived().rotation().value()), rhs);
 }
 
 
@@ -92,6 +92,60 @@ struct rotation_leaf_traits_base<Tmpl<ImplType_>> : leaf_traits_base<Tmpl<ImplTy
     // AngleAxis nowhere
 };
 
+/** Intermediates of an SO(3) or SE(3) exp or log map, kept for its jacobian
+ *
+ * These are the angle of the rotation, and its sine and cosine. See EvalWithAux.
+ */
+template <typename Scalar>
+struct RotationAngleAux {
+    Scalar angle2;  // squared angle
+    Scalar angle;
+    Scalar sin_angle;
+    Scalar cos_angle;
+};
+
+/** Finds RotationAngleAux from a rotation vector, for a jacobian called without it */
+template <typename VecDerived>
+auto rotationAngleAux(const Eigen::MatrixBase<VecDerived> &phi)
+  -> RotationAngleAux<typename VecDerived::Scalar> {
+    using Scalar = typename VecDerived::Scalar;
+    using std::sqrt;
+    RotationAngleAux<Scalar> aux;
+    aux.angle2 = phi.squaredNorm();
+    aux.angle = sqrt(aux.angle2);
+    sinCos(aux.angle, aux.sin_angle, aux.cos_angle);
+    return aux;
+}
+
+/** Returns I + A [r]x + B [r]x^2, the form of the Rodrigues formula and of the left
+ * jacobian of SO(3), given the squared norm angle2 of r
+ *
+ * The square of the cross matrix is r r^T - angle2 I, so each entry is found directly,
+ * without the 3x3 matrix product.
+ */
+template <typename VecDerived>
+WAVE_STRONG_INLINE auto rodriguesMatrix(const Eigen::MatrixBase<VecDerived> &r,
+                                        const typename VecDerived::Scalar &angle2,
+                                        const typename VecDerived::Scalar &A,
+                                        const typename VecDerived::Scalar &B)
+  -> Eigen::Matrix<typename VecDerived::Scalar, 3, 3> {
+    using Scalar = typename VecDerived::Scalar;
+    const Eigen::Matrix<Scalar, 3, 1> a = A * r;
+    const Eigen::Matrix<Scalar, 3, 1> b = B * r;
+    const Scalar diag = Scalar{1} - B * angle2;
+    Eigen::Matrix<Scalar, 3, 3> m;
+    m(0, 0) = diag + b.x() * r.x();
+    m(1, 1) = diag + b.y() * r.y();
+    m(2, 2) = diag + b.z() * r.z();
+    m(0, 1) = b.x() * r.y() - a.z();
+    m(1, 0) = b.x() * r.y() + a.z();
+    m(0, 2) = b.x() * r.z() + a.y();
+    m(2, 0) = b.x() * r.z() - a.y();
+    m(1, 2) = b.y() * r.z() - a.x();
+    m(2, 1) = b.y() * r.z() + a.x();
+    return m;
+}
+
 /** Implementation of Random for a rotation leaf
  *
  * Produces a random rotation on SO(3), constructing it from a quaternion
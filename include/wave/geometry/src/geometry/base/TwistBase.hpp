@@ -31,5 +31,21 @@ template <typename Rhs>
 auto inverse(TwistBase<Rhs> &&rhs) -> ExpMap<internal::arg_t<Rhs>> {
     return ExpMap<internal::arg_t<Rhs>>{std::move(rhs).derived()};
 }
+
+/** Applies the adjoint of a rigid transform to an se(3) element
+ *
+ * @see adjoint()
+ */
+template <typename L, typename R>
+auto operator*(AdjointOf<L> &&lhs, const TwistBase<R> &rhs) -> AdjointAction<L, R> {
+    return AdjointAction<L, R>{std::move(lhs.lhs_), rhs.derived()};
+}
+// Overload for rvalue
+template <typename L, typename R>
+auto operator*(AdjointOf<L> &&lhs, TwistBase<R> &&rhs)
+  -> AdjointAction<L, internal::arg_t<R>> {
+    return AdjointAction<L, internal::arg_t<R>>{std::move(lhs.lhs_),
+                                                std::move(rhs).derived()};
+}
 }  // namespace wave
 #endif  // WAVE_GEOMETRY_TWISTBASE_HPP
@@ -35,15 +35,27 @@ struct Transform;
 template <typename Lhs, typename Rhs>
 struct Compose;
 
+template <typename Lhs>
+struct AdjointOf;
+
+template <typename Lhs, typename Rhs>
+struct AdjointAction;
+
 template <typename Lhs, typename Rhs>
 struct ComposeFlipped;
 
+template <typename Lhs, typename Rhs>
+struct InverseCompose;
+
 template <typename Rhs>
 struct Inverse;
 
 template <typename Rhs>
 struct ExpMap;
 
+template <typename ToLeaf, typename Rhs>
+struct ExpMapTo;
+
 template <typename Rhs, typename ExtraFrame>
 struct LogMap;
 
@@ -59,6 +71,9 @@ class MatrixRotation;
 template <typename ImplType>
 class QuaternionRotation;
 
+template <typename ImplType, typename Order>
+class OrderedQuaternionRotation;
+
 template <typename ImplType>
 class AngleAxisRotation;
 
@@ -95,6 +110,27 @@ class MatrixRigidTransform;
 template <typename Derived>
 class CompactRigidTransform;
 
+template <typename ImplType, typename Layout>
+class LayoutRigidTransform;
+
+template <typename ImplType>
+class MatrixRotationBatch;
+
+template <typename ImplType>
+class QuaternionRotationBatch;
+
+template <typename ImplType>
+class TranslationBatch;
+
+template <typename ImplType>
+class CompactRigidTransformBatch;
+
+template <typename ImplType>
+class RelativeRotationBatch;
+
+template <typename ImplType>
+class PointCloud;
+
 template <typename Leaf>
 class Zero;
 
@@ -214,6 +214,14 @@ struct traits<Framed<WrappedLeaf, LeftFrame_, MiddleFrame_, RightFrame_>>
     using RightFrame = RightFrame_;
 };
 
+/** A framed leaf is evaluated in Lanes if the wrapped leaf is, keeping its frames */
+template <typename WrappedLeaf, int N, typename... Frames>
+struct lane_leaf<Framed<WrappedLeaf, Frames...>,
+                 N,
+                 tmp::void_t<typename lane_leaf<WrappedLeaf, N>::type>> {
+    using type = Framed<typename lane_leaf<WrappedLeaf, N>::type, Frames...>;
+};
+
 // If someone asks to convert to Framed<Leaf, ...>, evaluate Convert<Leaf, Rhs> instead
 template <typename Leaf, typename... Frames, typename Rhs>
 auto evalImpl(expr<Convert, Framed<Leaf, Frames...>>, const Rhs &rhs)
@@ -221,6 +229,32 @@ auto evalImpl(expr<Convert, Framed<Leaf, Frames...>>, const Rhs &rhs)
     return evalImpl(expr<Convert, Leaf>{}, rhs);
 };
 
+/** Returns a reference to an unframed leaf itself
+ *
+ * Together with the overloads for Framed, lets functions which work on stored values
+ * directly reach the leaf, once they have checked frames.
+ */
+template <typename Leaf>
+const Leaf &unframedLeaf(const ExpressionBase<Leaf> &leaf) noexcept {
+    return leaf.derived();
+}
+
+template <typename Leaf>
+Leaf &unframedLeaf(ExpressionBase<Leaf> &leaf) noexcept {
+    return leaf.derived();
+}
+
+/** Returns a reference to the leaf wrapped by a Framed leaf */
+template <typename Leaf, typename... Frames>
+const Leaf &unframedLeaf(const Framed<Leaf, Frames...> &f) noexcept {
+    return evalImpl(expr<Framed>{}, f);
+}
+
+template <typename Leaf, typename... Frames>
+Leaf &unframedLeaf(Framed<Leaf, Frames...> &f) noexcept {
+    return evalImpl(expr<Framed>{}, f);
+}
+
 
 }  // namespace internal
 }  // namespace wave
@@ -115,8 +115,9 @@ auto evalImpl(expr<Convert, AngleAxisRotation<ToImpl>>,
 template <typename ToImpl, typename FromImpl>
 auto evalImpl(expr<Convert, QuaternionRotation<ToImpl>>,
               const AngleAxisRotation<FromImpl> &rhs) -> QuaternionRotation<ToImpl> {
-    // Use Eigen's implementation
-    return QuaternionRotation<ToImpl>{rhs.value().toRotationMatrix()};
+    // Use Eigen's implementation, directly from the half angle
+    using Scalar = scalar_t<AngleAxisRotation<FromImpl>>;
+    return QuaternionRotation<ToImpl>{Eigen::Quaternion<Scalar>{rhs.value()}};
 }
 
 /** Converts from quaternion to angle-axis
@@ -128,6 +129,31 @@ auto evalImpl(expr<Convert, AngleAxisRotation<ToImpl>>,
     return AngleAxisRotation<ToImpl>{rhs.value()};
 }
 
+// Estimated costs of the above, for choosing conversions. See eval_cost
+
+template <typename Rhs>
+struct eval_cost<expr<Inverse>, AngleAxisRotation<Rhs>>
+  : std::integral_constant<int, 1> {};
+
+template <typename ToImpl, typename FromImpl>
+struct eval_cost<expr<Convert, AngleAxisRotation<ToImpl>>, AngleAxisRotation<FromImpl>>
+  : std::integral_constant<int, 0> {};
+
+template <typename ToImpl, typename FromImpl>
+struct eval_cost<expr<Convert, MatrixRotation<ToImpl>>, AngleAxisRotation<FromImpl>>
+  : std::integral_constant<int, 65> {};
+
+template <typename ToImpl, typename FromImpl>
+struct eval_cost<expr<Convert, AngleAxisRotation<ToImpl>>, MatrixRotation<FromImpl>>
+  : std::integral_constant<int, 70> {};
+
+template <typename ToImpl, typename FromImpl>
+struct eval_cost<expr<Convert, QuaternionRotation<ToImpl>>, AngleAxisRotation<FromImpl>>
+  : std::integral_constant<int, 45> {};
+
+template <typename ToImpl, typename FromImpl>
+struct eval_cost<expr<Convert, AngleAxisRotation<ToImpl>>, QuaternionRotation<FromImpl>>
+  : std::integral_constant<int, 50> {};
 
 }  // namespace internal
 
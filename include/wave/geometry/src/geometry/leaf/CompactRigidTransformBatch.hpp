@@ -0,0 +1,155 @@
+/**
+ * @file
+ */
+
+#ifndef WAVE_GEOMETRY_COMPACTRIGIDTRANSFORMBATCH_HPP
+#define WAVE_GEOMETRY_COMPACTRIGIDTRANSFORMBATCH_HPP
+
+namespace wave {
+
+/** A batch of proper rigid transformations in SE(3), stored as structure of arrays
+ *
+ * Row i holds the same seven coefficients as a CompactRigidTransform: a quaternion in
+ * Eigen::Quaternion order (x, y, z, w), followed by a translation. Each of the seven
+ * columns is a contiguous lane.
+ *
+ * @tparam ImplType The type to use for storage (e.g. Eigen::Array<double, Eigen::Dynamic,
+ * 7> or a Map of one).
+ *
+ * The alias RigidTransformQBatchd is provided for the typical storage type.
+ */
+template <typename ImplType>
+class CompactRigidTransformBatch
+  : public RigidTransformBase<CompactRigidTransformBatch<ImplType>>,
+    public LeafExpression<ImplType, CompactRigidTransformBatch<ImplType>> {
+    static_assert(internal::is_eigen_batch<7, ImplType>::value,
+                  "ImplType must be an Eigen N*7 array type.");
+    using Scalar = typename ImplType::Scalar;
+    using ElementType = CompactRigidTransform<Eigen::Matrix<Scalar, 7, 1>>;
+    using Storage = LeafExpression<ImplType, CompactRigidTransformBatch<ImplType>>;
+
+ public:
+    // Inherit constructors from LeafExpression
+    using Storage::Storage;
+    using Storage::operator=;
+
+    /** Constructs an empty batch */
+    CompactRigidTransformBatch() = default;
+
+    WAVE_DEFAULT_COPY_AND_MOVE_FUNCTIONS(CompactRigidTransformBatch)
+
+    /** Constructs a batch of n uninitialized transforms */
+    explicit CompactRigidTransformBatch(Eigen::Index n)
+        : Storage{typename Storage::init_storage{}, n, 7} {}
+
+    /** Constructs from an Eigen N*7 array */
+    template <typename OtherDerived,
+              TICK_REQUIRES(internal::is_eigen_batch<7, OtherDerived>{})>
+    explicit CompactRigidTransformBatch(const Eigen::ArrayBase<OtherDerived> &a)
+        : Storage{typename Storage::init_storage{}, a.derived()} {}
+
+    /** Constructs by moving from an array of the storage type, avoiding a copy */
+    explicit CompactRigidTransformBatch(ImplType &&a)
+        : Storage{typename Storage::init_storage{}, std::move(a)} {}
+
+    /** Returns the number of transforms in the batch */
+    Eigen::Index size() const noexcept {
+        return this->value().rows();
+    }
+
+    /** Returns a copy of the i'th transform */
+    ElementType get(Eigen::Index i) const {
+        ElementType element;
+        Eigen::Map<Eigen::Array<Scalar, 1, 7>>{element.value().data()} =
+          this->value().row(i);
+        return element;
+    }
+
+    /** Sets the i'th transform */
+    void set(Eigen::Index i, const ElementType &element) {
+        this->value().row(i) =
+          Eigen::Map<const Eigen::Array<Scalar, 1, 7>>{element.value().data()};
+    }
+};
+
+namespace internal {
+
+template <typename ImplType>
+struct traits<CompactRigidTransformBatch<ImplType>>
+  : batch_leaf_traits_base<CompactRigidTransformBatch<ImplType>>,
+    frameable_transform_traits {
+    using typename batch_leaf_traits_base<CompactRigidTransformBatch<ImplType>>::Scalar;
+    using ElementType = CompactRigidTransform<Eigen::Matrix<Scalar, 7, 1>>;
+    using TangentType = Twist<Eigen::Matrix<Scalar, 6, 1>>;
+    static constexpr int TangentSize = 6;
+};
+
+/** Implements inverse of a batch of compact rigid transforms */
+template <typename Rhs>
+auto evalImpl(expr<Inverse>, const CompactRigidTransformBatch<Rhs> &rhs)
+  -> plain_eval_t<CompactRigidTransformBatch<Rhs>> {
+    const auto &in = rhs.value();
+    plain_eval_t<CompactRigidTransformBatch<Rhs>> res{in.rows()};
+    auto &out = res.value();
+
+    out.template leftCols<4>() = quaternionBatchConjugate(in.template leftCols<4>());
+    out.template rightCols<3>() =
+      -quaternionBatchRotate(out.template leftCols<4>(), in.template rightCols<3>());
+    return res;
+}
+
+/** Implements composition of batches of compact rigid transforms */
+template <typename Lhs, typename Rhs>
+auto evalImpl(expr<Compose>,
+              const CompactRigidTransformBatch<Lhs> &lhs,
+              const CompactRigidTransformBatch<Rhs> &rhs)
+  -> plain_eval_t<CompactRigidTransformBatch<Lhs>> {
+    const auto &a = lhs.value();
+    const auto &b = rhs.value();
+    plain_eval_t<CompactRigidTransformBatch<Lhs>> res{a.rows()};
+    auto &out = res.value();
+
+    out.template leftCols<4>() =
+      quaternionBatchProduct(a.template leftCols<4>(), b.template leftCols<4>());
+    out.template rightCols<3>() =
+      quaternionBatchRotate(a.template leftCols<4>(), b.template rightCols<3>()) +
+      a.template rightCols<3>();
+    return res;
+}
+
+/** Transforms a batch of translations by a batch of compact rigid transforms */
+template <typename Lhs, typename Rhs>
+auto evalImpl(expr<Transform>,
+              const CompactRigidTransformBatch<Lhs> &lhs,
+              const TranslationBatch<Rhs> &rhs) -> plain_eval_t<TranslationBatch<Rhs>> {
+    const auto &a = lhs.value();
+    return plain_eval_t<TranslationBatch<Rhs>>{
+      quaternionBatchRotate(a.template leftCols<4>(), rhs.value()) +
+      a.template rightCols<3>()};
+}
+
+/** Implements "conversion" between CompactRigidTransformBatch types
+ *
+ * While this seems trivial, it is needed for the case the template params are not the
+ * same.
+ */
+template <typename ToImpl, typename FromImpl>
+auto evalImpl(expr<Convert, CompactRigidTransformBatch<ToImpl>>,
+              const CompactRigidTransformBatch<FromImpl> &rhs)
+  -> CompactRigidTransformBatch<ToImpl> {
+    return CompactRigidTransformBatch<ToImpl>{rhs.value()};
+}
+
+}  // namespace internal
+
+// Convenience typedefs
+
+using RigidTransformQBatchd =
+  CompactRigidTransformBatch<Eigen::Array<double, Eigen::Dynamic, 7>>;
+
+template <typename F1, typename F2>
+using RigidTransformQBatchFd = Framed<RigidTransformQBatchd, F1, F2>;
+
+}  // namespace wave
+
+#endif  // WAVE_GEOMETRY_COMPACTRIGIDTRANSFORMBATCH_HPP
@@ -105,6 +105,56 @@ auto evalImpl(expr<LogMap>, const Identity<Rhs> &)
     return Zero<typename traits<Rhs>::TangentType>{};
 };
 
+// Rewrite rules removing Identity leaves from the tree entirely, along with the identity
+// jacobians which the shortcuts above would still multiply
+
+template <typename Lhs, typename Rhs>
+struct rewrite_rule<Compose<Lhs, Rhs>,
+                    tmp::enable_if_t<is_identity<tmp::remove_cr_t<Rhs>>{} &&
+                                     !is_identity<tmp::remove_cr_t<Lhs>>{}>> {
+    using type = Lhs;
+
+    static auto run(const Compose<Lhs, Rhs> &e)
+      -> rewrite_return_t<Compose<Lhs, Rhs>, Lhs> {
+        return e.lhs();
+    }
+};
+
+/** Rewrites a binary expression with an Identity on the left to its rhs */
+template <template <typename, typename> class Tmpl, typename Lhs, typename Rhs>
+struct rewrite_identity_lhs {
+    using type = Rhs;
+
+    static auto run(const Tmpl<Lhs, Rhs> &e) -> rewrite_return_t<Tmpl<Lhs, Rhs>, Rhs> {
+        return e.rhs();
+    }
+};
+
+template <typename Lhs, typename Rhs>
+struct rewrite_rule<Compose<Lhs, Rhs>,
+                    tmp::enable_if_t<is_identity<tmp::remove_cr_t<Lhs>>{}>>
+  : rewrite_identity_lhs<Compose, Lhs, Rhs> {};
+
+template <typename Lhs, typename Rhs>
+struct rewrite_rule<Rotate<Lhs, Rhs>,
+                    tmp::enable_if_t<is_identity<tmp::remove_cr_t<Lhs>>{}>>
+  : rewrite_identity_lhs<Rotate, Lhs, Rhs> {};
+
+template <typename Lhs, typename Rhs>
+struct rewrite_rule<Transform<Lhs, Rhs>,
+                    tmp::enable_if_t<is_identity<tmp::remove_cr_t<Lhs>>{}>>
+  : rewrite_identity_lhs<Transform, Lhs, Rhs> {};
+
+template <typename Rhs>
+struct rewrite_rule<Inverse<Rhs>,
+                    tmp::enable_if_t<is_identity<tmp::remove_cr_t<Rhs>>{}>> {
+    using type = Rhs;
+
+    static auto run(const Inverse<Rhs> &e) -> rewrite_return_t<Inverse<Rhs>, Rhs> {
+        return e.rhs();
+    }
+};
+
 }  // namespace internal
 }  // namespace wave
 
@@ -0,0 +1,207 @@
+/**
+ * @file
+ */
+
+#ifndef WAVE_GEOMETRY_LAYOUTRIGIDTRANSFORM_HPP
+#define WAVE_GEOMETRY_LAYOUTRIGIDTRANSFORM_HPP
+
+namespace wave {
+
+/** Describes where a rigid transform's quaternion and translation lie in 7 coefficients
+ *
+ * @tparam QuaternionOrder_ The order of the four quaternion coefficients, such as
+ * QuaternionOrderXYZW
+ * @tparam QuaternionOffset Index of the first quaternion coefficient
+ * @tparam TranslationOffset Index of the first translation coefficient
+ *
+ * For example, PoseLayout<QuaternionOrderXYZW, 0, 4> is the layout of
+ * CompactRigidTransform, and PoseLayout<QuaternionOrderXYZW, 3, 0> puts the translation
+ * first, as in a ROS geometry_msgs/Pose.
+ */
+template <typename QuaternionOrder_, int QuaternionOffset, int TranslationOffset>
+struct PoseLayout {
+    static_assert(QuaternionOffset >= 0 && TranslationOffset >= 0 &&
+                    (QuaternionOffset + 4 <= TranslationOffset ||
+                     TranslationOffset + 3 <= QuaternionOffset) &&
+                    QuaternionOffset + 4 <= 7 && TranslationOffset + 3 <= 7,
+                  "The quaternion and translation must fit in 7 coefficients without "
+                  "overlapping");
+
+    using QuaternionOrder = QuaternionOrder_;
+    enum { Q = QuaternionOffset, T = TranslationOffset };
+};
+
+/** A proper rigid transformation in SE(3), stored as 7 coefficients in a given layout
+ *
+ * Like OrderedQuaternionRotation, this leaf is meant to evaluate expressions directly on
+ * memory laid out by other libraries: with an Eigen::Map as storage, it reads and writes
+ * the mapped coefficients in place.
+ *
+ * Note the const rotation() returns a reordered copy, as a QuaternionRotation, while the
+ * non-const rotation() refers to the stored coefficients.
+ *
+ * @tparam ImplType The type to use for storage: an Eigen 7-vector or a Map of one (e.g.
+ * Eigen::Map<Eigen::Matrix<double, 7, 1>>)
+ * @tparam Layout A PoseLayout
+ */
+template <typename ImplType, typename Layout>
+class LayoutRigidTransform
+  : public RigidTransformBase<LayoutRigidTransform<ImplType, Layout>>,
+    public LeafExpression<ImplType, LayoutRigidTransform<ImplType, Layout>> {
+    static_assert(internal::is_eigen_vector<7, ImplType>::value,
+                  "ImplType must be an Eigen 7-vector type.");
+
+    using Storage = LeafExpression<ImplType, LayoutRigidTransform<ImplType, Layout>>;
+    using Scalar = typename Eigen::internal::traits<ImplType>::Scalar;
+    using Order = typename Layout::QuaternionOrder;
+
+    // Eigen Blocks for nested rotation and translation
+    using RotationBlock = Eigen::Block<ImplType, 4, 1>;
+    using TranslationBlock = Eigen::Block<ImplType, 3, 1>;
+    using TranslationConstBlock = Eigen::Block<const ImplType, 3, 1>;
+
+ public:
+    // Inherit constructors from LeafExpression
+    using Storage::Storage;
+    using Storage::operator=;
+
+    /** Constructs an uninitialized RT */
+    LayoutRigidTransform() = default;
+
+    WAVE_DEFAULT_COPY_AND_MOVE_FUNCTIONS(LayoutRigidTransform)
+
+    /** Constructs from rotation and translation expressions */
+    template <typename RDerived, typename TDerived>
+    LayoutRigidTransform(const RotationBase<RDerived> &R,
+                         const TranslationBase<TDerived> &t) {
+        this->rotation() = R.derived();
+        this->translation() = t.derived();
+    };
+
+    /** Construct from an Eigen rotation and translation vector */
+    template <typename RDerived, typename TDerived>
+    LayoutRigidTransform(const Eigen::RotationBase<RDerived, 3> &q,
+                         const Eigen::MatrixBase<TDerived> &t) {
+        EIGEN_STATIC_ASSERT_VECTOR_SPECIFIC_SIZE(TDerived, 3);
+        this->rotation().setQuaternion(Eigen::Quaternion<Scalar>{q.derived()});
+        this->translation().value() = t;
+    };
+
+    /** Construct from an Eigen 7-vector holding coefficients in this Layout */
+    template <typename VDerived, TICK_REQUIRES(internal::is_eigen_vector<7, VDerived>{})>
+    explicit LayoutRigidTransform(const Eigen::MatrixBase<VDerived> &v)
+        : Storage{typename Storage::init_storage{}, v.derived()} {}
+
+    /** Returns a reference to the rotation portion of this transform */
+    OrderedQuaternionRotation<RotationBlock, Order> rotation() noexcept {
+        return OrderedQuaternionRotation<RotationBlock, Order>{
+          this->value().template segment<4>(Layout::Q)};
+    }
+
+    /** Returns a copy of the rotation portion of this transform, as a quaternion */
+    QuaternionRotation<Eigen::Quaternion<Scalar>> rotation() const {
+        const auto &v = this->value();
+        return QuaternionRotation<Eigen::Quaternion<Scalar>>{
+          Eigen::Quaternion<Scalar>{v[Layout::Q + Order::W],
+                                    v[Layout::Q + Order::X],
+                                    v[Layout::Q + Order::Y],
+                                    v[Layout::Q + Order::Z]}};
+    }
+
+    /** Returns a reference to the translation portion of this transform */
+    Translation<TranslationBlock> translation() noexcept {
+        return Translation<TranslationBlock>{
+          this->value().template segment<3>(Layout::T)};
+    }
+
+    /** Returns a const reference to the translation portion of this transform */
+    Translation<TranslationConstBlock> translation() const noexcept {
+        return Translation<TranslationConstBlock>{
+          this->value().template segment<3>(Layout::T)};
+    }
+};
+
+namespace internal {
+
+template <typename ImplType_, typename Layout>
+struct traits<LayoutRigidTransform<ImplType_, Layout>>
+  : leaf_traits_base<LayoutRigidTransform<ImplType_, Layout>>,
+    frameable_transform_traits {
+    template <typename NewImplType>
+    using rebind = LayoutRigidTransform<NewImplType, Layout>;
+
+    using ImplType = ImplType_;
+    using Scalar = typename ImplType::Scalar;
+    using TangentType = Twist<Eigen::Matrix<Scalar, 6, 1>>;
+    static constexpr int TangentSize = 6;
+
+    using PlainType = LayoutRigidTransform<typename ImplType::PlainObject, Layout>;
+};
+
+/** Implements conversion between LayoutRigidTransform types, rearranging the
+ * coefficients if needed */
+template <typename ToImpl, typename ToLayout, typename FromImpl, typename FromLayout>
+auto evalImpl(expr<Convert, LayoutRigidTransform<ToImpl, ToLayout>>,
+              const LayoutRigidTransform<FromImpl, FromLayout> &rhs)
+  -> LayoutRigidTransform<ToImpl, ToLayout> {
+    return LayoutRigidTransform<ToImpl, ToLayout>{rhs.rotation().value(),
+                                                  rhs.translation().value()};
+}
+
+/** Converts from a laid-out to a compact rigid transform */
+template <typename ToImpl, typename FromImpl, typename Layout>
+auto evalImpl(expr<Convert, CompactRigidTransform<ToImpl>>,
+              const LayoutRigidTransform<FromImpl, Layout> &rhs)
+  -> CompactRigidTransform<ToImpl> {
+    return CompactRigidTransform<ToImpl>{rhs.rotation().value(),
+                                         rhs.translation().value()};
+}
+
+/** Converts from a compact to a laid-out rigid transform */
+template <typename ToImpl, typename Layout, typename FromImpl>
+auto evalImpl(expr<Convert, LayoutRigidTransform<ToImpl, Layout>>,
+              const CompactRigidTransform<FromImpl> &rhs)
+  -> LayoutRigidTransform<ToImpl, Layout> {
+    return LayoutRigidTransform<ToImpl, Layout>{rhs.rotation().value(),
+                                                rhs.translation().value()};
+}
+
+/** Converts from a laid-out to a matrix rigid transform */
+template <typename ToImpl, typename FromImpl, typename Layout>
+auto evalImpl(expr<Convert, MatrixRigidTransform<ToImpl>>,
+              const LayoutRigidTransform<FromImpl, Layout> &rhs)
+  -> MatrixRigidTransform<ToImpl> {
+    return MatrixRigidTransform<ToImpl>{rhs.rotation(), rhs.translation()};
+}
+
+/** Converts from a matrix to a laid-out rigid transform */
+template <typename ToImpl, typename Layout, typename FromImpl>
+auto evalImpl(expr<Convert, LayoutRigidTransform<ToImpl, Layout>>,
+              const MatrixRigidTransform<FromImpl> &rhs)
+  -> LayoutRigidTransform<ToImpl, Layout> {
+    using Scalar = scalar_t<MatrixRigidTransform<FromImpl>>;
+    return LayoutRigidTransform<ToImpl, Layout>{
+      Eigen::Quaternion<Scalar>{rhs.rotation().value()}, rhs.translation().value()};
+}
+
+}  // namespace internal
+
+// Convenience typedefs
+
+template <typename Layout>
+using RigidTransformLayoutd = LayoutRigidTransform<Eigen::Matrix<double, 7, 1>, Layout>;
+
+/** A rigid transform viewing seven mapped coefficients in the given Layout */
+template <typename Layout>
+using RigidTransformLayoutMapd =
+  LayoutRigidTransform<Eigen::Map<Eigen::Matrix<double, 7, 1>>, Layout>;
+
+template <typename Layout, typename F1, typename F2>
+using RigidTransformLayoutFd = Framed<RigidTransformLayoutd<Layout>, F1, F2>;
+
+template <typename Layout, typename F1, typename F2>
+using RigidTransformLayoutMapFd = Framed<RigidTransformLayoutMapd<Layout>, F1, F2>;
+
+}  // namespace wave
+
+#endif  // WAVE_GEOMETRY_LAYOUTRIGIDTRANSFORM_HPP
@@ -54,6 +54,14 @@ struct traits<MatrixRotation<ImplType>>
     using PlainType = MatrixRotation<typename ImplType::PlainObject>;
 };
 
+/** Rotation matrices are evaluated in Lanes by batches */
+template <typename ImplType, int N>
+struct lane_leaf<MatrixRotation<ImplType>,
+                 N,
+                 tmp::enable_if_t<std::is_floating_point<typename ImplType::Scalar>{}>> {
+    using type = MatrixRotation<Eigen::Matrix<Lanes<typename ImplType::Scalar, N>, 3, 3>>;
+};
+
 /** Implements inverse of a rotation matrix */
 template <typename Rhs>
 auto evalImpl(expr<Inverse>, const MatrixRotation<Rhs> &m)
@@ -69,24 +77,36 @@ auto jacobianImpl(expr<Inverse>,
     return -inv.value();
 }
 
-/** Implements log map of rotation matrix */
+/** Implements log map of rotation matrix, keeping the angle for the jacobian */
 template <typename ImplType>
-auto evalImpl(expr<LogMap>, const MatrixRotation<ImplType> &rhs) ->
-  typename traits<MatrixRotation<ImplType>>::TangentType {
+auto evalWithAuxImpl(expr<LogMap>, const MatrixRotation<ImplType> &rhs)
+  -> EvalWithAux<typename traits<MatrixRotation<ImplType>>::TangentType,
+                 RotationAngleAux<scalar_t<MatrixRotation<ImplType>>>> {
     using Scalar = scalar_t<MatrixRotation<ImplType>>;
 
-    // From http://ethaneade.com/lie.pdf
-    using std::sin;
-    using std::acos;
+    // From http://ethaneade.com/lie.pdf, but the angle is found as atan2 of the sine and
+    // cosine parts of the matrix, which stays accurate near 0 and pi where acos does not
+    using std::atan2;
+    using std::sqrt;
     const auto &m = rhs.value();
-    const auto angle = acos((m.trace() - Scalar{1}) / Scalar{2});
+    const Eigen::Matrix<Scalar, 3, 1> v = uncrossMatrix(m - m.transpose());
+    const Scalar sin_angle = sqrt(v.squaredNorm()) / Scalar{2};
+    const Scalar cos_angle = (m.trace() - Scalar{1}) / Scalar{2};
+    const Scalar angle = atan2(sin_angle, cos_angle);
+    const Scalar angle2 = angle * angle;
+
+    // For very small angles, use the limit of the factor
+    const auto large = laneGreater(angle2, Eigen::NumTraits<Scalar>::epsilon());
+    const Scalar factor =
+      laneSelect(large, Scalar{angle / (Scalar{2} * sin_angle)}, Scalar{0.5});
+    return {factor * v, {angle2, angle, sin_angle, cos_angle}};
+}
 
-    if (angle * angle > Eigen::NumTraits<Scalar>::epsilon()) {
-        return uncrossMatrix(angle / (Scalar{2} * sin(angle)) * (m - m.transpose()));
-    } else {
-        // Very small angle
-        return uncrossMatrix(Scalar{0.5} * (m - m.transpose()));
-    }
+/** Implements log map of rotation matrix */
+template <typename ImplType>
+auto evalImpl(expr<LogMap>, const MatrixRotation<ImplType> &rhs) ->
+  typename traits<MatrixRotation<ImplType>>::TangentType {
+    return evalWithAuxImpl(expr<LogMap>{}, rhs).value;
 }
 
 /** Implements composition of rotation matrices */
@@ -108,6 +128,50 @@ auto rightJacobianImpl(expr<Compose>,
     return lhs.value();
 }
 
+/** Implements composition of an inverse rotation matrix with another, as one product
+ * with the transpose
+ *
+ * The result has the same type as the Compose it replaces. */
+template <typename Lhs, typename Rhs>
+auto evalImpl(expr<InverseCompose>,
+              const MatrixRotation<Lhs> &lhs,
+              const MatrixRotation<Rhs> &rhs)
+  -> decltype(evalImpl(expr<Compose>{}, evalImpl(expr<Inverse>{}, lhs), rhs)) {
+    return evalImpl(expr<Compose>{}, evalImpl(expr<Inverse>{}, lhs), rhs);
+}
+
+/** Left jacobian of InverseCompose, that of the inverse followed by composition */
+template <typename Val, typename Lhs, typename Rhs>
+auto leftJacobianImpl(expr<InverseCompose>,
+                      const Val &,
+                      const MatrixRotation<Lhs> &lhs,
+                      const MatrixRotation<Rhs> &) -> decltype(-lhs.value().transpose()) {
+    return -lhs.value().transpose();
+}
+
+/** Right jacobian of InverseCompose, the inverse of the lhs */
+template <typename Val, typename Lhs, typename Rhs>
+auto rightJacobianImpl(expr<InverseCompose>,
+                       const Val &,
+                       const MatrixRotation<Lhs> &lhs,
+                       const MatrixRotation<Rhs> &) -> decltype(lhs.value().transpose()) {
+    return lhs.value().transpose();
+}
+
+/** Rewrites the composition of an inverse rotation matrix to an InverseCompose, saving
+ * the inverse node and the product of its jacobian */
+template <typename Lhs, typename Rhs>
+struct rewrite_rule<
+  Compose<Inverse<Lhs>, Rhs>,
+  tmp::enable_if_t<is_matrix_rotation<clean_eval_t<Lhs>>{} &&
+                   is_matrix_rotation<clean_eval_t<Rhs>>{}>> {
+    using type = InverseCompose<Lhs, Rhs>;
+
+    static auto run(const Compose<Inverse<Lhs>, Rhs> &e) -> type {
+        return type{e.lhs().rhs(), e.rhs()};
+    }
+};
+
 /** Rotates a translation by a rotation matrix */
 template <typename Lhs, typename Rhs>
 auto evalImpl(expr<Rotate>, const MatrixRotation<Lhs> &lhs, const Translation<Rhs> &rhs)
@@ -139,6 +203,27 @@ auto evalImpl(expr<Convert, MatrixRotation<ToImpl>>, const MatrixRotation<FromIm
     return MatrixRotation<ToImpl>{rhs.derived().value()};
 }
 
+// Estimated costs of the above, for choosing conversions. See eval_cost
+
+template <typename Rhs>
+struct eval_cost<expr<Inverse>, MatrixRotation<Rhs>> : std::integral_constant<int, 0> {};
+
+template <typename ImplType>
+struct eval_cost<expr<LogMap>, MatrixRotation<ImplType>>
+  : std::integral_constant<int, 60> {};
+
+template <typename Lhs, typename Rhs>
+struct eval_cost<expr<Compose>, MatrixRotation<Lhs>, MatrixRotation<Rhs>>
+  : std::integral_constant<int, 45> {};
+
+template <typename Lhs, typename Rhs>
+struct eval_cost<expr<Rotate>, MatrixRotation<Lhs>, Translation<Rhs>>
+  : std::integral_constant<int, 15> {};
+
+template <typename ToImpl, typename FromImpl>
+struct eval_cost<expr<Convert, MatrixRotation<ToImpl>>, MatrixRotation<FromImpl>>
+  : std::integral_constant<int, 0> {};
+
 }  // namespace internal
 
 // Convenience typedefs
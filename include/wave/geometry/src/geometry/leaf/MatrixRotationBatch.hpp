@@ -0,0 +1,181 @@
+/**
+ * @file
+ */
+
+#ifndef WAVE_GEOMETRY_MATRIXROTATIONBATCH_HPP
+#define WAVE_GEOMETRY_MATRIXROTATIONBATCH_HPP
+
+namespace wave {
+
+/** A batch of rotations on SO(3) stored as rotation matrices, in structure of arrays
+ *
+ * @tparam ImplType The type to use for storage (e.g. Eigen::Array<double, Eigen::Dynamic,
+ * 9> or a Map of one). Row i holds the nine coefficients of element i in column-major
+ * order, so column r + 3*c holds coefficient (r, c) of every element.
+ *
+ * The alias RotationMBatchd is provided for the typical storage type.
+ */
+template <typename ImplType>
+class MatrixRotationBatch
+  : public RotationBase<MatrixRotationBatch<ImplType>>,
+    public LeafExpression<ImplType, MatrixRotationBatch<ImplType>> {
+    static_assert(internal::is_eigen_batch<9, ImplType>::value,
+                  "ImplType must be an Eigen N*9 array type.");
+    using Scalar = typename ImplType::Scalar;
+    using ElementType = MatrixRotation<Eigen::Matrix<Scalar, 3, 3>>;
+    using Storage = LeafExpression<ImplType, MatrixRotationBatch<ImplType>>;
+
+ public:
+    // Inherit constructors from LeafExpression
+    using Storage::Storage;
+    using Storage::operator=;
+
+    /** Constructs an empty batch */
+    MatrixRotationBatch() = default;
+
+    WAVE_DEFAULT_COPY_AND_MOVE_FUNCTIONS(MatrixRotationBatch)
+
+    /** Constructs a batch of n uninitialized rotations */
+    explicit MatrixRotationBatch(Eigen::Index n)
+        : Storage{typename Storage::init_storage{}, n, 9} {}
+
+    /** Constructs from an Eigen N*9 array */
+    template <typename OtherDerived,
+              TICK_REQUIRES(internal::is_eigen_batch<9, OtherDerived>{})>
+    explicit MatrixRotationBatch(const Eigen::ArrayBase<OtherDerived> &a)
+        : Storage{typename Storage::init_storage{}, a.derived()} {}
+
+    /** Constructs by moving from an array of the storage type, avoiding a copy */
+    explicit MatrixRotationBatch(ImplType &&a)
+        : Storage{typename Storage::init_storage{}, std::move(a)} {}
+
+    /** Returns the number of rotations in the batch */
+    Eigen::Index size() const noexcept {
+        return this->value().rows();
+    }
+
+    /** Returns a copy of the i'th rotation */
+    ElementType get(Eigen::Index i) const {
+        ElementType element;
+        Eigen::Map<Eigen::Array<Scalar, 1, 9>>{element.value().data()} =
+          this->value().row(i);
+        return element;
+    }
+
+    /** Sets the i'th rotation */
+    void set(Eigen::Index i, const ElementType &element) {
+        this->value().row(i) =
+          Eigen::Map<const Eigen::Array<Scalar, 1, 9>>{element.value().data()};
+    }
+};
+
+namespace internal {
+
+template <typename ImplType>
+struct traits<MatrixRotationBatch<ImplType>>
+  : batch_leaf_traits_base<MatrixRotationBatch<ImplType>>, frameable_transform_traits {
+    using typename batch_leaf_traits_base<MatrixRotationBatch<ImplType>>::Scalar;
+    using ElementType = MatrixRotation<Eigen::Matrix<Scalar, 3, 3>>;
+    using TangentType =
+      RelativeRotationBatch<Eigen::Array<Scalar, Eigen::Dynamic, 3>>;
+    static constexpr int TangentSize = 3;
+};
+
+/** Products of rotation matrices over a batch, lane by lane.
+ *
+ * Each argument is an N*9 array of column-major matrix coefficients.
+ */
+template <typename A, typename B>
+auto rotationMatrixBatchProduct(const Eigen::ArrayBase<A> &a,
+                                const Eigen::ArrayBase<B> &b)
+  -> Eigen::Array<typename A::Scalar, Eigen::Dynamic, 9> {
+    Eigen::Array<typename A::Scalar, Eigen::Dynamic, 9> out{a.rows(), 9};
+    for (int c = 0; c < 3; ++c) {
+        for (int r = 0; r < 3; ++r) {
+            out.col(r + 3 * c) = a.col(r) * b.col(3 * c) +
+                                 a.col(r + 3) * b.col(1 + 3 * c) +
+                                 a.col(r + 6) * b.col(2 + 3 * c);
+        }
+    }
+    return out;
+}
+
+/** Rotates a batch of vectors by a batch of rotation matrices, lane by lane.
+ *
+ * @param a an N*9 array of column-major matrix coefficients
+ * @param v an N*3 array of vector coefficients
+ */
+template <typename A, typename V>
+auto rotationMatrixBatchRotate(const Eigen::ArrayBase<A> &a, const Eigen::ArrayBase<V> &v)
+  -> Eigen::Array<typename A::Scalar, Eigen::Dynamic, 3> {
+    Eigen::Array<typename A::Scalar, Eigen::Dynamic, 3> out{a.rows(), 3};
+    for (int r = 0; r < 3; ++r) {
+        out.col(r) =
+          a.col(r) * v.col(0) + a.col(r + 3) * v.col(1) + a.col(r + 6) * v.col(2);
+    }
+    return out;
+}
+
+/** Transposes a batch of rotation matrices, lane by lane. */
+template <typename A>
+auto rotationMatrixBatchTranspose(const Eigen::ArrayBase<A> &a)
+  -> Eigen::Array<typename A::Scalar, Eigen::Dynamic, 9> {
+    Eigen::Array<typename A::Scalar, Eigen::Dynamic, 9> out{a.rows(), 9};
+    for (int c = 0; c < 3; ++c) {
+        for (int r = 0; r < 3; ++r) {
+            out.col(r + 3 * c) = a.col(c + 3 * r);
+        }
+    }
+    return out;
+}
+
+/** Implements inverse of a batch of rotation matrices */
+template <typename Rhs>
+auto evalImpl(expr<Inverse>, const MatrixRotationBatch<Rhs> &rhs)
+  -> plain_eval_t<MatrixRotationBatch<Rhs>> {
+    return plain_eval_t<MatrixRotationBatch<Rhs>>{
+      rotationMatrixBatchTranspose(rhs.value())};
+}
+
+/** Implements composition of batches of rotation matrices */
+template <typename Lhs, typename Rhs>
+auto evalImpl(expr<Compose>,
+              const MatrixRotationBatch<Lhs> &lhs,
+              const MatrixRotationBatch<Rhs> &rhs)
+  -> plain_eval_t<MatrixRotationBatch<Lhs>> {
+    return plain_eval_t<MatrixRotationBatch<Lhs>>{
+      rotationMatrixBatchProduct(lhs.value(), rhs.value())};
+}
+
+/** Rotates a batch of translations by a batch of rotation matrices */
+template <typename Lhs, typename Rhs>
+auto evalImpl(expr<Rotate>,
+              const MatrixRotationBatch<Lhs> &lhs,
+              const TranslationBatch<Rhs> &rhs) -> plain_eval_t<TranslationBatch<Rhs>> {
+    return plain_eval_t<TranslationBatch<Rhs>>{
+      rotationMatrixBatchRotate(lhs.value(), rhs.value())};
+}
+
+/** Implements "conversion" between MatrixRotationBatch types
+ *
+ * While this seems trivial, it is needed for the case the template params are not the
+ * same.
+ */
+template <typename ToImpl, typename FromImpl>
+auto evalImpl(expr<Convert, MatrixRotationBatch<ToImpl>>,
+              const MatrixRotationBatch<FromImpl> &rhs) -> MatrixRotationBatch<ToImpl> {
+    return MatrixRotationBatch<ToImpl>{rhs.value()};
+}
+
+}  // namespace internal
+
+// Convenience typedefs
+
+using RotationMBatchd = MatrixRotationBatch<Eigen::Array<double, Eigen::Dynamic, 9>>;
+
+template <typename F1, typename F2>
+using RotationMBatchFd = Framed<RotationMBatchd, F1, F2>;
+
+}  // namespace wave
+
+#endif  // WAVE_GEOMETRY_MATRIXROTATIONBATCH_HPP
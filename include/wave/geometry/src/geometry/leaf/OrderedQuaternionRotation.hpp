@@ -0,0 +1,191 @@
+/**
+ * @file
+ */
+
+#ifndef WAVE_GEOMETRY_ORDEREDQUATERNIONROTATION_HPP
+#define WAVE_GEOMETRY_ORDEREDQUATERNIONROTATION_HPP
+
+namespace wave {
+
+/** Quaternion coefficient order with the scalar part last, as in Eigen::Quaternion and
+ * ROS messages */
+struct QuaternionOrderXYZW {
+    enum { X = 0, Y = 1, Z = 2, W = 3 };
+};
+
+/** Quaternion coefficient order with the scalar part first, as in Ceres */
+struct QuaternionOrderWXYZ {
+    enum { W = 0, X = 1, Y = 2, Z = 3 };
+};
+
+/** A rotation on SO(3) stored as the four coefficients of a quaternion, in a given order
+ *
+ * This leaf is meant to evaluate expressions directly on memory laid out by other
+ * libraries. With an Eigen::Map as storage, it reads and writes the mapped coefficients
+ * in place. For most operations, it is converted to QuaternionRotation.
+ *
+ * @tparam ImplType The type to use for storage: an Eigen 4-vector, or a Map or Block of
+ * one (e.g. Eigen::Map<Eigen::Vector4d>)
+ * @tparam Order A policy giving the index of each coefficient, such as
+ * QuaternionOrderXYZW or QuaternionOrderWXYZ
+ */
+template <typename ImplType, typename Order>
+class OrderedQuaternionRotation
+  : public RotationBase<OrderedQuaternionRotation<ImplType, Order>>,
+    public LeafExpression<ImplType, OrderedQuaternionRotation<ImplType, Order>> {
+    static_assert(internal::is_eigen_vector<4, ImplType>::value,
+                  "ImplType must be an Eigen 4-vector type.");
+    using Scalar = typename Eigen::internal::traits<ImplType>::Scalar;
+    using Storage = LeafExpression<ImplType, OrderedQuaternionRotation<ImplType, Order>>;
+
+ public:
+    // Inherit constructors from LeafExpression
+    using Storage::Storage;
+    using Storage::operator=;
+
+    /** Constructs uninitialized rotation */
+    OrderedQuaternionRotation() = default;
+
+    WAVE_DEFAULT_COPY_AND_MOVE_FUNCTIONS(OrderedQuaternionRotation)
+
+    /** Constructs from an Eigen 4-vector holding coefficients in this Order */
+    template <typename VDerived, TICK_REQUIRES(internal::is_eigen_vector<4, VDerived>{})>
+    explicit OrderedQuaternionRotation(const Eigen::MatrixBase<VDerived> &v)
+        : Storage{typename Storage::init_storage{}, v.derived()} {}
+
+    /** Constructs from an Eigen rotation object, including Quaternion and AngleAxis.
+     */
+    template <typename RDerived>
+    explicit OrderedQuaternionRotation(const Eigen::RotationBase<RDerived, 3> &r) {
+        this->setQuaternion(Eigen::Quaternion<Scalar>{r.derived()});
+    }
+
+    /** Returns a copy of the coefficients as an Eigen quaternion */
+    Eigen::Quaternion<Scalar> quaternion() const {
+        const auto &v = this->value();
+        return Eigen::Quaternion<Scalar>{
+          v[Order::W], v[Order::X], v[Order::Y], v[Order::Z]};
+    }
+
+    /** Stores the coefficients of an Eigen quaternion in this Order */
+    template <typename QDerived>
+    void setQuaternion(const Eigen::QuaternionBase<QDerived> &q) {
+        auto &&v = this->value();
+        v[Order::X] = q.x();
+        v[Order::Y] = q.y();
+        v[Order::Z] = q.z();
+        v[Order::W] = q.w();
+    }
+};
+
+namespace internal {
+
+template <typename ImplType_, typename Order>
+struct traits<OrderedQuaternionRotation<ImplType_, Order>>
+  : leaf_traits_base<OrderedQuaternionRotation<ImplType_, Order>>,
+    frameable_transform_traits {
+    template <typename NewImplType>
+    using rebind = OrderedQuaternionRotation<NewImplType, Order>;
+
+    using ImplType = ImplType_;
+    using Scalar = typename ImplType::Scalar;
+    using TangentType = RelativeRotation<Eigen::Matrix<Scalar, 3, 1>>;
+    static constexpr int TangentSize = 3;
+
+    using PlainType = OrderedQuaternionRotation<typename ImplType::PlainObject, Order>;
+
+    // The matrix is the fallback for operations with no quaternion implementation
+    using ConvertTo = tmp::type_list<QuaternionRotation<Eigen::Quaternion<Scalar>>,
+                                     MatrixRotation<Eigen::Matrix<Scalar, 3, 3>>>;
+};
+
+/** Implements Identity for an OrderedQuaternionRotation
+ *
+ * The generic rotation Identity would use the ImplType's identity, which for a 4-vector
+ * is not the identity quaternion.
+ */
+template <typename ImplType, typename Order>
+auto evalImpl(expr<Convert, OrderedQuaternionRotation<ImplType, Order>>,
+              const Identity<OrderedQuaternionRotation<ImplType, Order>> &)
+  -> OrderedQuaternionRotation<ImplType, Order> {
+    using Scalar = scalar_t<OrderedQuaternionRotation<ImplType, Order>>;
+    return OrderedQuaternionRotation<ImplType, Order>{
+      Eigen::Quaternion<Scalar>::Identity()};
+}
+
+/** Implements conversion between OrderedQuaternionRotation types, reordering the
+ * coefficients if needed */
+template <typename ToImpl, typename ToOrder, typename FromImpl, typename FromOrder>
+auto evalImpl(expr<Convert, OrderedQuaternionRotation<ToImpl, ToOrder>>,
+              const OrderedQuaternionRotation<FromImpl, FromOrder> &rhs)
+  -> OrderedQuaternionRotation<ToImpl, ToOrder> {
+    return OrderedQuaternionRotation<ToImpl, ToOrder>{rhs.quaternion()};
+}
+
+/** Converts from ordered coefficients to quaternion */
+template <typename ToImpl, typename FromImpl, typename Order>
+auto evalImpl(expr<Convert, QuaternionRotation<ToImpl>>,
+              const OrderedQuaternionRotation<FromImpl, Order> &rhs)
+  -> QuaternionRotation<ToImpl> {
+    return QuaternionRotation<ToImpl>{rhs.quaternion()};
+}
+
+/** Converts from ordered coefficients to rotation matrix */
+template <typename ToImpl, typename FromImpl, typename Order>
+auto evalImpl(expr<Convert, MatrixRotation<ToImpl>>,
+              const OrderedQuaternionRotation<FromImpl, Order> &rhs)
+  -> MatrixRotation<ToImpl> {
+    return MatrixRotation<ToImpl>{rhs.quaternion().toRotationMatrix()};
+}
+
+/** Converts from quaternion to ordered coefficients */
+template <typename ToImpl, typename Order, typename FromImpl>
+auto evalImpl(expr<Convert, OrderedQuaternionRotation<ToImpl, Order>>,
+              const QuaternionRotation<FromImpl> &rhs)
+  -> OrderedQuaternionRotation<ToImpl, Order> {
+    return OrderedQuaternionRotation<ToImpl, Order>{rhs.value()};
+}
+
+/** Converts from rotation matrix to ordered coefficients */
+template <typename ToImpl, typename Order, typename FromImpl>
+auto evalImpl(expr<Convert, OrderedQuaternionRotation<ToImpl, Order>>,
+              const MatrixRotation<FromImpl> &rhs)
+  -> OrderedQuaternionRotation<ToImpl, Order> {
+    using Scalar = scalar_t<MatrixRotation<FromImpl>>;
+    return OrderedQuaternionRotation<ToImpl, Order>{
+      Eigen::Quaternion<Scalar>{rhs.value()}};
+}
+
+// Estimated costs of the above, for choosing conversions. See eval_cost
+
+template <typename ToImpl, typename FromImpl, typename Order>
+struct eval_cost<expr<Convert, QuaternionRotation<ToImpl>>,
+                 OrderedQuaternionRotation<FromImpl, Order>>
+  : std::integral_constant<int, 0> {};
+
+template <typename ToImpl, typename FromImpl, typename Order>
+struct eval_cost<expr<Convert, MatrixRotation<ToImpl>>,
+                 OrderedQuaternionRotation<FromImpl, Order>>
+  : std::integral_constant<int, 30> {};
+
+}  // namespace internal
+
+// Convenience typedefs
+
+template <typename Order>
+using RotationOrderedQd = OrderedQuaternionRotation<Eigen::Matrix<double, 4, 1>, Order>;
+
+/** A rotation viewing four mapped coefficients in the given Order */
+template <typename Order>
+using RotationOrderedQMapd =
+  OrderedQuaternionRotation<Eigen::Map<Eigen::Matrix<double, 4, 1>>, Order>;
+
+template <typename Order, typename F1, typename F2>
+using RotationOrderedQFd = Framed<RotationOrderedQd<Order>, F1, F2>;
+
+template <typename Order, typename F1, typename F2>
+using RotationOrderedQMapFd = Framed<RotationOrderedQMapd<Order>, F1, F2>;
+
+}  // namespace wave
+
+#endif  // WAVE_GEOMETRY_ORDEREDQUATERNIONROTATION_HPP
@@ -0,0 +1,336 @@
+/**
+ * @file
+ */
+
+#ifndef WAVE_GEOMETRY_POINTCLOUD_HPP
+#define WAVE_GEOMETRY_POINTCLOUD_HPP
+
+namespace wave {
+
+/** A set of points in R^3, stored as the columns of a 3*N matrix
+ *
+ * Unlike TranslationBatch, which stores x, y and z in separate lanes, this is the layout
+ * of most point cloud data (e.g. an Eigen::Matrix3Xd, or a Map over the xyz fields of a
+ * larger point struct). It is meant to be transformed or rotated as a whole by a single
+ * pose: `T_AB * cloud_B` converts the rotation to a matrix once and then applies it to
+ * every point. See also transformPointsTo() and rotatePointsTo(), which write into an
+ * existing cloud and can give per-point jacobians.
+ *
+ * As for other batch leaves, frames are attached once with Framed, and jacobians of
+ * expressions involving point clouds are not implemented.
+ *
+ * @tparam ImplType The type to use for storage: Eigen::Matrix3Xd or a Map of one, which
+ * may have an outer stride (i.e. gaps between points).
+ *
+ * The aliases PointCloudd and PointCloudMapd are provided for the typical storage types.
+ */
+template <typename ImplType>
+class PointCloud : public TranslationBase<PointCloud<ImplType>>,
+                   public LeafExpression<ImplType, PointCloud<ImplType>> {
+    static_assert(internal::is_eigen_point_cloud<ImplType>::value,
+                  "ImplType must be an Eigen 3*N matrix type.");
+    static_assert(!ImplType::IsRowMajor, "ImplType must be column-major.");
+    using Scalar = typename ImplType::Scalar;
+    using ElementType = Translation<Eigen::Matrix<Scalar, 3, 1>>;
+    using Storage = LeafExpression<ImplType, PointCloud<ImplType>>;
+
+ public:
+    // Inherit constructors from LeafExpression
+    using Storage::Storage;
+    using Storage::operator=;
+
+    /** Constructs an empty cloud */
+    PointCloud() = default;
+
+    WAVE_DEFAULT_COPY_AND_MOVE_FUNCTIONS(PointCloud)
+
+    /** Constructs a cloud of n uninitialized points */
+    explicit PointCloud(Eigen::Index n)
+        : Storage{typename Storage::init_storage{}, 3, n} {}
+
+    /** Constructs from an Eigen 3*N matrix, or wraps it if ImplType is a Map */
+    template <typename OtherDerived,
+              TICK_REQUIRES(internal::is_eigen_point_cloud<OtherDerived>{})>
+    explicit PointCloud(const Eigen::MatrixBase<OtherDerived> &m)
+        : Storage{typename Storage::init_storage{}, m.derived()} {}
+
+    /** Constructs by moving from a matrix of the storage type, avoiding a copy */
+    explicit PointCloud(ImplType &&m)
+        : Storage{typename Storage::init_storage{}, std::move(m)} {}
+
+    /** Returns the number of points in the cloud */
+    Eigen::Index size() const noexcept {
+        return this->value().cols();
+    }
+
+    /** Returns a copy of the i'th point */
+    ElementType get(Eigen::Index i) const {
+        return ElementType{this->value().col(i)};
+    }
+
+    /** Sets the i'th point */
+    void set(Eigen::Index i, const ElementType &element) {
+        this->value().col(i) = element.value();
+    }
+};
+
+namespace internal {
+
+template <typename ImplType>
+struct traits<PointCloud<ImplType>>
+  : batch_leaf_traits_base<PointCloud<ImplType>>, frameable_vector_traits {
+    using typename batch_leaf_traits_base<PointCloud<ImplType>>::Scalar;
+    using ElementType = Translation<Eigen::Matrix<Scalar, 3, 1>>;
+    static constexpr int TangentSize = 3;
+};
+
+/** Returns whether the columns of m are stored one after another, without gaps */
+template <typename Derived>
+bool isPackedPointCloud(const Eigen::MatrixBase<Derived> &m) {
+    return m.derived().innerStride() == 1 && m.derived().outerStride() == 3;
+}
+
+/** Writes M * c + b to out, for each column c of in, a block of columns at a time
+ *
+ * Each block is computed into a small buffer before it is stored. This lets the
+ * products be vectorized without the compiler having to assume in and out overlap, and
+ * also makes it safe for out to be the same matrix as in.
+ */
+template <typename Scalar, int Rows, typename In, typename Out>
+void transformColumnsBlocked(const Eigen::Matrix<Scalar, Rows, Rows> &M,
+                             const Eigen::Matrix<Scalar, Rows, 1> &b,
+                             const Eigen::MatrixBase<In> &in,
+                             Eigen::MatrixBase<Out> &out) {
+    constexpr int BlockCols = 32;
+    Eigen::Matrix<Scalar, Rows, BlockCols> block;
+
+    const Eigen::Index n = in.cols();
+    Eigen::Index i = 0;
+    for (; i + BlockCols <= n; i += BlockCols) {
+        for (int j = 0; j < BlockCols; ++j) {
+            block.col(j).noalias() = M * in.col(i + j);
+        }
+        block.colwise() += b;
+        out.template middleCols<BlockCols>(i) = block;
+    }
+    for (; i < n; ++i) {
+        const Eigen::Matrix<Scalar, Rows, 1> c = M * in.col(i) + b;
+        out.col(i) = c;
+    }
+}
+
+/** Writes R * p + t to out, for each column p of in
+ *
+ * When both clouds are packed, points are taken in pairs, as 6-vectors multiplied by a
+ * block-diagonal 6*6 matrix, which Eigen vectorizes fully. Otherwise, and for the last
+ * point of an odd-sized cloud, points are taken one at a time.
+ *
+ * out may be the same matrix as in.
+ */
+template <typename Scalar, typename In, typename Out>
+void transformPointColumns(const Eigen::Matrix<Scalar, 3, 3> &R,
+                           const Eigen::Matrix<Scalar, 3, 1> &t,
+                           const Eigen::MatrixBase<In> &in,
+                           Eigen::MatrixBase<Out> &out) {
+    using Vec3 = Eigen::Matrix<Scalar, 3, 1>;
+    using Vec6 = Eigen::Matrix<Scalar, 6, 1>;
+    using Mat6 = Eigen::Matrix<Scalar, 6, 6>;
+    using Pairs = Eigen::Matrix<Scalar, 6, Eigen::Dynamic>;
+
+    if (!isPackedPointCloud(in) || !isPackedPointCloud(out)) {
+        transformColumnsBlocked(R, t, in, out);
+        return;
+    }
+
+    Mat6 R2 = Mat6::Zero();
+    R2.template topLeftCorner<3, 3>() = R;
+    R2.template bottomRightCorner<3, 3>() = R;
+    Vec6 t2;
+    t2 << t, t;
+
+    const Eigen::Index n = in.cols();
+    const Eigen::Map<const Pairs> in_pairs{in.derived().data(), 6, n / 2};
+    Eigen::Map<Pairs> out_pairs{out.derived().data(), 6, n / 2};
+    transformColumnsBlocked(R2, t2, in_pairs, out_pairs);
+
+    if (n % 2) {
+        const Vec3 p = R * in.col(n - 1) + t;
+        out.col(n - 1) = p;
+    }
+}
+
+/** Implements Transform of a point cloud by a single rigid transform */
+template <typename Lhs, typename Rhs>
+auto evalImpl(expr<Transform>,
+              const RigidTransformBase<Lhs> &lhs,
+              const PointCloud<Rhs> &rhs) -> plain_eval_t<PointCloud<Rhs>> {
+    using Scalar = scalar_t<Lhs>;
+    const MatrixRotation<Eigen::Matrix<Scalar, 3, 3>> R{lhs.derived().rotation()};
+    plain_eval_t<PointCloud<Rhs>> res{rhs.size()};
+    transformPointColumns<Scalar>(
+      R.value(), lhs.derived().translation().value(), rhs.value(), res.value());
+    return res;
+}
+
+/** Implements Rotate of a point cloud by a single rotation */
+template <typename Lhs, typename Rhs>
+auto evalImpl(expr<Rotate>, const RotationBase<Lhs> &lhs, const PointCloud<Rhs> &rhs)
+  -> plain_eval_t<PointCloud<Rhs>> {
+    using Scalar = scalar_t<Lhs>;
+    const MatrixRotation<Eigen::Matrix<Scalar, 3, 3>> R{lhs.derived()};
+    plain_eval_t<PointCloud<Rhs>> res{rhs.size()};
+    transformPointColumns<Scalar>(
+      R.value(), Eigen::Matrix<Scalar, 3, 1>::Zero(), rhs.value(), res.value());
+    return res;
+}
+
+/** Implements "conversion" between PointCloud types
+ *
+ * While this seems trivial, it is needed for the case the template params are not the
+ * same.
+ */
+template <typename ToImpl, typename FromImpl>
+auto evalImpl(expr<Convert, PointCloud<ToImpl>>, const PointCloud<FromImpl> &rhs)
+  -> PointCloud<ToImpl> {
+    return PointCloud<ToImpl>{rhs.value()};
+}
+
+/** Checks at compile time that Out is a point cloud with the given frames */
+template <typename Out, typename Left, typename Middle, typename Right>
+void checkPointCloudOutput() {
+    static_assert(is_eigen_point_cloud<tmp::remove_cr_t<decltype(
+                    unframedLeaf(std::declval<Out &>()).value())>>::value,
+                  "The output must be a PointCloud.");
+    static_assert(std::is_same<LeftFrameOf<Out>, Left>() &&
+                    std::is_same<MiddleFrameOf<Out>, Middle>() &&
+                    std::is_same<RightFrameOf<Out>, Right>(),
+                  "Mismatching frames");
+}
+
+/** Prepares out to hold n points: resizes a matrix, or checks the size of a Map */
+template <typename Derived>
+void resizePointCloud(Eigen::MatrixBase<Derived> &out, Eigen::Index n) {
+    out.derived().resize(3, n);
+}
+
+}  // namespace internal
+
+/** Transforms every point of a cloud by one rigid transform, writing the result to out
+ *
+ * Gives the same result as `out = pose * points`, with the same compile-time frame
+ * checks, but writes straight into out's storage. out may be points itself, to
+ * transform in place, or a Map into another buffer. A Map must already have the right
+ * number of points.
+ *
+ * @param pose a rigid transform expression, evaluated and converted to a rotation matrix
+ * once
+ * @param points a PointCloud, possibly Framed
+ * @param out a PointCloud with the frames of `pose * points`
+ */
+template <typename L, typename R, typename O>
+void transformPointsTo(const RigidTransformBase<L> &pose,
+                       const TranslationBase<R> &points,
+                       TranslationBase<O> &out) {
+    static_assert(std::is_same<RightFrameOf<L>, LeftFrameOf<R>>(), "Mismatching frames");
+    internal::checkPointCloudOutput<O, LeftFrameOf<L>, LeftFrameOf<L>, RightFrameOf<R>>();
+    using Scalar = internal::scalar_t<R>;
+
+    const auto T = eval(pose.derived());
+    const auto &T_leaf = internal::unframedLeaf(T);
+    const MatrixRotation<Eigen::Matrix<Scalar, 3, 3>> rot{T_leaf.rotation()};
+    const auto &in = internal::unframedLeaf(points.derived()).value();
+    auto &out_value = internal::unframedLeaf(out.derived()).value();
+
+    internal::resizePointCloud(out_value, in.cols());
+    internal::transformPointColumns<Scalar>(
+      rot.value(), T_leaf.translation().value(), in, out_value);
+}
+
+/** Transforms every point of a cloud, also giving the jacobian for each point
+ *
+ * jacobians is resized to hold, for each point, the jacobian of the transformed point
+ * with respect to the pose, as given by evalWithJacobians() for a single point.
+ */
+template <typename L, typename R, typename O>
+void transformPointsTo(const RigidTransformBase<L> &pose,
+                       const TranslationBase<R> &points,
+                       TranslationBase<O> &out,
+                       AlignedVector<Eigen::Matrix<internal::scalar_t<R>, 3, 6>>
+                         &jacobians) {
+    using Scalar = internal::scalar_t<R>;
+    transformPointsTo(pose, points, out);
+
+    const auto &q = internal::unframedLeaf(out.derived()).value();
+    jacobians.resize(q.cols());
+    for (Eigen::Index i = 0; i < q.cols(); ++i) {
+        // Same as leftJacobianImpl(expr<Transform>, ...)
+        jacobians[i] << crossMatrix(-q.col(i)), IdentityMatrix<Scalar, 3>{};
+    }
+}
+
+/** Rotates every point of a cloud by one rotation, writing the result to out
+ *
+ * Gives the same result as `out = rotation * points`, with the same compile-time frame
+ * checks, but writes straight into out's storage. out may be points itself, to rotate in
+ * place, or a Map into another buffer. A Map must already have the right number of
+ * points.
+ *
+ * @param rotation a rotation expression, evaluated and converted to a matrix once
+ * @param points a PointCloud, possibly Framed
+ * @param out a PointCloud with the frames of `rotation * points`
+ */
+template <typename L, typename R, typename O>
+void rotatePointsTo(const RotationBase<L> &rotation,
+                    const TranslationBase<R> &points,
+                    TranslationBase<O> &out) {
+    static_assert(std::is_same<RightFrameOf<L>, LeftFrameOf<R>>(), "Mismatching frames");
+    internal::
+      checkPointCloudOutput<O, LeftFrameOf<L>, MiddleFrameOf<R>, RightFrameOf<R>>();
+    using Scalar = internal::scalar_t<R>;
+
+    const auto rot_eval = eval(rotation.derived());
+    const MatrixRotation<Eigen::Matrix<Scalar, 3, 3>> rot{
+      internal::unframedLeaf(rot_eval)};
+    const auto &in = internal::unframedLeaf(points.derived()).value();
+    auto &out_value = internal::unframedLeaf(out.derived()).value();
+
+    internal::resizePointCloud(out_value, in.cols());
+    internal::transformPointColumns<Scalar>(
+      rot.value(), Eigen::Matrix<Scalar, 3, 1>::Zero(), in, out_value);
+}
+
+/** Rotates every point of a cloud, also giving the jacobian for each point
+ *
+ * jacobians is resized to hold, for each point, the jacobian of the rotated point with
+ * respect to the rotation, as given by evalWithJacobians() for a single point.
+ */
+template <typename L, typename R, typename O>
+void rotatePointsTo(const RotationBase<L> &rotation,
+                    const TranslationBase<R> &points,
+                    TranslationBase<O> &out,
+                    AlignedVector<Eigen::Matrix<internal::scalar_t<R>, 3, 3>>
+                      &jacobians) {
+    rotatePointsTo(rotation, points, out);
+
+    const auto &q = internal::unframedLeaf(out.derived()).value();
+    jacobians.resize(q.cols());
+    for (Eigen::Index i = 0; i < q.cols(); ++i) {
+        // Same as leftJacobianImpl(expr<Rotate>, ...)
+        jacobians[i] = crossMatrix(-q.col(i));
+    }
+}
+
+// Convenience typedefs
+
+using PointCloudd = PointCloud<Eigen::Matrix3Xd>;
+using PointCloudMapd = PointCloud<Eigen::Map<Eigen::Matrix3Xd, 0, Eigen::OuterStride<>>>;
+
+template <typename F1, typename F2, typename F3>
+using PointCloudFd = Framed<PointCloudd, F1, F2, F3>;
+
+template <typename F1, typename F2, typename F3>
+using PointCloudMapFd = Framed<PointCloudMapd, F1, F2, F3>;
+
+}  // namespace wave
+
+#endif  // WAVE_GEOMETRY_POINTCLOUD_HPP
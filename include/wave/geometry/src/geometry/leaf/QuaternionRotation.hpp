@@ -77,8 +77,49 @@ auto jacobianImpl(expr<Inverse>,
     return -q_inv.value().toRotationMatrix();
 }
 
-// No log map of quaternion. It will be automatically converted to rotation matrix
-// @todo maybe implement
+/** Implements log map of a quaternion, keeping the angle for the jacobian
+ *
+ * The angle is found with atan2, which is accurate both near zero and near pi. The
+ * quaternion is first negated if needed so that w >= 0, giving an angle at most pi.
+ */
+template <typename ImplType>
+auto evalWithAuxImpl(expr<LogMap>, const QuaternionRotation<ImplType> &rhs)
+  -> EvalWithAux<typename traits<QuaternionRotation<ImplType>>::TangentType,
+                 RotationAngleAux<scalar_t<QuaternionRotation<ImplType>>>> {
+    using Scalar = scalar_t<QuaternionRotation<ImplType>>;
+    using std::atan2;
+    using std::sqrt;
+    const auto &q = rhs.value();
+    const Scalar sign = laneSelect(laneGreater(Scalar{0}, Scalar{q.w()}), Scalar{-1},
+                                   Scalar{1});
+    const Scalar w = sign * q.w();
+    const Scalar n2 = q.vec().squaredNorm();
+    const Scalar n = sqrt(n2);
+    const Scalar angle = Scalar{2} * atan2(n, w);
+
+    // For very small n, use the Taylor expansion of the factor angle / n
+    const auto large = laneGreater(n2, Eigen::NumTraits<Scalar>::epsilon());
+    const Scalar factor =
+      laneSelect(large,
+                 Scalar{angle / n},
+                 Scalar{Scalar{2} / w * (Scalar{1} - n2 / (Scalar{3} * w * w))});
+
+    // The sine and cosine of the angle follow from those of the half angle, n and w
+    const Scalar inv_norm2 = Scalar{1} / (w * w + n2);
+    return {typename traits<QuaternionRotation<ImplType>>::TangentType{sign * factor *
+                                                                        q.vec()},
+            {angle * angle,
+             angle,
+             Scalar{Scalar{2} * n * w * inv_norm2},
+             Scalar{Scalar{1} - Scalar{2} * n2 * inv_norm2}}};
+}
+
+/** Implements log map of a quaternion */
+template <typename ImplType>
+auto evalImpl(expr<LogMap>, const QuaternionRotation<ImplType> &rhs) ->
+  typename traits<QuaternionRotation<ImplType>>::TangentType {
+    return evalWithAuxImpl(expr<LogMap>{}, rhs).value;
+}
 
 /** Implements composition of quaternions */
 template <typename Lhs, typename Rhs>
@@ -148,6 +189,35 @@ auto evalImpl(expr<Convert, QuaternionRotation<ToImpl>>,
     return QuaternionRotation<ToImpl>{rhs.value()};
 }
 
+// Estimated costs of the above, for choosing conversions. See eval_cost
+
+template <typename Rhs>
+struct eval_cost<expr<Inverse>, QuaternionRotation<Rhs>>
+  : std::integral_constant<int, 3> {};
+
+template <typename ImplType>
+struct eval_cost<expr<LogMap>, QuaternionRotation<ImplType>>
+  : std::integral_constant<int, 50> {};
+
+template <typename Lhs, typename Rhs>
+struct eval_cost<expr<Compose>, QuaternionRotation<Lhs>, QuaternionRotation<Rhs>>
+  : std::integral_constant<int, 28> {};
+
+template <typename Lhs, typename Rhs>
+struct eval_cost<expr<Rotate>, QuaternionRotation<Lhs>, Translation<Rhs>>
+  : std::integral_constant<int, 30> {};
+
+template <typename ToImpl, typename FromImpl>
+struct eval_cost<expr<Convert, QuaternionRotation<ToImpl>>, QuaternionRotation<FromImpl>>
+  : std::integral_constant<int, 0> {};
+
+template <typename ToImpl, typename FromImpl>
+struct eval_cost<expr<Convert, MatrixRotation<ToImpl>>, QuaternionRotation<FromImpl>>
+  : std::integral_constant<int, 30> {};
+
+template <typename ToImpl, typename FromImpl>
+struct eval_cost<expr<Convert, QuaternionRotation<ToImpl>>, MatrixRotation<FromImpl>>
+  : std::integral_constant<int, 50> {};
 
 }  // namespace internal
 
@@ -0,0 +1,221 @@
+/**
+ * @file
+ */
+
+#ifndef WAVE_GEOMETRY_QUATERNIONROTATIONBATCH_HPP
+#define WAVE_GEOMETRY_QUATERNIONROTATIONBATCH_HPP
+
+namespace wave {
+
+/** A batch of rotations on SO(3) stored as quaternions, in structure of arrays
+ *
+ * @tparam ImplType The type to use for storage (e.g. Eigen::Array<double, Eigen::Dynamic,
+ * 4> or a Map of one). Row i holds the coefficients of element i in Eigen::Quaternion
+ * order (x, y, z, w), so each of the four columns is a contiguous lane.
+ *
+ * The alias RotationQBatchd is provided for the typical storage type.
+ */
+template <typename ImplType>
+class QuaternionRotationBatch
+  : public RotationBase<QuaternionRotationBatch<ImplType>>,
+    public LeafExpression<ImplType, QuaternionRotationBatch<ImplType>> {
+    static_assert(internal::is_eigen_batch<4, ImplType>::value,
+                  "ImplType must be an Eigen N*4 array type.");
+    using Scalar = typename ImplType::Scalar;
+    using ElementType = QuaternionRotation<Eigen::Quaternion<Scalar>>;
+    using Storage = LeafExpression<ImplType, QuaternionRotationBatch<ImplType>>;
+
+ public:
+    // Inherit constructors from LeafExpression
+    using Storage::Storage;
+    using Storage::operator=;
+
+    /** Constructs an empty batch */
+    QuaternionRotationBatch() = default;
+
+    WAVE_DEFAULT_COPY_AND_MOVE_FUNCTIONS(QuaternionRotationBatch)
+
+    /** Constructs a batch of n uninitialized rotations */
+    explicit QuaternionRotationBatch(Eigen::Index n)
+        : Storage{typename Storage::init_storage{}, n, 4} {}
+
+    /** Constructs from an Eigen N*4 array */
+    template <typename OtherDerived,
+              TICK_REQUIRES(internal::is_eigen_batch<4, OtherDerived>{})>
+    explicit QuaternionRotationBatch(const Eigen::ArrayBase<OtherDerived> &a)
+        : Storage{typename Storage::init_storage{}, a.derived()} {}
+
+    /** Constructs by moving from an array of the storage type, avoiding a copy */
+    explicit QuaternionRotationBatch(ImplType &&a)
+        : Storage{typename Storage::init_storage{}, std::move(a)} {}
+
+    /** Returns the number of rotations in the batch */
+    Eigen::Index size() const noexcept {
+        return this->value().rows();
+    }
+
+    /** Returns a copy of the i'th rotation */
+    ElementType get(Eigen::Index i) const {
+        ElementType element;
+        Eigen::Map<Eigen::Array<Scalar, 1, 4>>{element.value().coeffs().data()} =
+          this->value().row(i);
+        return element;
+    }
+
+    /** Sets the i'th rotation */
+    void set(Eigen::Index i, const ElementType &element) {
+        this->value().row(i) =
+          Eigen::Map<const Eigen::Array<Scalar, 1, 4>>{element.value().coeffs().data()};
+    }
+};
+
+namespace internal {
+
+template <typename ImplType>
+struct traits<QuaternionRotationBatch<ImplType>>
+  : batch_leaf_traits_base<QuaternionRotationBatch<ImplType>>,
+    frameable_transform_traits {
+    using typename batch_leaf_traits_base<QuaternionRotationBatch<ImplType>>::Scalar;
+    using ElementType = QuaternionRotation<Eigen::Quaternion<Scalar>>;
+    using TangentType =
+      RelativeRotationBatch<Eigen::Array<Scalar, Eigen::Dynamic, 3>>;
+    static constexpr int TangentSize = 3;
+
+    using ConvertTo =
+      tmp::type_list<MatrixRotationBatch<Eigen::Array<Scalar, Eigen::Dynamic, 9>>>;
+};
+
+/** Hamilton products of quaternions over a batch, lane by lane.
+ *
+ * Each argument is an N*4 array of (x, y, z, w) coefficients.
+ */
+template <typename A, typename B>
+auto quaternionBatchProduct(const Eigen::ArrayBase<A> &a, const Eigen::ArrayBase<B> &b)
+  -> Eigen::Array<typename A::Scalar, Eigen::Dynamic, 4> {
+    Eigen::Array<typename A::Scalar, Eigen::Dynamic, 4> out{a.rows(), 4};
+    const auto &ax = a.col(0), &ay = a.col(1), &az = a.col(2), &aw = a.col(3);
+    const auto &bx = b.col(0), &by = b.col(1), &bz = b.col(2), &bw = b.col(3);
+
+    out.col(0) = aw * bx + ax * bw + ay * bz - az * by;
+    out.col(1) = aw * by + ay * bw + az * bx - ax * bz;
+    out.col(2) = aw * bz + az * bw + ax * by - ay * bx;
+    out.col(3) = aw * bw - ax * bx - ay * by - az * bz;
+    return out;
+}
+
+/** Rotates a batch of vectors by a batch of unit quaternions, lane by lane.
+ *
+ * @param q an N*4 array of (x, y, z, w) coefficients
+ * @param v an N*3 array of vector coefficients
+ */
+template <typename Q, typename V>
+auto quaternionBatchRotate(const Eigen::ArrayBase<Q> &q, const Eigen::ArrayBase<V> &v)
+  -> Eigen::Array<typename Q::Scalar, Eigen::Dynamic, 3> {
+    using Scalar = typename Q::Scalar;
+    using Lane = Eigen::Array<Scalar, Eigen::Dynamic, 1>;
+    const auto &qx = q.col(0), &qy = q.col(1), &qz = q.col(2), &qw = q.col(3);
+    const auto &vx = v.col(0), &vy = v.col(1), &vz = v.col(2);
+
+    // Same formula as Eigen's quaternion-vector product: with t = 2 * (q.vec() x v),
+    // the result is v + w * t + q.vec() x t
+    const Lane tx = Scalar{2} * (qy * vz - qz * vy);
+    const Lane ty = Scalar{2} * (qz * vx - qx * vz);
+    const Lane tz = Scalar{2} * (qx * vy - qy * vx);
+
+    Eigen::Array<Scalar, Eigen::Dynamic, 3> out{q.rows(), 3};
+    out.col(0) = vx + qw * tx + (qy * tz - qz * ty);
+    out.col(1) = vy + qw * ty + (qz * tx - qx * tz);
+    out.col(2) = vz + qw * tz + (qx * ty - qy * tx);
+    return out;
+}
+
+/** Conjugates a batch of quaternions, lane by lane */
+template <typename Q>
+auto quaternionBatchConjugate(const Eigen::ArrayBase<Q> &q)
+  -> Eigen::Array<typename Q::Scalar, Eigen::Dynamic, 4> {
+    Eigen::Array<typename Q::Scalar, Eigen::Dynamic, 4> out{q.rows(), 4};
+    out.template leftCols<3>() = -q.template leftCols<3>();
+    out.col(3) = q.col(3);
+    return out;
+}
+
+/** Converts a batch of unit quaternions to column-major rotation matrix coefficients */
+template <typename Q>
+auto quaternionBatchToRotationMatrix(const Eigen::ArrayBase<Q> &q)
+  -> Eigen::Array<typename Q::Scalar, Eigen::Dynamic, 9> {
+    using Scalar = typename Q::Scalar;
+    const auto &qx = q.col(0), &qy = q.col(1), &qz = q.col(2), &qw = q.col(3);
+
+    Eigen::Array<Scalar, Eigen::Dynamic, 9> out{q.rows(), 9};
+    out.col(0) = Scalar{1} - Scalar{2} * (qy * qy + qz * qz);
+    out.col(1) = Scalar{2} * (qx * qy + qw * qz);
+    out.col(2) = Scalar{2} * (qx * qz - qw * qy);
+    out.col(3) = Scalar{2} * (qx * qy - qw * qz);
+    out.col(4) = Scalar{1} - Scalar{2} * (qx * qx + qz * qz);
+    out.col(5) = Scalar{2} * (qy * qz + qw * qx);
+    out.col(6) = Scalar{2} * (qx * qz + qw * qy);
+    out.col(7) = Scalar{2} * (qy * qz - qw * qx);
+    out.col(8) = Scalar{1} - Scalar{2} * (qx * qx + qy * qy);
+    return out;
+}
+
+/** Implements inverse of a batch of quaternions */
+template <typename Rhs>
+auto evalImpl(expr<Inverse>, const QuaternionRotationBatch<Rhs> &rhs)
+  -> plain_eval_t<QuaternionRotationBatch<Rhs>> {
+    // Assume valid rotation quaternions
+    return plain_eval_t<QuaternionRotationBatch<Rhs>>{
+      quaternionBatchConjugate(rhs.value())};
+}
+
+/** Implements composition of batches of quaternions */
+template <typename Lhs, typename Rhs>
+auto evalImpl(expr<Compose>,
+              const QuaternionRotationBatch<Lhs> &lhs,
+              const QuaternionRotationBatch<Rhs> &rhs)
+  -> plain_eval_t<QuaternionRotationBatch<Lhs>> {
+    return plain_eval_t<QuaternionRotationBatch<Lhs>>{
+      quaternionBatchProduct(lhs.value(), rhs.value())};
+}
+
+/** Rotates a batch of translations by a batch of quaternions */
+template <typename Lhs, typename Rhs>
+auto evalImpl(expr<Rotate>,
+              const QuaternionRotationBatch<Lhs> &lhs,
+              const TranslationBatch<Rhs> &rhs) -> plain_eval_t<TranslationBatch<Rhs>> {
+    return plain_eval_t<TranslationBatch<Rhs>>{
+      quaternionBatchRotate(lhs.value(), rhs.value())};
+}
+
+/** Implements "conversion" between QuaternionRotationBatch types
+ *
+ * While this seems trivial, it is needed for the case the template params are not the
+ * same.
+ */
+template <typename ToImpl, typename FromImpl>
+auto evalImpl(expr<Convert, QuaternionRotationBatch<ToImpl>>,
+              const QuaternionRotationBatch<FromImpl> &rhs)
+  -> QuaternionRotationBatch<ToImpl> {
+    return QuaternionRotationBatch<ToImpl>{rhs.value()};
+}
+
+/** Converts from a batch of quaternions to a batch of rotation matrices */
+template <typename ToImpl, typename FromImpl>
+auto evalImpl(expr<Convert, MatrixRotationBatch<ToImpl>>,
+              const QuaternionRotationBatch<FromImpl> &rhs)
+  -> MatrixRotationBatch<ToImpl> {
+    return MatrixRotationBatch<ToImpl>{quaternionBatchToRotationMatrix(rhs.value())};
+}
+
+}  // namespace internal
+
+// Convenience typedefs
+
+using RotationQBatchd = QuaternionRotationBatch<Eigen::Array<double, Eigen::Dynamic, 4>>;
+
+template <typename F1, typename F2>
+using RotationQBatchFd = Framed<RotationQBatchd, F1, F2>;
+
+}  // namespace wave
+
+#endif  // WAVE_GEOMETRY_QUATERNIONROTATIONBATCH_HPP
@@ -88,31 +88,94 @@ template <typename ImplType>
 struct traits<RelativeRotation<ImplType>>
   : vector_leaf_traits_base<RelativeRotation<ImplType>> {
     using ExpType = MatrixRotation<Eigen::Matrix<typename ImplType::Scalar, 3, 3>>;
+    using ExpConvertTo =
+      tmp::type_list<QuaternionRotation<Eigen::Quaternion<typename ImplType::Scalar>>>;
 };
 
-/** Implements exp map of a relative rotation into a rotation matrix */
+/** Relative rotations are evaluated in Lanes by batches */
+template <typename ImplType, int N>
+struct lane_leaf<RelativeRotation<ImplType>,
+                 N,
+                 tmp::enable_if_t<std::is_floating_point<typename ImplType::Scalar>{}>> {
+    using type =
+      RelativeRotation<Eigen::Matrix<Lanes<typename ImplType::Scalar, N>, 3, 1>>;
+};
+
+/** Implements exp map of a relative rotation into a rotation matrix, keeping the angle
+ * for the jacobian */
 template <typename ImplType>
-auto evalImpl(expr<ExpMap>, const RelativeRotation<ImplType> &rhs) ->
-  typename traits<RelativeRotation<ImplType>>::ExpType {
+auto evalWithAuxImpl(expr<ExpMap>, const RelativeRotation<ImplType> &rhs)
+  -> EvalWithAux<typename traits<RelativeRotation<ImplType>>::ExpType,
+                 RotationAngleAux<typename ImplType::Scalar>> {
     using ExpType = typename traits<RelativeRotation<ImplType>>::ExpType;
     using Scalar = typename ImplType::Scalar;
-    using Mat3 = Eigen::Matrix<Scalar, 3, 3>;
-    using std::sin;
-    using std::cos;
-    using std::sqrt;
     const auto &r = rhs.value();
     // Rodrigues formula - see http://ethaneade.com/lie.pdf
-    const auto angle2 = r.squaredNorm();
-    const auto angle = sqrt(angle2);
-    if (angle2 > Eigen::NumTraits<Scalar>::epsilon()) {
-        return ExpType{Mat3::Identity() + sin(angle) / angle * crossMatrix(r) +
-                       (Scalar{1} - cos(angle)) / angle2 * crossMatrix(r) *
-                         crossMatrix(r)};
-    } else {
-        // Small angle: use Taylor expansions
-        return ExpType{Mat3::Identity() + crossMatrix(r) +
-                       Scalar{0.5} * crossMatrix(r) * crossMatrix(r)};
-    }
+    const auto aux = rotationAngleAux(r);
+    const Scalar angle2 = aux.angle2;
+    // For small angles, where 1 - cos loses digits, use Taylor expansions
+    const auto large = laneGreater(angle2, taylorThreshold<1, Scalar>());
+    const Scalar A = laneSelect(
+      large,
+      Scalar{aux.sin_angle / aux.angle},
+      Scalar{Scalar{1} - angle2 * (Scalar{1.0 / 6} - angle2 * Scalar{1.0 / 120})});
+    const Scalar B = laneSelect(
+      large,
+      Scalar{(Scalar{1} - aux.cos_angle) / angle2},
+      Scalar{Scalar{0.5} - angle2 * (Scalar{1.0 / 24} - angle2 * Scalar{1.0 / 720})});
+    return {ExpType{rodriguesMatrix(r, angle2, A, B)}, aux};
+}
+
+/** Implements exp map of a relative rotation into a rotation matrix */
+template <typename ImplType>
+auto evalImpl(expr<ExpMap>, const RelativeRotation<ImplType> &rhs) ->
+  typename traits<RelativeRotation<ImplType>>::ExpType {
+    return evalWithAuxImpl(expr<ExpMap>{}, rhs).value;
+}
+
+/** Jacobian of exp map of a rotation vector phi with squared norm n2, given the rotation
+ * matrix C of the result
+ *
+ * The Rodrigues coefficients A = sin(t) / t and B = (1 - cos(t)) / t^2 are read from C,
+ * so only they are chosen between closed forms and Taylor series, and one matrix is
+ * built.
+ */
+template <typename MatDerived, typename VecDerived>
+auto expMapJacobian(const Eigen::MatrixBase<MatDerived> &C,
+                    const Eigen::MatrixBase<VecDerived> &phi,
+                    const typename VecDerived::Scalar &n2)
+  -> Eigen::Matrix<typename VecDerived::Scalar, 3, 3> {
+    using Scalar = typename VecDerived::Scalar;
+    using Jacobian = Eigen::Matrix<Scalar, 3, 3>;
+
+    // Bloesch Equation 80, which is A I + B [phi]x + ((1 - A) / n2) phi phi^T.
+    // C - C^T is 2 A [phi]x, and the trace of C is 1 + 2 cos(t).
+    const auto large = laneGreater(n2, taylorThreshold<1, Scalar>());
+    const Scalar A = laneSelect(
+      large,
+      Scalar{uncrossMatrix(Jacobian{C - C.transpose()}).dot(phi) / (Scalar{2} * n2)},
+      Scalar{Scalar{1} - n2 * (Scalar{1.0 / 6} - n2 * Scalar{1.0 / 120})});
+    const Scalar B = laneSelect(
+      large,
+      Scalar{(Scalar{3} - C.trace()) / (Scalar{2} * n2)},
+      Scalar{Scalar{0.5} - n2 * (Scalar{1.0 / 24} - n2 * Scalar{1.0 / 720})});
+    const Scalar D = laneSelect(
+      large,
+      Scalar{(Scalar{1} - A) / n2},
+      Scalar{Scalar{1.0 / 6} - n2 * (Scalar{1.0 / 120} - n2 * Scalar{1.0 / 5040})});
+    return A * Jacobian::Identity() + B * crossMatrix(phi) + D * (phi * phi.transpose());
+}
+
+/** Jacobian of exp map of a relative rotation, given the angle kept by
+ * evalWithAuxImpl() */
+template <typename Val, typename ImplType>
+auto jacobianImpl(expr<ExpMap>,
+                  const RotationBase<Val> &val,
+                  const RotationAngleAux<typename ImplType::Scalar> &aux,
+                  const RelativeRotation<ImplType> &rhs)
+  -> jacobian_t<Val, RelativeRotation<ImplType>> {
+    // The rotation matrix of the SO(3) output
+    return expMapJacobian(val.derived().value(), rhs.value(), aux.angle2);
 }
 
 /** Jacobian of exp map of a relative rotation */
@@ -121,21 +184,75 @@ auto jacobianImpl(expr<ExpMap>,
                   const RotationBase<Val> &val,
                   const RelativeRotation<ImplType> &rhs)
   -> jacobian_t<Val, RelativeRotation<ImplType>> {
-    using Jacobian = jacobian_t<Val, RelativeRotation<ImplType>>;
+    return expMapJacobian(val.derived().value(), rhs.value(), rhs.value().squaredNorm());
+}
+
+/** Implements exp map of a relative rotation directly into a quaternion, keeping the
+ * angle for the jacobian */
+template <typename ToImpl, typename ImplType>
+auto evalWithAuxImpl(expr<ExpMapTo, QuaternionRotation<ToImpl>>,
+                     const RelativeRotation<ImplType> &rhs)
+  -> EvalWithAux<QuaternionRotation<ToImpl>,
+                 RotationAngleAux<typename ImplType::Scalar>> {
     using Scalar = typename ImplType::Scalar;
-    const auto &phi = rhs.value();
-    const auto &C = val.derived().value();  // Rotation matrix of the SO(3) output
-
-    // Bloesch Equation 80, with adjustment for near-zero case
-    const auto pcross = crossMatrix(phi);  // cross-matrix of the so(3) input
-    const auto n2 = phi.squaredNorm();     // squared norm of the input
-    if (n2 > Eigen::NumTraits<Scalar>::epsilon()) {
-        return ((Jacobian::Identity() - C) * pcross + (phi * phi.transpose())) / n2;
-    } else {
-        return Jacobian::Identity() + Scalar{0.5} * pcross;
-    }
+    using std::sqrt;
+    const auto &r = rhs.value();
+    const Scalar angle2 = r.squaredNorm();
+    const Scalar angle = sqrt(angle2);
+    Scalar s, c;
+    sinCos(Scalar{angle / Scalar{2}}, s, c);
+    // For small angles, use the Taylor expansion of sin(angle / 2) / angle
+    const auto large = laneGreater(angle2, Eigen::NumTraits<Scalar>::epsilon());
+    const Scalar k =
+      laneSelect(large, Scalar{s / angle}, Scalar{Scalar{0.5} - angle2 / 48});
+    EvalWithAux<QuaternionRotation<ToImpl>, RotationAngleAux<Scalar>> out;
+    out.value.value().w() = c;
+    out.value.value().vec() = k * r;
+    out.aux = {
+      angle2, angle, Scalar{Scalar{2} * s * c}, Scalar{Scalar{1} - Scalar{2} * s * s}};
+    return out;
+}
+
+/** Implements exp map of a relative rotation directly into a quaternion */
+template <typename ToImpl, typename ImplType>
+auto evalImpl(expr<ExpMapTo, QuaternionRotation<ToImpl>> tag,
+              const RelativeRotation<ImplType> &rhs) -> QuaternionRotation<ToImpl> {
+    return evalWithAuxImpl(tag, rhs).value;
+}
+
+/** Jacobian of exp map of a relative rotation into a quaternion, given the angle kept by
+ * evalWithAuxImpl()
+ *
+ * This is the jacobian of the matrix exp map, which depends only on the rotation. */
+template <typename Val, typename ImplType>
+auto jacobianImpl(expr<ExpMapTo, QuaternionRotation<Val>>,
+                  const QuaternionRotation<Val> &val,
+                  const RotationAngleAux<typename ImplType::Scalar> &aux,
+                  const RelativeRotation<ImplType> &rhs)
+  -> jacobian_t<QuaternionRotation<Val>, RelativeRotation<ImplType>> {
+    return expMapJacobian(val.value().toRotationMatrix(), rhs.value(), aux.angle2);
 }
 
+/** Jacobian of exp map of a relative rotation into a quaternion */
+template <typename Val, typename ImplType>
+auto jacobianImpl(expr<ExpMapTo, QuaternionRotation<Val>>,
+                  const QuaternionRotation<Val> &val,
+                  const RelativeRotation<ImplType> &rhs)
+  -> jacobian_t<QuaternionRotation<Val>, RelativeRotation<ImplType>> {
+    return expMapJacobian(
+      val.value().toRotationMatrix(), rhs.value(), rhs.value().squaredNorm());
+}
+
+// Estimated costs of the above, for choosing conversions. See eval_cost
+
+template <typename ImplType>
+struct eval_cost<expr<ExpMap>, RelativeRotation<ImplType>>
+  : std::integral_constant<int, 90> {};
+
+template <typename ToImpl, typename ImplType>
+struct eval_cost<expr<ExpMapTo, QuaternionRotation<ToImpl>>, RelativeRotation<ImplType>>
+  : std::integral_constant<int, 70> {};
+
 }  // namespace internal
 
 // Convenience typedefs
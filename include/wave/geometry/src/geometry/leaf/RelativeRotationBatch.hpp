@@ -0,0 +1,265 @@
+/**
+ * @file
+ */
+
+#ifndef WAVE_GEOMETRY_RELATIVEROTATIONBATCH_HPP
+#define WAVE_GEOMETRY_RELATIVEROTATIONBATCH_HPP
+
+namespace wave {
+
+/** A batch of relative rotations in so(3), stored as structure of arrays
+ *
+ * @tparam ImplType The type to use for storage (e.g. Eigen::Array<double, Eigen::Dynamic,
+ * 3> or a Map of one). Row i holds the rotation vector of element i; each column is a
+ * contiguous lane.
+ *
+ * The alias RelativeRotationBatchd is provided for the typical storage type.
+ */
+template <typename ImplType>
+class RelativeRotationBatch
+  : public RelativeRotationBase<RelativeRotationBatch<ImplType>>,
+    public LeafExpression<ImplType, RelativeRotationBatch<ImplType>> {
+    static_assert(internal::is_eigen_batch<3, ImplType>::value,
+                  "ImplType must be an Eigen N*3 array type.");
+    using Scalar = typename ImplType::Scalar;
+    using ElementType = RelativeRotation<Eigen::Matrix<Scalar, 3, 1>>;
+    using Storage = LeafExpression<ImplType, RelativeRotationBatch<ImplType>>;
+
+ public:
+    // Inherit constructors from LeafExpression
+    using Storage::Storage;
+    using Storage::operator=;
+
+    /** Constructs an empty batch */
+    RelativeRotationBatch() = default;
+
+    WAVE_DEFAULT_COPY_AND_MOVE_FUNCTIONS(RelativeRotationBatch)
+
+    /** Constructs a batch of n uninitialized elements */
+    explicit RelativeRotationBatch(Eigen::Index n)
+        : Storage{typename Storage::init_storage{}, n, 3} {}
+
+    /** Constructs from an Eigen N*3 array */
+    template <typename OtherDerived,
+              TICK_REQUIRES(internal::is_eigen_batch<3, OtherDerived>{})>
+    explicit RelativeRotationBatch(const Eigen::ArrayBase<OtherDerived> &a)
+        : Storage{typename Storage::init_storage{}, a.derived()} {}
+
+    /** Constructs by moving from an array of the storage type, avoiding a copy */
+    explicit RelativeRotationBatch(ImplType &&a)
+        : Storage{typename Storage::init_storage{}, std::move(a)} {}
+
+    /** Returns the number of elements in the batch */
+    Eigen::Index size() const noexcept {
+        return this->value().rows();
+    }
+
+    /** Returns a copy of the i'th element */
+    ElementType get(Eigen::Index i) const {
+        ElementType element;
+        Eigen::Map<Eigen::Array<Scalar, 1, 3>>{element.value().data()} =
+          this->value().row(i);
+        return element;
+    }
+
+    /** Sets the i'th element */
+    void set(Eigen::Index i, const ElementType &element) {
+        this->value().row(i) =
+          Eigen::Map<const Eigen::Array<Scalar, 1, 3>>{element.value().data()};
+    }
+};
+
+namespace internal {
+
+template <typename ImplType>
+struct traits<RelativeRotationBatch<ImplType>>
+  : batch_leaf_traits_base<RelativeRotationBatch<ImplType>>, frameable_vector_traits {
+    using typename batch_leaf_traits_base<RelativeRotationBatch<ImplType>>::Scalar;
+    using ElementType = RelativeRotation<Eigen::Matrix<Scalar, 3, 1>>;
+    using ExpType = MatrixRotationBatch<Eigen::Array<Scalar, Eigen::Dynamic, 9>>;
+    static constexpr int TangentSize = 3;
+};
+
+/** Computes a I + b [phi]_x + c [phi]_x^2 for a batch of rotation vectors, lane by lane.
+ *
+ * This is the form of the Rodrigues formula and of the SO(3) jacobians. It is expanded
+ * using [phi]_x^2 = phi phi^T - theta^2 I, so no matrix products are needed.
+ *
+ * @param phi an N*3 array of rotation vectors
+ * @param theta2 an N*1 array of their squared norms
+ * @return an N*9 array of column-major matrix coefficients
+ */
+template <typename Phi, typename T2, typename A, typename B, typename C>
+auto rodriguesBatch(const Eigen::ArrayBase<Phi> &phi,
+                    const Eigen::ArrayBase<T2> &theta2,
+                    const Eigen::ArrayBase<A> &a,
+                    const Eigen::ArrayBase<B> &b,
+                    const Eigen::ArrayBase<C> &c)
+  -> Eigen::Array<typename Phi::Scalar, Eigen::Dynamic, 9> {
+    Eigen::Array<typename Phi::Scalar, Eigen::Dynamic, 9> out{phi.rows(), 9};
+    const auto &x = phi.col(0), &y = phi.col(1), &z = phi.col(2);
+
+    const Eigen::Array<typename Phi::Scalar, Eigen::Dynamic, 1> diag = a - c * theta2;
+    out.col(0) = diag + c * x * x;
+    out.col(4) = diag + c * y * y;
+    out.col(8) = diag + c * z * z;
+    out.col(1) = c * x * y + b * z;
+    out.col(3) = c * x * y - b * z;
+    out.col(2) = c * x * z - b * y;
+    out.col(6) = c * x * z + b * y;
+    out.col(5) = c * y * z + b * x;
+    out.col(7) = c * y * z - b * x;
+    return out;
+}
+
+/** Exp map of a batch of rotation vectors into rotation matrix coefficients
+ *
+ * Computes the same Rodrigues formula as the single-element ExpMap, including its
+ * small-angle case, but branch-free using batchSinCos() and batchSelect(). The sine and
+ * cosine of the half angle are used, so that (1 - cos theta) is computed without
+ * cancellation.
+ *
+ * @param phi an N*3 array of rotation vectors
+ * @return an N*9 array of column-major matrix coefficients
+ */
+template <typename Phi>
+auto expMapBatch(const Eigen::ArrayBase<Phi> &phi)
+  -> Eigen::Array<typename Phi::Scalar, Eigen::Dynamic, 9> {
+    using Scalar = typename Phi::Scalar;
+    using Lane = Eigen::Array<Scalar, Eigen::Dynamic, 1>;
+    const auto n = phi.rows();
+
+    const Lane theta2 = phi.square().rowwise().sum();
+    const Lane theta = batchSqrt(theta2);
+    Lane s, c;
+    batchSinCos(Scalar{0.5} * theta, s, c);
+
+    const Lane large =
+      batchStep(theta2, Lane::Constant(n, Eigen::NumTraits<Scalar>::epsilon()));
+    const Lane A = batchSelect(large, Scalar{2} * s * c / theta, Lane::Ones(n));
+    const Lane B =
+      batchSelect(large, Scalar{2} * s * s / theta2, Lane::Constant(n, Scalar{0.5}));
+    return rodriguesBatch(phi, theta2, Lane::Ones(n), A, B);
+}
+
+/** Jacobian of the exp map for a batch of rotation vectors
+ *
+ * This is the left jacobian of SO(3), I + B [phi]_x + (1 - A) / theta^2 [phi]_x^2, equal
+ * to the single-element ExpMap jacobian.
+ *
+ * @param phi an N*3 array of rotation vectors
+ * @return an N*9 array of column-major 3x3 jacobian coefficients
+ */
+template <typename Phi>
+auto expMapJacobianBatch(const Eigen::ArrayBase<Phi> &phi)
+  -> Eigen::Array<typename Phi::Scalar, Eigen::Dynamic, 9> {
+    using Scalar = typename Phi::Scalar;
+    using Lane = Eigen::Array<Scalar, Eigen::Dynamic, 1>;
+    const auto n = phi.rows();
+
+    const Lane theta2 = phi.square().rowwise().sum();
+    const Lane theta = batchSqrt(theta2);
+    Lane s, c;
+    batchSinCos(Scalar{0.5} * theta, s, c);
+
+    const Lane large =
+      batchStep(theta2, Lane::Constant(n, Eigen::NumTraits<Scalar>::epsilon()));
+    const Lane A = Scalar{2} * s * c / theta;
+    const Lane B =
+      batchSelect(large, Scalar{2} * s * s / theta2, Lane::Constant(n, Scalar{0.5}));
+    const Lane C =
+      batchSelect(large, (Scalar{1} - A) / theta2, Lane::Constant(n, Scalar{1} / 6));
+    return rodriguesBatch(phi, theta2, Lane::Ones(n), B, C);
+}
+
+/** Log map of a batch of rotation matrices into rotation vectors
+ *
+ * As in the single-element LogMap, the angle is found as atan2 of the sine and cosine
+ * parts of the matrix.
+ *
+ * @param m an N*9 array of column-major rotation matrix coefficients
+ * @return an N*3 array of rotation vectors
+ */
+template <typename M>
+auto logMapBatch(const Eigen::ArrayBase<M> &m)
+  -> Eigen::Array<typename M::Scalar, Eigen::Dynamic, 3> {
+    using Scalar = typename M::Scalar;
+    using Lane = Eigen::Array<Scalar, Eigen::Dynamic, 1>;
+    const auto n = m.rows();
+
+    // v = vee(m - m^T) = 2 sin(theta) * axis
+    Eigen::Array<Scalar, Eigen::Dynamic, 3> v{n, 3};
+    v.col(0) = m.col(5) - m.col(7);
+    v.col(1) = m.col(6) - m.col(2);
+    v.col(2) = m.col(1) - m.col(3);
+
+    const Lane sin_theta = Scalar{0.5} * batchSqrt(v.square().rowwise().sum());
+    const Lane cos_theta = Scalar{0.5} * (m.col(0) + m.col(4) + m.col(8) - Scalar{1});
+    const Lane theta = batchAtan2(sin_theta, cos_theta);
+
+    const Lane large = batchStep(theta * theta,
+                                 Lane::Constant(n, Eigen::NumTraits<Scalar>::epsilon()));
+    const Lane factor = batchSelect(
+      large, theta / (Scalar{2} * sin_theta), Lane::Constant(n, Scalar{0.5}));
+    return v.colwise() * factor;
+}
+
+/** Jacobian of the log map, given the batch of results of the log map
+ *
+ * This is the inverse left jacobian of SO(3), I - 1/2 [phi]_x + D [phi]_x^2, equal to the
+ * single-element LogMap jacobian. For small angles the Taylor expansion of D is used.
+ *
+ * @param phi an N*3 array of rotation vectors
+ * @return an N*9 array of column-major 3x3 jacobian coefficients
+ */
+template <typename Phi>
+auto logMapJacobianBatch(const Eigen::ArrayBase<Phi> &phi)
+  -> Eigen::Array<typename Phi::Scalar, Eigen::Dynamic, 9> {
+    using Scalar = typename Phi::Scalar;
+    using Lane = Eigen::Array<Scalar, Eigen::Dynamic, 1>;
+    const auto n = phi.rows();
+
+    const Lane theta2 = phi.square().rowwise().sum();
+    const Lane theta = batchSqrt(theta2);
+    Lane s, c;
+    batchSinCos(Scalar{0.5} * theta, s, c);
+
+    // D = 1/theta^2 - (1 + cos theta) / (2 theta sin theta), written with half angles
+    const Lane large =
+      batchStep(theta2, Lane::Constant(n, Eigen::NumTraits<Scalar>::epsilon()));
+    const Lane D = batchSelect(large,
+                               Scalar{1} / theta2 - c / (Scalar{2} * theta * s),
+                               Scalar{1} / 12 + theta2 / 720);
+    return rodriguesBatch(phi, theta2, Lane::Ones(n), Lane::Constant(n, -0.5), D);
+}
+
+/** Implements exp map of a batch of relative rotations into a batch of rotation matrices
+ */
+template <typename ImplType>
+auto evalImpl(expr<ExpMap>, const RelativeRotationBatch<ImplType> &rhs) ->
+  typename traits<RelativeRotationBatch<ImplType>>::ExpType {
+    using ExpType = typename traits<RelativeRotationBatch<ImplType>>::ExpType;
+    return ExpType{expMapBatch(rhs.value())};
+}
+
+/** Implements log map of a batch of rotation matrices */
+template <typename ImplType>
+auto evalImpl(expr<LogMap>, const MatrixRotationBatch<ImplType> &rhs) ->
+  typename traits<MatrixRotationBatch<ImplType>>::TangentType {
+    using TangentType = typename traits<MatrixRotationBatch<ImplType>>::TangentType;
+    return TangentType{logMapBatch(rhs.value())};
+}
+
+}  // namespace internal
+
+// Convenience typedefs
+
+using RelativeRotationBatchd =
+  RelativeRotationBatch<Eigen::Array<double, Eigen::Dynamic, 3>>;
+
+template <typename F1, typename F2, typename F3>
+using RelativeRotationBatchFd = Framed<RelativeRotationBatchd, F1, F2, F3>;
+
+}  // namespace wave
+
+#endif  // WAVE_GEOMETRY_RELATIVEROTATIONBATCH_HPP
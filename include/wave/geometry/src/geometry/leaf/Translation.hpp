@@ -47,6 +47,14 @@ namespace internal {
 template <typename ImplType>
 struct traits<Translation<ImplType>> : vector_leaf_traits_base<Translation<ImplType>> {};
 
+/** Translations are evaluated in Lanes by batches */
+template <typename ImplType, int N>
+struct lane_leaf<Translation<ImplType>,
+                 N,
+                 tmp::enable_if_t<std::is_floating_point<typename ImplType::Scalar>{}>> {
+    using type = Translation<Eigen::Matrix<Lanes<typename ImplType::Scalar, N>, 3, 1>>;
+};
+
 }  // namespace internal
 
 // Convenience typedefs
@@ -0,0 +1,92 @@
+/**
+ * @file
+ */
+
+#ifndef WAVE_GEOMETRY_TRANSLATIONBATCH_HPP
+#define WAVE_GEOMETRY_TRANSLATIONBATCH_HPP
+
+namespace wave {
+
+/** A batch of translations or points in R^3, stored as structure of arrays
+ *
+ * @tparam ImplType The type to use for storage (e.g. Eigen::Array<double, Eigen::Dynamic,
+ * 3> or a Map of one). Row i holds the x, y, z coefficients of element i; each column is
+ * a contiguous lane.
+ *
+ * The alias TranslationBatchd is provided for the typical storage type.
+ */
+template <typename ImplType>
+class TranslationBatch : public TranslationBase<TranslationBatch<ImplType>>,
+                         public LeafExpression<ImplType, TranslationBatch<ImplType>> {
+    static_assert(internal::is_eigen_batch<3, ImplType>::value,
+                  "ImplType must be an Eigen N*3 array type.");
+    using Scalar = typename ImplType::Scalar;
+    using ElementType = Translation<Eigen::Matrix<Scalar, 3, 1>>;
+    using Storage = LeafExpression<ImplType, TranslationBatch<ImplType>>;
+
+ public:
+    // Inherit constructors from LeafExpression
+    using Storage::Storage;
+    using Storage::operator=;
+
+    /** Constructs an empty batch */
+    TranslationBatch() = default;
+
+    WAVE_DEFAULT_COPY_AND_MOVE_FUNCTIONS(TranslationBatch)
+
+    /** Constructs a batch of n uninitialized elements */
+    explicit TranslationBatch(Eigen::Index n)
+        : Storage{typename Storage::init_storage{}, n, 3} {}
+
+    /** Constructs from an Eigen N*3 array */
+    template <typename OtherDerived,
+              TICK_REQUIRES(internal::is_eigen_batch<3, OtherDerived>{})>
+    explicit TranslationBatch(const Eigen::ArrayBase<OtherDerived> &a)
+        : Storage{typename Storage::init_storage{}, a.derived()} {}
+
+    /** Constructs by moving from an array of the storage type, avoiding a copy */
+    explicit TranslationBatch(ImplType &&a)
+        : Storage{typename Storage::init_storage{}, std::move(a)} {}
+
+    /** Returns the number of elements in the batch */
+    Eigen::Index size() const noexcept {
+        return this->value().rows();
+    }
+
+    /** Returns a copy of the i'th element */
+    ElementType get(Eigen::Index i) const {
+        ElementType element;
+        Eigen::Map<Eigen::Array<Scalar, 1, 3>>{element.value().data()} =
+          this->value().row(i);
+        return element;
+    }
+
+    /** Sets the i'th element */
+    void set(Eigen::Index i, const ElementType &element) {
+        this->value().row(i) =
+          Eigen::Map<const Eigen::Array<Scalar, 1, 3>>{element.value().data()};
+    }
+};
+
+namespace internal {
+
+template <typename ImplType>
+struct traits<TranslationBatch<ImplType>>
+  : batch_leaf_traits_base<TranslationBatch<ImplType>>, frameable_vector_traits {
+    using typename batch_leaf_traits_base<TranslationBatch<ImplType>>::Scalar;
+    using ElementType = Translation<Eigen::Matrix<Scalar, 3, 1>>;
+    static constexpr int TangentSize = 3;
+};
+
+}  // namespace internal
+
+// Convenience typedefs
+
+using TranslationBatchd = TranslationBatch<Eigen::Array<double, Eigen::Dynamic, 3>>;
+
+template <typename F1, typename F2, typename F3>
+using TranslationBatchFd = Framed<TranslationBatchd, F1, F2, F3>;
+
+}  // namespace wave
+
+#endif  // WAVE_GEOMETRY_TRANSLATIONBATCH_HPP
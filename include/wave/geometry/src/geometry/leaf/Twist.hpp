@@ -85,86 +85,85 @@ struct traits<Twist<ImplType>> : vector_leaf_traits_base<Twist<ImplType>> {
     using ExpType = MatrixRigidTransform<Eigen::Matrix<typename ImplType::Scalar, 4, 4>>;
 };
 
-/** Implements exp map of a twist into a MatrixRigidTransform
+/** Implements exp map of a twist into a MatrixRigidTransform, keeping the angle for
+ * the jacobian
  *
  * @todo - evaluate to either
  */
 template <typename ImplType>
-auto evalImpl(expr<ExpMap>, const Twist<ImplType> &rhs) ->
-  typename traits<Twist<ImplType>>::ExpType {
+auto evalWithAuxImpl(expr<ExpMap>, const Twist<ImplType> &rhs)
+  -> EvalWithAux<typename traits<Twist<ImplType>>::ExpType,
+                 RotationAngleAux<typename ImplType::Scalar>> {
     using Scalar = typename ImplType::Scalar;
     using Mat3 = Eigen::Matrix<Scalar, 3, 3>;
 
     // For now, calculate expmap in two parts
-    typename traits<Twist<ImplType>>::ExpType out{};
+    using ExpType = typename traits<Twist<ImplType>>::ExpType;
+    EvalWithAux<ExpType, RotationAngleAux<Scalar>> out{};
 
     // Equations: see http://ethaneade.com/lie.pdf
-    // @todo optimize
-    const auto &omega = rhs.rotation().value();  // the rotation part
-    const auto theta2 = omega.squaredNorm();
-    const auto theta = std::sqrt(theta2);
-    if (theta2 > Eigen::NumTraits<Scalar>::epsilon()) {
-        const auto A = std::sin(theta) / theta;
-        const auto B = (Scalar{1.0} - std::cos(theta)) / theta2;
-        const auto C = (Scalar{1.0} - A) / theta2;
-        const Mat3 cross = crossMatrix(omega);
-        const Mat3 cross2 = cross * cross;
-        const Mat3 V = Mat3::Identity() + B * cross + C * cross2;
-        out.translation().value() = V * rhs.translation().value();
-        out.rotation().value() = Mat3::Identity() + A * cross + B * cross2;
-    } else {
-        // small theta2; use Taylor expansions
-        const auto A = Scalar{1.0};
-        const auto B = Scalar{0.0};
-        const auto C = Scalar{0.0};
-        const Mat3 cross = crossMatrix(omega);
-        const Mat3 cross2 = cross * cross;
-        const Mat3 V = Mat3::Identity() + B * cross + C * cross2;
-        out.translation().value() = V * rhs.translation().value();
-        out.rotation().value() = Mat3::Identity() + A * cross + B * cross2;
-    }
+    const auto omega = rhs.value().template head<3>();  // the rotation part
+    out.aux = rotationAngleAux(omega);
+    const Scalar theta2 = out.aux.angle2;
+    const Scalar theta = out.aux.angle;
+
+    // For small angles, where B and C lose digits, use Taylor expansions
+    const auto large = laneGreater(theta2, taylorThreshold<1, Scalar>());
+    const Scalar A = laneSelect(
+      large,
+      Scalar{out.aux.sin_angle / theta},
+      Scalar{Scalar{1} - theta2 * (Scalar{1.0 / 6} - theta2 * Scalar{1.0 / 120})});
+    const Scalar B = laneSelect(
+      large,
+      Scalar{(Scalar{1.0} - out.aux.cos_angle) / theta2},
+      Scalar{Scalar{0.5} - theta2 * (Scalar{1.0 / 24} - theta2 * Scalar{1.0 / 720})});
+    const Scalar C = laneSelect(
+      large,
+      Scalar{(Scalar{1.0} - A) / theta2},
+      Scalar{Scalar{1.0 / 6} -
+             theta2 * (Scalar{1.0 / 120} - theta2 * Scalar{1.0 / 5040})});
+
+    const Mat3 V = rodriguesMatrix(omega, theta2, B, C);
+    out.value.translation().value() = V * rhs.translation().value();
+    out.value.rotation().value() = rodriguesMatrix(omega, theta2, A, B);
 
     return out;
 }
 
-/** Jacobian of ExpMap for a twist */
+/** Implements exp map of a twist into a MatrixRigidTransform */
+template <typename ImplType>
+auto evalImpl(expr<ExpMap>, const Twist<ImplType> &rhs) ->
+  typename traits<Twist<ImplType>>::ExpType {
+    return evalWithAuxImpl(expr<ExpMap>{}, rhs).value;
+}
+
+/** Jacobian of ExpMap for a twist, given the angle kept by evalWithAuxImpl() */
 template <typename Val, typename Rhs>
-auto jacobianImpl(expr<ExpMap>, const TransformBase<Val> &val, const TwistBase<Rhs> &rhs)
-  -> jacobian_t<Val, Rhs> {
+auto jacobianImpl(expr<ExpMap>,
+                  const TransformBase<Val> &val,
+                  const RotationAngleAux<scalar_t<Rhs>> &aux,
+                  const TwistBase<Rhs> &rhs) -> BlockLowerTriangular<scalar_t<Val>, 3> {
     using Scalar = scalar_t<Val>;
     using Mat3 = Eigen::Matrix<Scalar, 3, 3>;
 
     // From http://ethaneade.org/exp_diff.pdf - note we swap order of rotation and
     // translation
-    using std::cos;
-    using std::sin;
+
     // First get Jacobian of expmap of rotation part only
-    const auto &Drot =
-      jacobianImpl(expr<ExpMap>{}, val.derived().rotation(), rhs.derived().rotation());
-
-    const auto &omega = rhs.derived().rotation().value();
-    const auto &u = rhs.derived().translation().value();
-    const auto theta2 = omega.squaredNorm();
-    const auto theta = sqrt(theta2);
-    const auto a = sin(theta) / theta;
-    const auto b = (1 - cos(theta)) / theta2;
-    const auto c = (1 - a) / theta2;
-    // Calculate Eade's "W" term
-    const Mat3 W = (c - b) * Mat3::Identity() +
-                   (a - 2 * b) / theta2 * crossMatrix(omega) +
-                   (b - 3 * c) / theta2 * omega * omega.transpose();
-
-    // Calculate Eade's "B" term
-    const Mat3 B = b * crossMatrix(u) +
-                   c * (omega * u.transpose() + u * omega.transpose()) + omega.dot(u) * W;
-
-
-    Eigen::Matrix<Scalar, 6, 6> out{};
-    out.template topLeftCorner<3, 3>() = Drot;
-    out.template bottomLeftCorner<3, 3>() = B;
-    out.template topRightCorner<3, 3>().setZero();
-    out.template bottomRightCorner<3, 3>() = Drot;
-    return out;
+    const Mat3 Drot = jacobianImpl(
+      expr<ExpMap>{}, val.derived().rotation(), aux, rhs.derived().rotation());
+    const Mat3 B = twistCouplingTerm(
+      rhs.derived().rotation().value(), rhs.derived().translation().value(), aux);
+
+    return BlockLowerTriangular<Scalar, 3>{Drot, B, Drot};
+}
+
+/** Jacobian of ExpMap for a twist */
+template <typename Val, typename Rhs>
+auto jacobianImpl(expr<ExpMap>, const TransformBase<Val> &val, const TwistBase<Rhs> &rhs)
+  -> BlockLowerTriangular<scalar_t<Val>, 3> {
+    return jacobianImpl(
+      expr<ExpMap>{}, val, rotationAngleAux(rhs.derived().rotation().value()), rhs);
 }
 
 }  // namespace internal
@@ -93,6 +93,49 @@ auto evalImpl(expr<ExpMap>, const Zero<Rhs> &)
     return Identity<typename traits<Rhs>::ExpType>{};
 }
 
+template <typename Lhs, typename Rhs>
+auto evalImpl(expr<Rotate>, const RotationBase<Lhs> &, const Zero<Rhs> &rhs)
+  -> const Zero<Rhs> & {
+    return rhs;
+}
+
+template <typename Lhs, typename Rhs>
+auto evalImpl(expr<AdjointAction>, const RigidTransformBase<Lhs> &, const Zero<Rhs> &rhs)
+  -> const Zero<Rhs> & {
+    return rhs;
+}
+
+// Rewrite rules removing Zero leaves from the tree entirely
+
+template <typename Lhs, typename Rhs>
+struct rewrite_rule<Sum<Lhs, Rhs>,
+                    tmp::enable_if_t<is_zero<tmp::remove_cr_t<Rhs>>{} &&
+                                     !is_zero<tmp::remove_cr_t<Lhs>>{}>> {
+    using type = Lhs;
+
+    static auto run(const Sum<Lhs, Rhs> &e) -> rewrite_return_t<Sum<Lhs, Rhs>, Lhs> {
+        return e.lhs();
+    }
+};
+
+template <typename Lhs, typename Rhs>
+struct rewrite_rule<Sum<Lhs, Rhs>, tmp::enable_if_t<is_zero<tmp::remove_cr_t<Lhs>>{}>> {
+    using type = Rhs;
+
+    static auto run(const Sum<Lhs, Rhs> &e) -> rewrite_return_t<Sum<Lhs, Rhs>, Rhs> {
+        return e.rhs();
+    }
+};
+
+template <typename Rhs>
+struct rewrite_rule<Minus<Rhs>, tmp::enable_if_t<is_zero<tmp::remove_cr_t<Rhs>>{}>> {
+    using type = Rhs;
+
+    static auto run(const Minus<Rhs> &e) -> rewrite_return_t<Minus<Rhs>, Rhs> {
+        return e.rhs();
+    }
+};
+
 /** Jacobian of exp map of a zero element */
 template <typename Val, typename Rhs>
 auto jacobianImpl(expr<ExpMap>, const TransformBase<Val> &, const Zero<Rhs> &)
@@ -100,6 +143,35 @@ auto jacobianImpl(expr<ExpMap>, const TransformBase<Val> &, const Zero<Rhs> &)
     return identity_t<Rhs>{};
 }
 
+/** Jacobian of rotating a zero vector wrt the rotation, which is zero */
+template <typename Val, typename Lhs, typename Rhs>
+auto leftJacobianImpl(expr<Rotate>,
+                      const Zero<Val> &,
+                      const RotationBase<Lhs> &,
+                      const Zero<Rhs> &) -> zero_t<Val, Lhs> {
+    return zero_t<Val, Lhs>{};
+}
+
+/** Jacobian of rotating a zero vector wrt the vector, which is the rotation matrix */
+template <typename Val, typename Lhs, typename Rhs>
+auto rightJacobianImpl(expr<Rotate>,
+                       const Zero<Val> &,
+                       const RotationBase<Lhs> &lhs,
+                       const Zero<Rhs> &) -> jacobian_t<Val, Rhs> {
+    return jacobian_t<Val, Rhs>{lhs.derived().value()};
+}
+
+/** Jacobian of the adjoint action on a zero twist wrt the transform, which is zero
+ *
+ * The jacobian wrt the twist is the adjoint, as for any twist. */
+template <typename Val, typename Lhs, typename Rhs>
+auto leftJacobianImpl(expr<AdjointAction>,
+                      const Zero<Val> &,
+                      const RigidTransformBase<Lhs> &,
+                      const Zero<Rhs> &) -> zero_t<Val, Lhs> {
+    return zero_t<Val, Lhs>{};
+}
+
 }  // namespace internal
 }  // namespace wave
 
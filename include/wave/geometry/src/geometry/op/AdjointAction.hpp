@@ -0,0 +1,56 @@
+/**
+ * @file
+ */
+
+#ifndef WAVE_GEOMETRY_ADJOINTACTION_HPP
+#define WAVE_GEOMETRY_ADJOINTACTION_HPP
+
+namespace wave {
+
+/** The adjoint of a rigid transform, before it is applied to a twist
+ *
+ * This is not an expression: it holds the transform only until it is multiplied by a
+ * twist, giving an AdjointAction. It is returned by `adjoint()`.
+ *
+ * @tparam Lhs a transformation in SE(3), as in a binary expression's template arguments
+ */
+template <typename Lhs>
+struct AdjointOf {
+    template <typename LhsArg>
+    explicit AdjointOf(LhsArg &&l) : lhs_{std::forward<LhsArg>(l)} {}
+
+    internal::wave_ref_sel_t<Lhs> lhs_;
+};
+
+/** The adjoint of a rigid transform applied to a twist
+ *
+ * For a transform @f$ T = (R, t) @f$ and a twist @f$ (\omega, v) @f$,
+ *
+ * @f[ \text{Ad}(T) \begin{bmatrix} \omega \\ v \end{bmatrix}
+ *   = \begin{bmatrix} R \omega \\ t \times R \omega + R v \end{bmatrix} @f]
+ *
+ * @tparam Lhs a transformation in SE(3)
+ * @tparam Rhs a twist in se(3)
+ */
+template <typename Lhs, typename Rhs>
+struct AdjointAction : internal::base_tmpl_t<Rhs, AdjointAction<Lhs, Rhs>>,
+                       BinaryExpression<AdjointAction<Lhs, Rhs>> {
+    // Inherit constructors from BinaryExpression
+    using BinaryExpression<AdjointAction<Lhs, Rhs>>::BinaryExpression;
+
+    static_assert(std::is_same<RightFrameOf<Lhs>, LeftFrameOf<Rhs>>(),
+                  "Mismatching frames");
+};
+
+namespace internal {
+
+template <typename Lhs, typename Rhs>
+struct traits<AdjointAction<Lhs, Rhs>> : binary_traits_base<AdjointAction<Lhs, Rhs>> {
+    using OutputFunctor =
+      WrapWithFrames<LeftFrameOf<Lhs>, MiddleFrameOf<Rhs>, RightFrameOf<Rhs>>;
+};
+
+}  // namespace internal
+}  // namespace wave
+
+#endif  // WAVE_GEOMETRY_ADJOINTACTION_HPP
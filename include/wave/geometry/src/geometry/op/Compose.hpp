@@ -23,6 +23,24 @@ struct Compose : internal::base_tmpl_t<Lhs, Rhs, Compose<Lhs, Rhs>>,
                   "Adjacent frames do not match");
 };
 
+/** A modified Compose equivalent to Compose<Inverse<Lhs>, Rhs>. It is not meant to be
+ * directly used, but is produced by rewriting such expressions where the inverse can be
+ * folded into the product.
+ */
+template <typename Lhs, typename Rhs>
+struct InverseCompose : internal::base_tmpl_t<Lhs, Rhs, InverseCompose<Lhs, Rhs>>,
+                        BinaryExpression<InverseCompose<Lhs, Rhs>> {
+ private:
+    using Storage = BinaryExpression<InverseCompose<Lhs, Rhs>>;
+
+ public:
+    // Inherit constructors from BinaryExpression
+    using Storage::Storage;
+
+    static_assert(std::is_same<LeftFrameOf<Lhs>, LeftFrameOf<Rhs>>(),
+                  "Adjacent frames do not match");
+};
+
 /** A modified Compose equivalent to Compose<Rhs, Lhs> but with operands evaluated in
  * reverse order. It is not meant to be directly used, but forms a part of the composite
  * expression BoxPlus.
@@ -53,6 +71,98 @@ struct traits<ComposeFlipped<Lhs, Rhs>> : binary_traits_base<ComposeFlipped<Lhs,
     using OutputFunctor = WrapWithFrames<LeftFrameOf<Rhs>, RightFrameOf<Lhs>>;
 };
 
+template <typename Lhs, typename Rhs>
+struct traits<InverseCompose<Lhs, Rhs>> : binary_traits_base<InverseCompose<Lhs, Rhs>> {
+    using OutputFunctor = WrapWithFrames<RightFrameOf<Lhs>, RightFrameOf<Rhs>>;
+};
+
+/** Rewrites a product of inverses to the inverse of one product, saving an inversion
+ *
+ * Rotation matrices are inverted for free, and use InverseCompose instead. */
+template <typename Lhs, typename Rhs>
+struct rewrite_rule<Compose<Inverse<Lhs>, Inverse<Rhs>>,
+                    tmp::enable_if_t<!(is_matrix_rotation<clean_eval_t<Lhs>>{} &&
+                                       is_matrix_rotation<clean_eval_t<Rhs>>{})>> {
+    using type = Inverse<ComposeFlipped<Lhs, Rhs>>;
+
+    static auto run(const Compose<Inverse<Lhs>, Inverse<Rhs>> &e) -> type {
+        return type{ComposeFlipped<Lhs, Rhs>{e.lhs().rhs(), e.rhs().rhs()}};
+    }
+};
+
+/** Whether applying the product Product to a vector is cheaper as two applications
+ *
+ * This holds for rotation matrices and rigid transforms, whose products cost more than
+ * applying them to a vector twice, but not for quaternion rotations. */
+template <typename Product>
+struct is_reassociated_product
+  : tmp::bool_constant<is_matrix_rotation<clean_eval_t<Product>>{} ||
+                       is_rt_leaf<clean_eval_t<Product>>{}> {};
+
+/** Builds Tmpl<Lhs, Rhs>, the application (Rotate or Transform) of Lhs to a vector Rhs,
+ * reassociating any products in Lhs
+ *
+ * A product applied to a vector, (A * B) * v, becomes A * (B * v). This recurses through
+ * the product, so R1 * R2 * ... * RN * v becomes N matrix-vector products instead of
+ * N - 1 matrix-matrix products and one matrix-vector product. The leaves keep their
+ * order, but the rules below are value-only: in the backward sweep for jacobians, each
+ * nested application costs two adjoint products, more than the products it saves.
+ */
+template <template <typename, typename> class Tmpl,
+          typename Lhs,
+          typename Rhs,
+          typename Enable = void>
+struct reassociate_apply {
+    using type = Tmpl<Lhs, Rhs>;
+
+    template <typename LhsArg, typename RhsArg>
+    static auto run(LhsArg &&lhs, RhsArg &&rhs) -> type {
+        return type{std::forward<LhsArg>(lhs), std::forward<RhsArg>(rhs)};
+    }
+};
+
+template <template <typename, typename> class Tmpl, typename A, typename B, typename Rhs>
+struct reassociate_apply<Tmpl,
+                         Compose<A, B>,
+                         Rhs,
+                         tmp::enable_if_t<is_reassociated_product<Compose<A, B>>{}>> {
+ private:
+    using Inner = reassociate_apply<Tmpl, B, Rhs>;
+    using Outer = reassociate_apply<Tmpl, A, typename Inner::type>;
+
+ public:
+    using type = typename Outer::type;
+
+    template <typename RhsArg>
+    static auto run(const Compose<A, B> &lhs, RhsArg &&rhs) -> type {
+        return Outer::run(lhs.lhs(), Inner::run(lhs.rhs(), std::forward<RhsArg>(rhs)));
+    }
+};
+
+/** Rewrites a product of rotations applied to a vector, R1 * R2 * v, as R1 * (R2 * v) */
+template <typename A, typename B, typename Rhs>
+struct rewrite_rule<Rotate<Compose<A, B>, Rhs>,
+                    tmp::enable_if_t<is_reassociated_product<Compose<A, B>>{}>> {
+    using type = typename reassociate_apply<Rotate, Compose<A, B>, Rhs>::type;
+    using ValueOnly = std::true_type;
+
+    static auto run(const Rotate<Compose<A, B>, Rhs> &e) -> type {
+        return reassociate_apply<Rotate, Compose<A, B>, Rhs>::run(e.lhs(), e.rhs());
+    }
+};
+
+/** Rewrites a product of transforms applied to a point, T1 * T2 * p, as T1 * (T2 * p) */
+template <typename A, typename B, typename Rhs>
+struct rewrite_rule<Transform<Compose<A, B>, Rhs>,
+                    tmp::enable_if_t<is_reassociated_product<Compose<A, B>>{}>> {
+    using type = typename reassociate_apply<Transform, Compose<A, B>, Rhs>::type;
+    using ValueOnly = std::true_type;
+
+    static auto run(const Transform<Compose<A, B>, Rhs> &e) -> type {
+        return reassociate_apply<Transform, Compose<A, B>, Rhs>::run(e.lhs(), e.rhs());
+    }
+};
+
 /** Left Jacobian of any composition is identity */
 template <typename Val, typename Lhs, typename Rhs>
 auto leftJacobianImpl(expr<Compose>,
@@ -23,6 +23,32 @@ struct ExpMap
     using Storage::Storage;
 };
 
+/** Expression representing the exponential map of a relative rotation, evaluated
+ * directly to the leaf type ToLeaf rather than to its usual ExpType
+ *
+ * It is not written by hand: an ExpMap whose output would be converted to ToLeaf is
+ * replaced by ExpMapTo when that is cheaper. See operand_conversion.
+ *
+ * @tparam ToLeaf The leaf type to evaluate to
+ * @tparam Rhs The relative rotation expression in so(3)
+ */
+template <typename ToLeaf, typename Rhs>
+struct ExpMapTo : internal::base_tmpl_t<ToLeaf, ExpMapTo<ToLeaf, Rhs>>,
+                  UnaryExpression<ExpMapTo<ToLeaf, Rhs>> {
+ private:
+    using Storage = UnaryExpression<ExpMapTo<ToLeaf, Rhs>>;
+
+ public:
+    // Inherit constructors from UnaryExpression
+    using Storage::Storage;
+
+    /** Constructs from the ExpMap this replaces */
+    explicit ExpMapTo(const ExpMap<Rhs> &e) : Storage{e.rhs()} {}
+
+    /** Constructs from the ExpMap this replaces, when it is an rvalue */
+    explicit ExpMapTo(ExpMap<Rhs> &&e) : Storage{std::move(e).rhs()} {}
+};
+
 namespace internal {
 
 template <typename Rhs>
@@ -30,6 +56,84 @@ struct traits<ExpMap<Rhs>> : unary_traits_base<ExpMap<Rhs>> {
     using OutputFunctor = WrapWithFrames<LeftFrameOf<Rhs>, LeftFrameOf<Rhs>>;
 };
 
+template <typename ToLeaf, typename Rhs>
+struct traits<ExpMapTo<ToLeaf, Rhs>> : unary_traits_base<ExpMapTo<ToLeaf, Rhs>> {
+    using OutputFunctor = WrapWithFrames<LeftFrameOf<Rhs>, LeftFrameOf<Rhs>>;
+};
+
+/** The leaf types, other than ExpType, to which a tangent leaf's exp map is evaluated
+ * directly. These are listed as `ExpConvertTo` in the tangent's traits, if at all.
+ */
+template <typename RhsEval, typename = void>
+struct exp_convert_to {
+    using type = tmp::type_list<>;
+};
+
+template <typename RhsEval>
+struct exp_convert_to<RhsEval, tmp::void_t<typename traits<RhsEval>::ExpConvertTo>> {
+    using type = typename traits<RhsEval>::ExpConvertTo;
+};
+
+/** An exp map may be converted to the types its output converts to, and also to those
+ * it can give directly */
+template <typename Rhs>
+struct operand_convert_to<ExpMap<Rhs>> {
+    using type = tmp::concat_t<typename traits<clean_eval_t<ExpMap<Rhs>>>::ConvertTo,
+                               typename exp_convert_to<clean_eval_t<Rhs>>::type>;
+};
+
+/** Converting an exp map to a leaf type it can give directly replaces it with ExpMapTo.
+ *
+ * The cost is the difference from evaluating the ExpMap itself, which may be negative.
+ */
+template <typename To, typename Rhs>
+struct operand_conversion<
+  To,
+  ExpMap<Rhs>,
+  tmp::enable_if_t<is_directly_evaluable_unary<expr<ExpMapTo, To>, eval_t<Rhs>>{}>>
+  : std::true_type {
+    using type = ExpMapTo<To, Rhs>;
+    static constexpr int cost = eval_cost<expr<ExpMapTo, To>, eval_t<Rhs>>::value -
+                                eval_cost<expr<ExpMap>, eval_t<Rhs>>::value;
+};
+
+/** Rewrites a conversion of an exp map, to a leaf type it can give directly, to ExpMapTo
+ *
+ * Operands are replaced by operand_conversion above, but an explicit conversion such as
+ * `RotationQd{exp(w)}` is only prepared after the Convert node is built. */
+template <typename To, typename Rhs>
+struct rewrite_rule<
+  Convert<To, ExpMap<Rhs>>,
+  tmp::enable_if_t<is_directly_evaluable_unary<expr<ExpMapTo, To>, eval_t<Rhs>>{}>> {
+    using type = ExpMapTo<To, Rhs>;
+
+    static auto run(const Convert<To, ExpMap<Rhs>> &e) -> type {
+        return type{e.rhs()};
+    }
+};
+
+/** Rewrites the exp map of a log map to the original element */
+template <typename ExtraFrame, typename Rhs>
+struct rewrite_rule<ExpMap<LogMap<ExtraFrame, Rhs>>> {
+    using type = Rhs;
+
+    static auto run(const ExpMap<LogMap<ExtraFrame, Rhs>> &e)
+      -> rewrite_return_t<ExpMap<LogMap<ExtraFrame, Rhs>>, Rhs> {
+        return e.rhs().rhs();
+    }
+};
+
+/** Rewrites the exp map of a log map, evaluated to another leaf type, to a conversion of
+ * the original element */
+template <typename ToLeaf, typename ExtraFrame, typename Rhs>
+struct rewrite_rule<ExpMapTo<ToLeaf, LogMap<ExtraFrame, Rhs>>> {
+    using type = Convert<ToLeaf, Rhs>;
+
+    static auto run(const ExpMapTo<ToLeaf, LogMap<ExtraFrame, Rhs>> &e) -> type {
+        return type{e.rhs().rhs()};
+    }
+};
+
 }  // namespace internal
 }  // namespace wave
 
@@ -24,6 +24,17 @@ struct traits<Inverse<Rhs>> : unary_traits_base<Inverse<Rhs>> {
     using OutputFunctor = WrapWithFrames<RightFrameOf<Rhs>, LeftFrameOf<Rhs>>;
 };
 
+/** Rewrites a double inverse to the inverted expression */
+template <typename Rhs>
+struct rewrite_rule<Inverse<Inverse<Rhs>>> {
+    using type = Rhs;
+
+    static auto run(const Inverse<Inverse<Rhs>> &e)
+      -> rewrite_return_t<Inverse<Inverse<Rhs>>, Rhs> {
+        return e.rhs().rhs();
+    }
+};
+
 }  // namespace internal
 }  // namespace wave
 
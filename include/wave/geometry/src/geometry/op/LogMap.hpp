@@ -31,32 +31,45 @@ struct traits<LogMap<ExtraFrame, Rhs>>
     using OutputFunctor = WrapWithFrames<LeftFrameOf<Rhs>, LeftFrameOf<Rhs>, ExtraFrame>;
 };
 
-/** Jacobian of logmap of any rotation
+/** Jacobian of logmap of any rotation, given the angle kept by evalWithAuxImpl()
  *
  * It only uses the result, thus is independent of the rotation parametrization.
  * */
 template <typename Val, typename Rhs>
 auto jacobianImpl(expr<LogMap>,
                   const RelativeRotation<Val> &val,
+                  const RotationAngleAux<scalar_t<Rhs>> &aux,
                   const RotationBase<Rhs> &) -> jacobian_t<RelativeRotation<Val>, Rhs> {
     using Scalar = scalar_t<Rhs>;
     using Jacobian = jacobian_t<RelativeRotation<Val>, Rhs>;
     const auto &phi = val.value();
     // From http://ethaneade.org/exp_diff.pdf
-    using std::cos;
-    using std::sin;
-    const auto theta2 = phi.squaredNorm();
-    const auto theta = sqrt(theta2);
-    const auto A = sin(theta) / theta;
-    const auto B = (Scalar{1} - cos(theta)) / theta2;
+    const Scalar theta2 = aux.angle2;
+    const Scalar A = aux.sin_angle / aux.angle;
+    const Scalar B = (Scalar{1} - aux.cos_angle) / theta2;
 
-    //        if (theta2 > Eigen::NumTraits<Scalar>::epsilon()) {
+    // For small angles, use the Taylor expansion of the last coefficient. It loses
+    // about eps / theta^4 to cancellation, so it switches at the K = 2 threshold.
+    const auto large = laneGreater(theta2, taylorThreshold<2, Scalar>());
+    const Scalar D = laneSelect(
+      large,
+      Scalar{(B - Scalar{0.5} * A) / (Scalar{1} - aux.cos_angle)},
+      Scalar{Scalar{1.0 / 12} +
+             theta2 * (Scalar{1.0 / 720} + theta2 * Scalar{1.0 / 30240})});
     return Jacobian::Identity() - Scalar{0.5} * crossMatrix(phi) +
-           ((B - Scalar{0.5} * A) / (Scalar{1} - cos(theta))) * crossMatrix(phi) *
-             crossMatrix(phi);
-    //        } else {
-    // @todo small input
-    //        }
+           D * crossMatrix(phi) * crossMatrix(phi);
+}
+
+/** Jacobian of logmap of any rotation
+ *
+ * It only uses the result, thus is independent of the rotation parametrization.
+ * */
+template <typename Val, typename Rhs>
+auto jacobianImpl(expr<LogMap>,
+                  const RelativeRotation<Val> &val,
+                  const RotationBase<Rhs> &rhs)
+  -> jacobian_t<RelativeRotation<Val>, Rhs> {
+    return jacobianImpl(expr<LogMap>{}, val, rotationAngleAux(val.value()), rhs);
 }
 
 }  // namespace internal
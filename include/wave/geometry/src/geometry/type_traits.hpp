@@ -61,6 +61,34 @@ TICK_TRAIT(is_transform_leaf, is_leaf_expression<_>) {
               decltype(x.translation())>;
 };
 
+TICK_TRAIT(is_batch_leaf, is_leaf_expression<_>) {
+    template <class T>
+    auto require(T &&)->valid<typename internal::traits<T>::ElementType>;
+};
+
+// Traits for recognizing operands in rewrite rules
+
+/** Evaluates to true_type if T is an Identity leaf */
+template <typename T>
+struct is_identity : std::false_type {};
+
+template <typename Leaf>
+struct is_identity<Identity<Leaf>> : std::true_type {};
+
+/** Evaluates to true_type if T is a Zero leaf */
+template <typename T>
+struct is_zero : std::false_type {};
+
+template <typename Leaf>
+struct is_zero<Zero<Leaf>> : std::true_type {};
+
+/** Evaluates to true_type if T is a MatrixRotation leaf */
+template <typename T>
+struct is_matrix_rotation : std::false_type {};
+
+template <typename ImplType>
+struct is_matrix_rotation<MatrixRotation<ImplType>> : std::true_type {};
+
 // Traits for checking for Eigen expressions
 
 /** Aliases true_type if the T is an Eigen NxN matrix expression */
@@ -88,6 +116,21 @@ using is_eigen_vector =
   tmp::bool_constant<T::IsVectorAtCompileTime && T::SizeAtCompileTime == N &&
                      T::IsVectorAtCompileTime>;
 
+/** Aliases true_type if the T is an Eigen array expression with N columns, suitable for
+ * storing a batch of objects with N coefficients each (one column per coefficient) */
+template <int N, typename T>
+using is_eigen_batch =
+  tmp::bool_constant<std::is_base_of<Eigen::ArrayBase<T>, T>::value &&
+                     T::ColsAtCompileTime == N>;
+
+/** Aliases true_type if the T is an Eigen matrix expression with 3 rows and a dynamic
+ * number of columns, suitable for storing a point cloud (one column per point) */
+template <typename T>
+using is_eigen_point_cloud =
+  tmp::bool_constant<std::is_base_of<Eigen::MatrixBase<T>, T>::value &&
+                     T::RowsAtCompileTime == 3 &&
+                     T::ColsAtCompileTime == Eigen::Dynamic>;
+
 }  // namespace internal
 }  // namespace wave
 
@@ -0,0 +1,272 @@
+/**
+ * @file
+ * Defines an Eigen expression for the adjoint matrix of a rigid transform, which is
+ * multiplied using only its rotation and translation.
+ */
+
+#ifndef WAVE_GEOMETRY_ADJOINTMATRIX_HPP
+#define WAVE_GEOMETRY_ADJOINTMATRIX_HPP
+
+#include <Eigen/Geometry>
+#include "wave/geometry/src/util/meta/template_helpers.hpp"
+#include "wave/geometry/src/util/math/CrossMatrix.hpp"
+#include "wave/geometry/src/util/math/ZeroMatrix.hpp"
+#include "wave/geometry/src/util/math/BlockMatrix.hpp"
+
+namespace wave {
+namespace internal {
+
+/** Functor giving the coefficients of an adjoint matrix from R and t */
+template <typename Scalar>
+struct adjoint_op {
+    using Mat3 = Eigen::Matrix<Scalar, 3, 3>;
+    using Vec3 = Eigen::Matrix<Scalar, 3, 1>;
+
+    EIGEN_STRONG_INLINE Scalar operator()(Eigen::Index i, Eigen::Index j) const {
+        if (i < 3) {
+            return j < 3 ? this->R(i, j) : Scalar{0};
+        }
+        if (j >= 3) {
+            return this->R(i - 3, j - 3);
+        }
+        // Row (i - 3) of crossMatrix(t) * R
+        const auto k = i - 3;
+        return this->t((k + 1) % 3) * this->R((k + 2) % 3, j) -
+               this->t((k + 2) % 3) * this->R((k + 1) % 3, j);
+    }
+
+    Mat3 R;
+    Vec3 t;
+};
+
+}  // namespace internal
+
+/**
+ * An Eigen expression for the adjoint of a rigid transform with rotation R and
+ * translation t,
+ *
+ * @f[ \text{Ad}(T) = \begin{bmatrix} R & 0 \\ t^{\times} R & R \end{bmatrix} @f]
+ *
+ * with rotation before translation, as in Twist. R must be a rotation matrix. Only R
+ * and t are stored. Products with other matrices use block formulas, and the product of
+ * two adjoints is the adjoint of the composed transforms. Its 36 coefficients are found
+ * only if it is used as a plain matrix.
+ */
+// The implementation of an Eigen expression here was guided by
+// https://eigen.tuxfamily.org/dox/TopicNewExpressionType.html
+template <typename Scalar>
+class AdjointMatrix : public Eigen::CwiseNullaryOp<internal::adjoint_op<Scalar>,
+                                                   Eigen::Matrix<Scalar, 6, 6>> {
+ public:
+    using MatrixType = Eigen::Matrix<Scalar, 6, 6>;
+    using Functor = internal::adjoint_op<Scalar>;
+    using Base = Eigen::CwiseNullaryOp<Functor, MatrixType>;
+    using Mat3 = typename Functor::Mat3;
+    using Vec3 = typename Functor::Vec3;
+
+    template <typename RotationType, typename TranslationType>
+    EIGEN_STRONG_INLINE AdjointMatrix(const Eigen::MatrixBase<RotationType> &R,
+                                      const Eigen::MatrixBase<TranslationType> &t)
+        : Base{6, 6, Functor{R, t}} {}
+
+    const Mat3 &rotation() const {
+        return this->functor().R;
+    }
+
+    const Vec3 &translation() const {
+        return this->functor().t;
+    }
+
+    // Keep the binary operator- of the base
+    using Base::operator-;
+
+    /** The negative adjoint, with its blocks found */
+    EIGEN_DEVICE_FUNC
+    inline BlockLowerTriangular<Scalar, 3> operator-() const {
+        const Mat3 R = -this->rotation();
+        const Mat3 c = crossMatrix(this->translation()) * R;
+        return BlockLowerTriangular<Scalar, 3>{R, c, R};
+    }
+};
+
+/** Produce the adjoint matrix of a rigid transform with rotation R and translation t */
+template <typename RotationType, typename TranslationType>
+inline auto adjointMatrix(const Eigen::MatrixBase<RotationType> &R,
+                          const Eigen::MatrixBase<TranslationType> &t)
+  -> AdjointMatrix<typename RotationType::Scalar> {
+    return AdjointMatrix<typename RotationType::Scalar>{R, t};
+}
+
+// Forward declaration
+template <typename Scalar, int N>
+class IdentityMatrix;
+
+}  // namespace wave
+
+namespace Eigen {
+
+namespace internal {
+
+template <typename Scalar>
+struct functor_traits<::wave::internal::adjoint_op<Scalar>> {
+    enum {
+        Cost = 3 * NumTraits<Scalar>::MulCost,
+        PacketAccess = false,
+        IsRepeatable = true
+    };
+};
+
+// Static attributes of our Adjoint expression
+// See https://eigen.tuxfamily.org/dox/TopicNewExpressionType.html
+template <typename Scalar>
+struct traits<::wave::AdjointMatrix<Scalar>>
+  : traits<typename ::wave::AdjointMatrix<Scalar>::Base> {};
+
+}  // namespace internal
+
+/** Multiply two adjoint matrices
+ *
+ * The result is the adjoint of the composed transforms: (R1 R2, R1 t2 + t1).
+ */
+template <typename Scalar>
+EIGEN_DEVICE_FUNC inline wave::AdjointMatrix<Scalar> operator*(
+  const wave::AdjointMatrix<Scalar> &lhs, const wave::AdjointMatrix<Scalar> &rhs) {
+    using Mat3 = typename wave::AdjointMatrix<Scalar>::Mat3;
+    using Vec3 = typename wave::AdjointMatrix<Scalar>::Vec3;
+    return wave::AdjointMatrix<Scalar>{
+      Mat3{lhs.rotation() * rhs.rotation()},
+      Vec3{lhs.rotation() * rhs.translation() + lhs.translation()}};
+}
+
+/** Left-multiply a matrix with 6 rows by an adjoint matrix */
+template <typename Scalar,
+          typename OtherType,
+          wave::tmp::enable_if_t<OtherType::RowsAtCompileTime == 6, int> = 0>
+EIGEN_DEVICE_FUNC inline auto operator*(const wave::AdjointMatrix<Scalar> &lhs,
+                                        const Eigen::MatrixBase<OtherType> &rhs)
+  -> Eigen::Matrix<Scalar, 6, OtherType::ColsAtCompileTime> {
+    // Evaluate a lazy rhs once, not once per block
+    const typename internal::eval<OtherType>::type x = rhs.derived().eval();
+    Eigen::Matrix<Scalar, 6, OtherType::ColsAtCompileTime> out{};
+    out.template topRows<3>().noalias() = lhs.rotation() * x.template topRows<3>();
+    out.template bottomRows<3>().noalias() = lhs.rotation() * x.template bottomRows<3>();
+    out.template bottomRows<3>() +=
+      wave::crossMatrix(lhs.translation()) * out.template topRows<3>();
+    return out;
+}
+
+/** Right-multiply a matrix with 6 columns by an adjoint matrix */
+template <typename Scalar,
+          typename OtherType,
+          wave::tmp::enable_if_t<OtherType::ColsAtCompileTime == 6, int> = 0>
+EIGEN_DEVICE_FUNC inline auto operator*(const Eigen::MatrixBase<OtherType> &lhs,
+                                        const wave::AdjointMatrix<Scalar> &rhs)
+  -> Eigen::Matrix<Scalar, OtherType::RowsAtCompileTime, 6> {
+    using Mat3 = typename wave::AdjointMatrix<Scalar>::Mat3;
+    const typename internal::eval<OtherType>::type x = lhs.derived().eval();
+    const Mat3 c = wave::crossMatrix(rhs.translation()) * rhs.rotation();
+    Eigen::Matrix<Scalar, OtherType::RowsAtCompileTime, 6> out{};
+    out.template leftCols<3>().noalias() = x.template leftCols<3>() * rhs.rotation();
+    out.template leftCols<3>().noalias() += x.template rightCols<3>() * c;
+    out.template rightCols<3>().noalias() = x.template rightCols<3>() * rhs.rotation();
+    return out;
+}
+
+/** Multiply an adjoint matrix by a block lower-triangular matrix, giving another */
+template <typename Scalar>
+EIGEN_DEVICE_FUNC inline wave::BlockLowerTriangular<Scalar, 3> operator*(
+  const wave::AdjointMatrix<Scalar> &lhs,
+  const wave::BlockLowerTriangular<Scalar, 3> &rhs) {
+    using Mat3 = typename wave::AdjointMatrix<Scalar>::Mat3;
+    const Mat3 a = lhs.rotation() * rhs.a();
+    return wave::BlockLowerTriangular<Scalar, 3>{
+      a,
+      Mat3{wave::crossMatrix(lhs.translation()) * a + lhs.rotation() * rhs.c()},
+      Mat3{lhs.rotation() * rhs.d()}};
+}
+
+/** Multiply a block lower-triangular matrix by an adjoint matrix, giving another */
+template <typename Scalar>
+EIGEN_DEVICE_FUNC inline wave::BlockLowerTriangular<Scalar, 3> operator*(
+  const wave::BlockLowerTriangular<Scalar, 3> &lhs,
+  const wave::AdjointMatrix<Scalar> &rhs) {
+    using Mat3 = typename wave::AdjointMatrix<Scalar>::Mat3;
+    const Mat3 c = lhs.c() + lhs.d() * wave::crossMatrix(rhs.translation());
+    return wave::BlockLowerTriangular<Scalar, 3>{Mat3{lhs.a() * rhs.rotation()},
+                                                 Mat3{c * rhs.rotation()},
+                                                 Mat3{lhs.d() * rhs.rotation()}};
+}
+
+/** Multiply an adjoint matrix by a repeated block-diagonal matrix, giving a block
+ * lower-triangular matrix
+ *
+ * The block need not be a rotation, so the result is not in general an adjoint.
+ */
+template <typename Scalar>
+EIGEN_DEVICE_FUNC inline wave::BlockLowerTriangular<Scalar, 3> operator*(
+  const wave::AdjointMatrix<Scalar> &lhs, const wave::BlockDiagonal<Scalar, 3> &rhs) {
+    using Mat3 = typename wave::AdjointMatrix<Scalar>::Mat3;
+    const Mat3 a = lhs.rotation() * rhs.a();
+    const Mat3 c = wave::crossMatrix(lhs.translation()) * a;
+    return wave::BlockLowerTriangular<Scalar, 3>{a, c, a};
+}
+
+/** Multiply a repeated block-diagonal matrix by an adjoint matrix, giving a block
+ * lower-triangular matrix
+ *
+ * The block need not be a rotation, so the result is not in general an adjoint.
+ */
+template <typename Scalar>
+EIGEN_DEVICE_FUNC inline wave::BlockLowerTriangular<Scalar, 3> operator*(
+  const wave::BlockDiagonal<Scalar, 3> &lhs, const wave::AdjointMatrix<Scalar> &rhs) {
+    using Mat3 = typename wave::AdjointMatrix<Scalar>::Mat3;
+    const Mat3 a = lhs.a() * rhs.rotation();
+    const Mat3 c = lhs.a() * wave::crossMatrix(rhs.translation()) * rhs.rotation();
+    return wave::BlockLowerTriangular<Scalar, 3>{a, c, a};
+}
+
+/**
+ * Multiply an Identity expression by an adjoint matrix
+ * (Provided to break tie between the other specializations)
+ */
+template <typename Scalar>
+EIGEN_DEVICE_FUNC inline const wave::AdjointMatrix<Scalar> &operator*(
+  const wave::IdentityMatrix<Scalar, 6> &, const wave::AdjointMatrix<Scalar> &adj) {
+    return adj;
+}
+
+/**
+ * Multiply an adjoint matrix by an Identity expression
+ * (Provided to break tie between the other specializations)
+ */
+template <typename Scalar>
+EIGEN_DEVICE_FUNC inline const wave::AdjointMatrix<Scalar> &operator*(
+  const wave::AdjointMatrix<Scalar> &adj, const wave::IdentityMatrix<Scalar, 6> &) {
+    return adj;
+}
+
+/**
+ * Multiply an adjoint matrix by a Zero expression
+ * (Provided to break tie between the other specializations)
+ */
+template <typename Scalar, int Cols>
+EIGEN_DEVICE_FUNC inline auto operator*(const wave::AdjointMatrix<Scalar> &,
+                                        const wave::ZeroMatrix<Scalar, 6, Cols> &)
+  -> wave::ZeroMatrix<Scalar, 6, Cols> {
+    return {};
+}
+
+/**
+ * Multiply a Zero expression by an adjoint matrix
+ * (Provided to break tie between the other specializations)
+ */
+template <typename Scalar, int Rows>
+EIGEN_DEVICE_FUNC inline auto operator*(const wave::ZeroMatrix<Scalar, Rows, 6> &,
+                                        const wave::AdjointMatrix<Scalar> &)
+  -> wave::ZeroMatrix<Scalar, Rows, 6> {
+    return {};
+}
+
+}  // namespace Eigen
+
+#endif  // WAVE_GEOMETRY_ADJOINTMATRIX_HPP
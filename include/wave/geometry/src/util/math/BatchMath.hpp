@@ -0,0 +1,284 @@
+/**
+ * @file
+ *
+ * Branch-free, lane-wise math functions on Eigen arrays.
+ *
+ * Eigen's own sin, cos and acos are not vectorized for double, and its select() and
+ * comparison operators fall back to scalar code. The functions here are written only
+ * in terms of operations Eigen vectorizes (arithmetic, sqrt, packet compares and
+ * blends), so a whole column of inputs is processed at the packet width enabled at
+ * compile time.
+ */
+
+#ifndef WAVE_GEOMETRY_BATCHMATH_HPP
+#define WAVE_GEOMETRY_BATCHMATH_HPP
+
+#include <Eigen/Core>
+
+namespace wave {
+namespace internal {
+
+/** Functor giving 1 where lhs >= rhs and 0 elsewhere */
+template <typename Scalar>
+struct scalar_step_op {
+    EIGEN_STRONG_INLINE Scalar operator()(const Scalar &a, const Scalar &b) const {
+        return a >= b ? Scalar{1} : Scalar{0};
+    }
+
+    template <typename Packet>
+    EIGEN_STRONG_INLINE Packet packetOp(const Packet &a, const Packet &b) const {
+        return Eigen::internal::pand(Eigen::internal::pcmp_le(b, a),
+                                     Eigen::internal::pset1<Packet>(Scalar{1}));
+    }
+};
+
+/** Functor giving the second argument where the first is nonzero, else the third */
+template <typename Scalar>
+struct scalar_blend_op {
+    EIGEN_STRONG_INLINE Scalar operator()(const Scalar &mask,
+                                          const Scalar &a,
+                                          const Scalar &b) const {
+        return mask != Scalar{0} ? a : b;
+    }
+
+    template <typename Packet>
+    EIGEN_STRONG_INLINE Packet packetOp(const Packet &mask,
+                                        const Packet &a,
+                                        const Packet &b) const {
+        const auto is_zero = Eigen::internal::pcmp_eq(mask, Eigen::internal::pzero(mask));
+        return Eigen::internal::pselect(is_zero, b, a);
+    }
+};
+
+}  // namespace internal
+}  // namespace wave
+
+namespace Eigen {
+namespace internal {
+
+template <typename Scalar>
+struct functor_traits<wave::internal::scalar_step_op<Scalar>> {
+    enum {
+        Cost = NumTraits<Scalar>::AddCost,
+        PacketAccess = packet_traits<Scalar>::HasCmp
+    };
+};
+
+template <typename Scalar>
+struct functor_traits<wave::internal::scalar_blend_op<Scalar>> {
+    enum {
+        Cost = NumTraits<Scalar>::AddCost,
+        PacketAccess = packet_traits<Scalar>::HasCmp && packet_traits<Scalar>::HasBlend
+    };
+};
+
+}  // namespace internal
+}  // namespace Eigen
+
+namespace wave {
+
+/** Lane-wise mask: 1 where a >= b, and 0 elsewhere */
+template <typename A, typename B>
+auto batchStep(const Eigen::ArrayBase<A> &a, const Eigen::ArrayBase<B> &b)
+  -> decltype(a.binaryExpr(b, internal::scalar_step_op<typename A::Scalar>{})) {
+    return a.binaryExpr(b, internal::scalar_step_op<typename A::Scalar>{});
+}
+
+/** Lane-wise select: a where mask is nonzero, and b elsewhere.
+ *
+ * Unlike arithmetic blending, a non-finite value in the lane not selected does not leak
+ * into the result.
+ */
+template <typename M, typename A, typename B>
+auto batchSelect(const Eigen::ArrayBase<M> &mask,
+                 const Eigen::ArrayBase<A> &a,
+                 const Eigen::ArrayBase<B> &b)
+  -> Eigen::CwiseTernaryOp<internal::scalar_blend_op<typename A::Scalar>,
+                           const M,
+                           const A,
+                           const B> {
+    return Eigen::CwiseTernaryOp<internal::scalar_blend_op<typename A::Scalar>,
+                                 const M,
+                                 const A,
+                                 const B>{mask.derived(), a.derived(), b.derived()};
+}
+
+/** Lane-wise floor, for |x| below 2^51 (2^22 for float)
+ *
+ * Adding and subtracting 1.5 / eps rounds each lane to the nearest integer, and lanes
+ * rounded up are then moved down by one. Unlike Eigen's floor(), this needs no AVX-512
+ * rounding intrinsic, for which GCC 12 gives spurious -Wmaybe-uninitialized warnings.
+ */
+template <typename Derived>
+auto batchFloor(const Eigen::ArrayBase<Derived> &x) -> typename Derived::PlainObject {
+    using Scalar = typename Derived::Scalar;
+    using Array = typename Derived::PlainObject;
+    const Scalar shift = Scalar{1.5} / Eigen::NumTraits<Scalar>::epsilon();
+
+    const Array x_eval = x;
+    const Array rounded = (x_eval + shift) - shift;
+    return rounded - (Scalar{1} - batchStep(x_eval, rounded));
+}
+
+// With AVX-512 and EIGEN_FAST_MATH, Eigen's sqrt starts from _mm512_rsqrt14_pd, whose
+// undefined pass-through operand GCC 12 reports as -Wmaybe-uninitialized wherever it is
+// inlined. The warning is spurious; disable it just for this wrapper.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+/** Lane-wise square root */
+template <typename Derived>
+auto batchSqrt(const Eigen::ArrayBase<Derived> &x) -> typename Derived::PlainObject {
+    return x.sqrt();
+}
+
+#pragma GCC diagnostic pop
+
+/** Lane-wise sine and cosine
+ *
+ * The argument is reduced to [-pi/4, pi/4] by subtracting a multiple of pi/2 in three
+ * parts (Cody-Waite), and the minimax polynomials from the Cephes library are applied.
+ * The result is accurate to about one ulp for |x| up to 1e8.
+ */
+template <typename Derived>
+void batchSinCos(const Eigen::ArrayBase<Derived> &x,
+                 typename Derived::PlainObject &sin_x,
+                 typename Derived::PlainObject &cos_x) {
+    using Scalar = typename Derived::Scalar;
+    using Array = typename Derived::PlainObject;
+
+    constexpr Scalar two_over_pi{0.63661977236758134308};
+    // pi/2 in three parts; the first two have trailing zero bits, so n times each is
+    // exact (Cody-Waite)
+    constexpr Scalar dp1{1.57079625129699707031e+00};
+    constexpr Scalar dp2{7.54978941586159635336e-08};
+    constexpr Scalar dp3{5.39030285815811905290e-15};
+
+    // x = r + n * pi/2
+    const Array n = batchFloor(x * two_over_pi + Scalar{0.5});
+    const Array r = ((x - n * dp1) - n * dp2) - n * dp3;
+    const Array z = r * r;
+
+    const Array sin_r =
+      r + r * z * (((((Scalar{1.58962301576546568060e-10} * z -
+                       Scalar{2.50507477628578072866e-08}) *
+                        z +
+                      Scalar{2.75573136213857245213e-06}) *
+                       z -
+                     Scalar{1.98412698295895385996e-04}) *
+                      z +
+                    Scalar{8.33333333332211858878e-03}) *
+                     z -
+                   Scalar{1.66666666666666307295e-01});
+    const Array cos_r =
+      Scalar{1} - Scalar{0.5} * z +
+      z * z * (((((Scalar{-1.13585365213876817300e-11} * z +
+                   Scalar{2.08757008419747316778e-09}) *
+                    z -
+                  Scalar{2.75573141792967388112e-07}) *
+                   z +
+                 Scalar{2.48015872888517045348e-05}) *
+                  z -
+                Scalar{1.38888888888730564116e-03}) *
+                 z +
+               Scalar{4.16666666666665929218e-02});
+
+    // The quadrant q = n mod 4 decides which polynomial gives each result, and its sign
+    const Array n_div_4 = batchFloor(n * Scalar{0.25});
+    const Array q = n - Scalar{4} * n_div_4;
+    const Array q_div_2 = batchFloor(q * Scalar{0.5});
+    const Array q_plus_1 = q + Scalar{1};
+    const Array q_plus_1_div_4 = batchFloor(q_plus_1 * Scalar{0.25});
+    const Array q_cos = q_plus_1 - Scalar{4} * q_plus_1_div_4;
+    const Array q_cos_div_2 = batchFloor(q_cos * Scalar{0.5});
+
+    const Array odd = q - Scalar{2} * q_div_2;
+    const Array sin_abs = batchSelect(odd, cos_r, sin_r);
+    const Array cos_abs = batchSelect(odd, sin_r, cos_r);
+    sin_x = (Scalar{1} - Scalar{2} * q_div_2) * sin_abs;
+    cos_x = (Scalar{1} - Scalar{2} * q_cos_div_2) * cos_abs;
+}
+
+/** Lane-wise arc tangent
+ *
+ * Uses the range reduction and rational approximation of the Cephes library, with both
+ * reductions computed for every lane and blended.
+ */
+template <typename Derived>
+auto batchAtan(const Eigen::ArrayBase<Derived> &x) -> typename Derived::PlainObject {
+    using Scalar = typename Derived::Scalar;
+    using Array = typename Derived::PlainObject;
+    constexpr Scalar tan3pio8{2.41421356237309504880};
+    constexpr Scalar morebits{6.123233995736765886130e-17};
+    constexpr Scalar pio2{1.57079632679489661923};
+    constexpr Scalar pio4{0.78539816339744830962};
+
+    const Array ax = x.abs();
+    const Array big = batchStep(ax, Array::Constant(ax.rows(), ax.cols(), tan3pio8));
+    const Array mid =
+      (Scalar{1} - big) * batchStep(ax, Array::Constant(ax.rows(), ax.cols(), 0.66));
+
+    // atan(ax) = offset + atan(xr)
+    const Array offset = big * pio2 + mid * pio4;
+    const Array xr = batchSelect(
+      big, -Scalar{1} / ax, batchSelect(mid, (ax - Scalar{1}) / (ax + Scalar{1}), ax));
+    const Array z = xr * xr;
+
+    const Array p = (((Scalar{-8.750608600031904122785e-01} * z -
+                       Scalar{1.615753718733365076637e+01}) *
+                        z -
+                      Scalar{7.500855792314704667340e+01}) *
+                       z -
+                     Scalar{1.228866684490136173410e+02}) *
+                      z -
+                    Scalar{6.485021904942025371773e+01};
+    const Array q = ((((z + Scalar{2.485846490142306297962e+01}) * z +
+                       Scalar{1.650270098316988542046e+02}) *
+                        z +
+                      Scalar{4.328810604912902668951e+02}) *
+                       z +
+                     Scalar{4.853903996359136964868e+02}) *
+                      z +
+                    Scalar{1.945506571482613964425e+02};
+
+    const Array res = offset + (xr + xr * z * p / q) + big * morebits +
+                      mid * (Scalar{0.5} * morebits);
+    return batchSelect(batchStep(x, Array::Zero(x.rows(), x.cols())), res, -res);
+}
+
+/** Lane-wise arc tangent of y/x, using the signs of both to find the quadrant
+ *
+ * The result is in [-pi, pi]. As for batchAtan(), no branches are taken. The result is
+ * NaN where both inputs are zero.
+ */
+template <typename DerivedY, typename DerivedX>
+auto batchAtan2(const Eigen::ArrayBase<DerivedY> &y, const Eigen::ArrayBase<DerivedX> &x)
+  -> typename DerivedY::PlainObject {
+    using Scalar = typename DerivedY::Scalar;
+    using Array = typename DerivedY::PlainObject;
+    constexpr Scalar pi{3.14159265358979323846};
+    const Array zero = Array::Zero(y.rows(), y.cols());
+
+    const Array a = batchAtan(y / x);
+    // For x < 0, move the result by pi towards the sign of y
+    const Array x_neg = Scalar{1} - batchStep(x, zero);
+    const Array shift = batchSelect(batchStep(y, zero),
+                                    Array::Constant(y.rows(), y.cols(), pi),
+                                    Array::Constant(y.rows(), y.cols(), -pi));
+    return a + x_neg * shift;
+}
+
+/** Lane-wise arc cosine, computed as atan2(sqrt(1 - x^2), x)
+ *
+ * This form keeps full relative accuracy for small results, where acos itself is
+ * ill-conditioned.
+ */
+template <typename Derived>
+auto batchAcos(const Eigen::ArrayBase<Derived> &x) -> typename Derived::PlainObject {
+    using Scalar = typename Derived::Scalar;
+    return batchAtan2(batchSqrt((Scalar{1} - x) * (Scalar{1} + x)), x);
+}
+
+}  // namespace wave
+
+#endif  // WAVE_GEOMETRY_BATCHMATH_HPP
@@ -0,0 +1,320 @@
+/**
+ * @file
+ * Defines structured (2N x 2N) matrices made of (N x N) blocks, such as the jacobians of
+ * SE(3) operations, which are multiplied block by block.
+ */
+
+#ifndef WAVE_GEOMETRY_BLOCKMATRIX_HPP
+#define WAVE_GEOMETRY_BLOCKMATRIX_HPP
+
+#include <Eigen/Geometry>
+#include "wave/geometry/src/util/meta/template_helpers.hpp"
+#include "wave/geometry/src/util/math/ZeroMatrix.hpp"
+
+namespace wave {
+
+/**
+ * A (2N x 2N) matrix with a zero upper-right (N x N) block,
+ *
+ * @f[ \begin{bmatrix} A & 0 \\ C & D \end{bmatrix} @f]
+ *
+ * This is the form of the adjoint of SE(3), and of the jacobians of Compose, Inverse,
+ * ExpMap and LogMap of rigid transforms. Like CrossMatrix, it is a plain matrix whose
+ * type records its structure: products with it are found from (N x N) blocks, skipping
+ * the zero block. Other operations see an ordinary matrix.
+ */
+template <typename Scalar, int N>
+class BlockLowerTriangular : public Eigen::Matrix<Scalar, 2 * N, 2 * N> {
+ public:
+    using MatrixType = Eigen::Matrix<Scalar, 2 * N, 2 * N>;
+    using BlockType = Eigen::Matrix<Scalar, N, N>;
+
+    BlockLowerTriangular() = default;
+
+    template <typename A, typename C, typename D>
+    EIGEN_STRONG_INLINE BlockLowerTriangular(const Eigen::MatrixBase<A> &a,
+                                             const Eigen::MatrixBase<C> &c,
+                                             const Eigen::MatrixBase<D> &d) {
+        this->template topLeftCorner<N, N>() = a;
+        this->template topRightCorner<N, N>().setZero();
+        this->template bottomLeftCorner<N, N>() = c;
+        this->template bottomRightCorner<N, N>() = d;
+    }
+
+    auto a() const -> decltype(std::declval<const MatrixType &>()
+                                 .template topLeftCorner<N, N>()) {
+        return this->template topLeftCorner<N, N>();
+    }
+
+    auto c() const -> decltype(std::declval<const MatrixType &>()
+                                 .template bottomLeftCorner<N, N>()) {
+        return this->template bottomLeftCorner<N, N>();
+    }
+
+    auto d() const -> decltype(std::declval<const MatrixType &>()
+                                 .template bottomRightCorner<N, N>()) {
+        return this->template bottomRightCorner<N, N>();
+    }
+
+    // Keep the binary operator- of the base
+    using MatrixType::operator-;
+
+    EIGEN_DEVICE_FUNC
+    inline BlockLowerTriangular operator-() const {
+        return BlockLowerTriangular{-this->a(), -this->c(), -this->d()};
+    }
+};
+
+/**
+ * A (2N x 2N) block-diagonal matrix whose diagonal blocks are the same,
+ *
+ * @f[ \begin{bmatrix} A & 0 \\ 0 & A \end{bmatrix} @f]
+ *
+ * This is the adjoint of a rigid transform with no translation, such as a pure rotation.
+ * Products with it take one (N x N) block product per block of the other matrix.
+ */
+template <typename Scalar, int N>
+class BlockDiagonal : public Eigen::Matrix<Scalar, 2 * N, 2 * N> {
+ public:
+    using MatrixType = Eigen::Matrix<Scalar, 2 * N, 2 * N>;
+    using BlockType = Eigen::Matrix<Scalar, N, N>;
+
+    BlockDiagonal() = default;
+
+    template <typename A>
+    EIGEN_STRONG_INLINE explicit BlockDiagonal(const Eigen::MatrixBase<A> &a) {
+        this->template topLeftCorner<N, N>() = a;
+        this->template topRightCorner<N, N>().setZero();
+        this->template bottomLeftCorner<N, N>().setZero();
+        this->template bottomRightCorner<N, N>() = this->template topLeftCorner<N, N>();
+    }
+
+    auto a() const -> decltype(std::declval<const MatrixType &>()
+                                 .template topLeftCorner<N, N>()) {
+        return this->template topLeftCorner<N, N>();
+    }
+
+    // Keep the binary operator- of the base
+    using MatrixType::operator-;
+
+    EIGEN_DEVICE_FUNC
+    inline BlockDiagonal operator-() const {
+        return BlockDiagonal{-this->a()};
+    }
+};
+
+// Forward declaration
+template <typename Scalar, int N>
+class IdentityMatrix;
+
+}  // namespace wave
+
+namespace Eigen {
+
+namespace internal {
+
+// Static attributes of our block matrices, which are those of the plain matrix they
+// derive from
+template <typename Scalar, int N>
+struct traits<::wave::BlockLowerTriangular<Scalar, N>>
+  : traits<Eigen::Matrix<Scalar, 2 * N, 2 * N>> {};
+
+template <typename Scalar, int N>
+struct traits<::wave::BlockDiagonal<Scalar, N>>
+  : traits<Eigen::Matrix<Scalar, 2 * N, 2 * N>> {};
+
+}  // namespace internal
+
+/** Multiply two block lower-triangular matrices, giving another */
+template <typename Scalar, int N>
+EIGEN_DEVICE_FUNC inline wave::BlockLowerTriangular<Scalar, N> operator*(
+  const wave::BlockLowerTriangular<Scalar, N> &lhs,
+  const wave::BlockLowerTriangular<Scalar, N> &rhs) {
+    using Block = typename wave::BlockLowerTriangular<Scalar, N>::BlockType;
+    return wave::BlockLowerTriangular<Scalar, N>{Block{lhs.a() * rhs.a()},
+                                                 lhs.c() * rhs.a() + lhs.d() * rhs.c(),
+                                                 Block{lhs.d() * rhs.d()}};
+}
+
+/** Left-multiply a matrix with 2N rows by a block lower-triangular matrix */
+template <typename Scalar,
+          int N,
+          typename OtherType,
+          wave::tmp::enable_if_t<OtherType::RowsAtCompileTime == 2 * N, int> = 0>
+EIGEN_DEVICE_FUNC inline auto operator*(const wave::BlockLowerTriangular<Scalar, N> &lhs,
+                                        const Eigen::MatrixBase<OtherType> &rhs)
+  -> Eigen::Matrix<Scalar, 2 * N, OtherType::ColsAtCompileTime> {
+    // Evaluate a lazy rhs once, not once per block
+    const typename internal::eval<OtherType>::type x = rhs.derived().eval();
+    const auto &top = x.template topRows<N>();
+    Eigen::Matrix<Scalar, 2 * N, OtherType::ColsAtCompileTime> out{};
+    out.template topRows<N>().noalias() = lhs.a() * top;
+    out.template bottomRows<N>().noalias() = lhs.c() * top;
+    out.template bottomRows<N>().noalias() += lhs.d() * x.template bottomRows<N>();
+    return out;
+}
+
+/** Right-multiply a matrix with 2N columns by a block lower-triangular matrix */
+template <typename Scalar,
+          int N,
+          typename OtherType,
+          wave::tmp::enable_if_t<OtherType::ColsAtCompileTime == 2 * N, int> = 0>
+EIGEN_DEVICE_FUNC inline auto operator*(const Eigen::MatrixBase<OtherType> &lhs,
+                                        const wave::BlockLowerTriangular<Scalar, N> &rhs)
+  -> Eigen::Matrix<Scalar, OtherType::RowsAtCompileTime, 2 * N> {
+    const typename internal::eval<OtherType>::type x = lhs.derived().eval();
+    const auto &right = x.template rightCols<N>();
+    Eigen::Matrix<Scalar, OtherType::RowsAtCompileTime, 2 * N> out{};
+    out.template leftCols<N>().noalias() = x.template leftCols<N>() * rhs.a();
+    out.template leftCols<N>().noalias() += right * rhs.c();
+    out.template rightCols<N>().noalias() = right * rhs.d();
+    return out;
+}
+
+/** Multiply two repeated block-diagonal matrices, giving another */
+template <typename Scalar, int N>
+EIGEN_DEVICE_FUNC inline wave::BlockDiagonal<Scalar, N> operator*(
+  const wave::BlockDiagonal<Scalar, N> &lhs, const wave::BlockDiagonal<Scalar, N> &rhs) {
+    using Block = typename wave::BlockDiagonal<Scalar, N>::BlockType;
+    return wave::BlockDiagonal<Scalar, N>{Block{lhs.a() * rhs.a()}};
+}
+
+/** Left-multiply a matrix with 2N rows by a repeated block-diagonal matrix */
+template <typename Scalar,
+          int N,
+          typename OtherType,
+          wave::tmp::enable_if_t<OtherType::RowsAtCompileTime == 2 * N, int> = 0>
+EIGEN_DEVICE_FUNC inline auto operator*(const wave::BlockDiagonal<Scalar, N> &lhs,
+                                        const Eigen::MatrixBase<OtherType> &rhs)
+  -> Eigen::Matrix<Scalar, 2 * N, OtherType::ColsAtCompileTime> {
+    const typename internal::eval<OtherType>::type x = rhs.derived().eval();
+    Eigen::Matrix<Scalar, 2 * N, OtherType::ColsAtCompileTime> out{};
+    out.template topRows<N>().noalias() = lhs.a() * x.template topRows<N>();
+    out.template bottomRows<N>().noalias() = lhs.a() * x.template bottomRows<N>();
+    return out;
+}
+
+/** Right-multiply a matrix with 2N columns by a repeated block-diagonal matrix */
+template <typename Scalar,
+          int N,
+          typename OtherType,
+          wave::tmp::enable_if_t<OtherType::ColsAtCompileTime == 2 * N, int> = 0>
+EIGEN_DEVICE_FUNC inline auto operator*(const Eigen::MatrixBase<OtherType> &lhs,
+                                        const wave::BlockDiagonal<Scalar, N> &rhs)
+  -> Eigen::Matrix<Scalar, OtherType::RowsAtCompileTime, 2 * N> {
+    const typename internal::eval<OtherType>::type x = lhs.derived().eval();
+    Eigen::Matrix<Scalar, OtherType::RowsAtCompileTime, 2 * N> out{};
+    out.template leftCols<N>().noalias() = x.template leftCols<N>() * rhs.a();
+    out.template rightCols<N>().noalias() = x.template rightCols<N>() * rhs.a();
+    return out;
+}
+
+/** Multiply a repeated block-diagonal matrix by a block lower-triangular matrix */
+template <typename Scalar, int N>
+EIGEN_DEVICE_FUNC inline wave::BlockLowerTriangular<Scalar, N> operator*(
+  const wave::BlockDiagonal<Scalar, N> &lhs,
+  const wave::BlockLowerTriangular<Scalar, N> &rhs) {
+    using Block = typename wave::BlockLowerTriangular<Scalar, N>::BlockType;
+    return wave::BlockLowerTriangular<Scalar, N>{
+      Block{lhs.a() * rhs.a()}, Block{lhs.a() * rhs.c()}, Block{lhs.a() * rhs.d()}};
+}
+
+/** Multiply a block lower-triangular matrix by a repeated block-diagonal matrix */
+template <typename Scalar, int N>
+EIGEN_DEVICE_FUNC inline wave::BlockLowerTriangular<Scalar, N> operator*(
+  const wave::BlockLowerTriangular<Scalar, N> &lhs,
+  const wave::BlockDiagonal<Scalar, N> &rhs) {
+    using Block = typename wave::BlockLowerTriangular<Scalar, N>::BlockType;
+    return wave::BlockLowerTriangular<Scalar, N>{
+      Block{lhs.a() * rhs.a()}, Block{lhs.c() * rhs.a()}, Block{lhs.d() * rhs.a()}};
+}
+
+/**
+ * Multiply an Identity expression by a block lower-triangular matrix
+ * (Provided to break tie between the other specializations)
+ */
+template <typename Scalar, int N>
+EIGEN_DEVICE_FUNC inline const wave::BlockLowerTriangular<Scalar, N> &operator*(
+  const wave::IdentityMatrix<Scalar, 2 * N> &,
+  const wave::BlockLowerTriangular<Scalar, N> &m) {
+    return m;
+}
+
+/**
+ * Multiply a block lower-triangular matrix by an Identity expression
+ * (Provided to break tie between the other specializations)
+ */
+template <typename Scalar, int N>
+EIGEN_DEVICE_FUNC inline const wave::BlockLowerTriangular<Scalar, N> &operator*(
+  const wave::BlockLowerTriangular<Scalar, N> &m,
+  const wave::IdentityMatrix<Scalar, 2 * N> &) {
+    return m;
+}
+
+/**
+ * Multiply an Identity expression by a repeated block-diagonal matrix
+ * (Provided to break tie between the other specializations)
+ */
+template <typename Scalar, int N>
+EIGEN_DEVICE_FUNC inline const wave::BlockDiagonal<Scalar, N> &operator*(
+  const wave::IdentityMatrix<Scalar, 2 * N> &, const wave::BlockDiagonal<Scalar, N> &m) {
+    return m;
+}
+
+/**
+ * Multiply a repeated block-diagonal matrix by an Identity expression
+ * (Provided to break tie between the other specializations)
+ */
+template <typename Scalar, int N>
+EIGEN_DEVICE_FUNC inline const wave::BlockDiagonal<Scalar, N> &operator*(
+  const wave::BlockDiagonal<Scalar, N> &m, const wave::IdentityMatrix<Scalar, 2 * N> &) {
+    return m;
+}
+
+/**
+ * Multiply a Zero expression by a block lower-triangular matrix
+ * (Provided to break tie between the other specializations)
+ */
+template <typename Scalar, int Rows, int N>
+EIGEN_DEVICE_FUNC inline auto operator*(const wave::ZeroMatrix<Scalar, Rows, 2 * N> &,
+                                        const wave::BlockLowerTriangular<Scalar, N> &)
+  -> wave::ZeroMatrix<Scalar, Rows, 2 * N> {
+    return {};
+}
+
+/**
+ * Multiply a block lower-triangular matrix by a Zero expression
+ * (Provided to break tie between the other specializations)
+ */
+template <typename Scalar, int N, int Cols>
+EIGEN_DEVICE_FUNC inline auto operator*(const wave::BlockLowerTriangular<Scalar, N> &,
+                                        const wave::ZeroMatrix<Scalar, 2 * N, Cols> &)
+  -> wave::ZeroMatrix<Scalar, 2 * N, Cols> {
+    return {};
+}
+
+/**
+ * Multiply a Zero expression by a repeated block-diagonal matrix
+ * (Provided to break tie between the other specializations)
+ */
+template <typename Scalar, int Rows, int N>
+EIGEN_DEVICE_FUNC inline auto operator*(const wave::ZeroMatrix<Scalar, Rows, 2 * N> &,
+                                        const wave::BlockDiagonal<Scalar, N> &)
+  -> wave::ZeroMatrix<Scalar, Rows, 2 * N> {
+    return {};
+}
+
+/**
+ * Multiply a repeated block-diagonal matrix by a Zero expression
+ * (Provided to break tie between the other specializations)
+ */
+template <typename Scalar, int N, int Cols>
+EIGEN_DEVICE_FUNC inline auto operator*(const wave::BlockDiagonal<Scalar, N> &,
+                                        const wave::ZeroMatrix<Scalar, 2 * N, Cols> &)
+  -> wave::ZeroMatrix<Scalar, 2 * N, Cols> {
+    return {};
+}
+
+}  // namespace Eigen
+
+#endif  // WAVE_GEOMETRY_BLOCKMATRIX_HPP
@@ -11,6 +11,31 @@
 #include "wave/geometry/src/util/meta/template_helpers.hpp"
 
 namespace wave {
+namespace internal {
+
+/** Functor giving the coefficients of a cross matrix from its vector */
+template <typename Scalar>
+struct cross_matrix_op {
+    using Vec3 = Eigen::Matrix<Scalar, 3, 1>;
+
+    EIGEN_STRONG_INLINE Scalar operator()(Eigen::Index i, Eigen::Index j) const {
+        if (i == j) {
+            return Scalar{0};
+        }
+        // The coefficient is +/- the vector element whose index is neither i nor j
+        const auto k = 3 - i - j;
+        return (j - i + 3) % 3 == 1 ? Scalar{-this->v(k)} : this->v(k);
+    }
+
+    Vec3 v;
+};
+
+/** Enables operators for a scalar T which multiplies a cross matrix of VecType */
+template <typename VecType, typename T>
+using enable_if_cross_scalar_t =
+  tmp::enable_if_t<std::is_convertible<T, typename VecType::Scalar>{}, int>;
+
+}  // namespace internal
 
 /**
  * An Eigen expression for the skew-symmetric "cross-product" or "hat" matrix of a
@@ -21,41 +46,51 @@ namespace wave {
  * In different works, `CrossMatrix(a)` might be written as @f$ a^{\times} @f$ or
  * @f$ \hat{a} @f$ .
  *
+ * The expression is lazy: its products with vectors, matrices and other cross matrices
+ * are cross products or closed forms, and a scalar multiple is the cross matrix of a
+ * scaled vector. Its coefficients are found only if it is used as a plain matrix.
+ *
  * @tparam VecType the type of the vector expression
  */
 // The implementation of an Eigen expression here was guided by
 // https://eigen.tuxfamily.org/dox/TopicNewExpressionType.html
 template <class VecType>
-class CrossMatrix : public Eigen::Matrix<typename VecType::Scalar, 3, 3> {
+class CrossMatrix
+    : public Eigen::CwiseNullaryOp<internal::cross_matrix_op<typename VecType::Scalar>,
+                                   Eigen::Matrix<typename VecType::Scalar, 3, 3>> {
  public:
     EIGEN_STATIC_ASSERT_VECTOR_SPECIFIC_SIZE(VecType, 3);
-    using MatrixType = Eigen::Matrix<typename VecType::Scalar, 3, 3>;
-    using Nested = typename Eigen::internal::ref_selector<CrossMatrix>::type;
-    using VecTypeNested = typename Eigen::internal::ref_selector<VecType>::type;
-
     using Scalar = typename VecType::Scalar;
+    using MatrixType = Eigen::Matrix<Scalar, 3, 3>;
+    using Functor = internal::cross_matrix_op<Scalar>;
+    using Base = Eigen::CwiseNullaryOp<Functor, MatrixType>;
+    using VecTypeNested = typename Eigen::internal::ref_selector<VecType>::type;
 
     EIGEN_STRONG_INLINE
-    explicit CrossMatrix(const VecType &vec)
-        : MatrixType{(MatrixType{} << Scalar{0},
-                      -vec(2),
-                      vec(1),
-                      vec(2),
-                      Scalar{0},
-                      -vec(0),
-                      -vec(1),
-                      vec(0),
-                      Scalar{0})
-                       .finished()},
-          vec{vec} {}
+    explicit CrossMatrix(const VecType &vec) : Base{3, 3, Functor{vec}}, vec{vec} {}
 
     using NegativeReturnType = CrossMatrix<typename VecType::NegativeReturnType>;
 
+    /** The type of the cross matrix of the vector times a scalar */
+    using ScaledReturnType = CrossMatrix<
+      tmp::remove_cr_t<decltype(std::declval<VecTypeNested>() * std::declval<Scalar>())>>;
+
+    /** The type of the cross matrix of the vector divided by a scalar */
+    using QuotientReturnType = CrossMatrix<
+      tmp::remove_cr_t<decltype(std::declval<VecTypeNested>() / std::declval<Scalar>())>>;
+
+    // Keep the binary operator- of the base
+    using Base::operator-;
+
     EIGEN_DEVICE_FUNC
     inline NegativeReturnType operator-() const {
         return NegativeReturnType{-this->vec};
     }
 
+    /** The vector, evaluated */
+    const typename Functor::Vec3 &vector() const {
+        return this->functor().v;
+    }
 
     VecTypeNested vec;
 };
@@ -74,9 +109,11 @@ inline auto crossMatrix(const Eigen::MatrixBase<VecType> &&vec) -> CrossMatrix<V
     return CrossMatrix<VecType>(std::move(vec.derived()));
 }
 
-// Forward declaration
+// Forward declarations
 template <typename Scalar, int N>
 class IdentityMatrix;
+template <typename Scalar, int Rows, int Cols>
+class ZeroMatrix;
 
 }  // namespace wave
 
@@ -165,7 +202,9 @@ EIGEN_DEVICE_FUNC inline auto operator*(
  */
 template <typename OtherType,
           typename VecType,
-          wave::tmp::enable_if_t<OtherType::ColsAtCompileTime == 3, int> = 0>
+          wave::tmp::enable_if_t<OtherType::ColsAtCompileTime == 3 &&
+                                   OtherType::RowsAtCompileTime != 1,
+                                 int> = 0>
 EIGEN_DEVICE_FUNC inline auto operator*(const Eigen::MatrixBase<OtherType> &lhs,
                                         const wave::CrossMatrix<VecType> &crossMat)
   -> decltype(lhs.rowwise().cross(crossMat.vec)) {
@@ -174,13 +213,63 @@ EIGEN_DEVICE_FUNC inline auto operator*(const Eigen::MatrixBase<OtherType> &lhs,
 
 /**
  * Multiply two cross-matrices
- * (needed to disambiguate)
+ *
+ * Uses the closed form @f$ a^{\times} b^{\times} = b a^T - (a \cdot b) I @f$.
  */
 template <typename Lhs, typename Rhs>
 EIGEN_DEVICE_FUNC inline auto operator*(const wave::CrossMatrix<Lhs> &lhs,
                                         const wave::CrossMatrix<Rhs> &rhs)
-  -> decltype(lhs.rowwise().cross(rhs.vec)) {
-    return lhs.rowwise().cross(rhs.vec);
+  -> Eigen::Matrix<typename Lhs::Scalar, 3, 3> {
+    Eigen::Matrix<typename Lhs::Scalar, 3, 3> out =
+      rhs.vector() * lhs.vector().transpose();
+    out.diagonal().array() -= lhs.vector().dot(rhs.vector());
+    return out;
+}
+
+/**
+ * Multiply a cross-matrix by a scalar
+ *
+ * The result is the cross matrix of the scaled vector.
+ */
+template <typename VecType,
+          typename T,
+          wave::internal::enable_if_cross_scalar_t<VecType, T> = 0>
+EIGEN_DEVICE_FUNC inline auto operator*(const wave::CrossMatrix<VecType> &crossMat,
+                                        const T &scalar) ->
+  typename wave::CrossMatrix<VecType>::ScaledReturnType {
+    using Scalar = typename VecType::Scalar;
+    return typename wave::CrossMatrix<VecType>::ScaledReturnType{crossMat.vec *
+                                                                 Scalar(scalar)};
+}
+
+/**
+ * Multiply a scalar by a cross-matrix
+ *
+ * The result is the cross matrix of the scaled vector.
+ */
+template <typename VecType,
+          typename T,
+          wave::internal::enable_if_cross_scalar_t<VecType, T> = 0>
+EIGEN_DEVICE_FUNC inline auto operator*(const T &scalar,
+                                        const wave::CrossMatrix<VecType> &crossMat) ->
+  typename wave::CrossMatrix<VecType>::ScaledReturnType {
+    return crossMat * scalar;
+}
+
+/**
+ * Divide a cross-matrix by a scalar
+ *
+ * The result is the cross matrix of the divided vector.
+ */
+template <typename VecType,
+          typename T,
+          wave::internal::enable_if_cross_scalar_t<VecType, T> = 0>
+EIGEN_DEVICE_FUNC inline auto operator/(const wave::CrossMatrix<VecType> &crossMat,
+                                        const T &scalar) ->
+  typename wave::CrossMatrix<VecType>::QuotientReturnType {
+    using Scalar = typename VecType::Scalar;
+    return typename wave::CrossMatrix<VecType>::QuotientReturnType{crossMat.vec /
+                                                                   Scalar(scalar)};
 }
 
 /**
@@ -207,25 +296,40 @@ EIGEN_DEVICE_FUNC inline const wave::CrossMatrix<VecType> &operator*(
     return cross;
 }
 
+/**
+ * Multiply a Zero expression by a CrossMatrix expression
+ * (Provided to break tie between the other specializations)
+ */
+template <typename VecType, typename Scalar, int Rows>
+EIGEN_DEVICE_FUNC inline auto operator*(const wave::ZeroMatrix<Scalar, Rows, 3> &,
+                                        const wave::CrossMatrix<VecType> &)
+  -> wave::ZeroMatrix<Scalar, Rows, 3> {
+    return {};
+}
+
+/**
+ * Multiply a CrossMatrix expression by a Zero expression
+ * (Provided to break tie between the other specializations)
+ */
+template <typename VecType, typename Scalar, int Cols>
+EIGEN_DEVICE_FUNC inline auto operator*(const wave::CrossMatrix<VecType> &,
+                                        const wave::ZeroMatrix<Scalar, 3, Cols> &)
+  -> wave::ZeroMatrix<Scalar, 3, Cols> {
+    return {};
+}
+
 namespace internal {
 
+template <typename Scalar>
+struct functor_traits<::wave::internal::cross_matrix_op<Scalar>> {
+    enum { Cost = NumTraits<Scalar>::AddCost, PacketAccess = false, IsRepeatable = true };
+};
+
 // Static attributes of our CrossMatrix expression
 // See https://eigen.tuxfamily.org/dox/TopicNewExpressionType.html
 template <class VecType>
-struct traits<::wave::CrossMatrix<VecType>> {
-    using StorageKind = Eigen::Dense;
-    using XprKind = Eigen::MatrixXpr;
-    using StorageIndex = typename VecType::StorageIndex;
-    using Scalar = typename VecType::Scalar;
-    enum {
-        Flags = Eigen::AutoAlign,
-        RowsAtCompileTime = 3,
-        ColsAtCompileTime = 3,
-        MaxRowsAtCompileTime = 3,
-        MaxColsAtCompileTime = 3
-    };
-};
-
+struct traits<::wave::CrossMatrix<VecType>>
+  : traits<typename ::wave::CrossMatrix<VecType>::Base> {};
 
 }  // namespace internal
 }  // namespace Eigen
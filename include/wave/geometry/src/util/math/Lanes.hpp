@@ -0,0 +1,257 @@
+/**
+ * @file
+ *
+ * A scalar type holding several independent values, so one evaluation of an expression
+ * solves several problems at once.
+ */
+
+#ifndef WAVE_GEOMETRY_LANES_HPP
+#define WAVE_GEOMETRY_LANES_HPP
+
+#include <ostream>
+#include <Eigen/Core>
+#include "wave/geometry/src/util/math/BatchMath.hpp"
+
+namespace wave {
+
+/** A fixed number of independent scalars, used together as one scalar
+ *
+ * Arithmetic and math functions act lane by lane on an Eigen fixed-size array, so when
+ * N is a multiple of the packet size (e.g. 4 doubles with AVX) each operation is a few
+ * vector instructions.
+ *
+ * Lanes can be the Scalar of any leaf whose operations are written with laneGreater()
+ * and laneSelect() instead of branches: for example,
+ * `RelativeRotation<Eigen::Matrix<Lanes<double, 4>, 3, 1>>`. Evaluating an expression
+ * of such leaves, with or without jacobians, then gives the results of N independent
+ * expressions.
+ *
+ * Comparison operators are not defined, since their result would differ between lanes.
+ *
+ * @tparam Scalar_ the type of each lane, e.g. double
+ * @tparam N the number of lanes
+ */
+template <typename Scalar_, int N>
+class Lanes {
+ public:
+    using Scalar = Scalar_;
+    using Array = Eigen::Array<Scalar, N, 1>;
+
+    /** Constructs with uninitialized lanes */
+    Lanes() = default;
+
+    /** Constructs with the same value in every lane */
+    Lanes(const Scalar &s) : a{Array::Constant(s)} {}  // NOLINT(runtime/explicit)
+
+    /** Constructs from an Eigen array with one coefficient per lane */
+    template <typename OtherDerived>
+    explicit Lanes(const Eigen::ArrayBase<OtherDerived> &a) : a{a} {}
+
+    /** Returns the value of lane i */
+    const Scalar &operator[](int i) const {
+        return this->a[i];
+    }
+
+    /** Returns a mutable reference to lane i */
+    Scalar &operator[](int i) {
+        return this->a[i];
+    }
+
+    /** Returns the underlying array */
+    const Array &array() const noexcept {
+        return this->a;
+    }
+
+    /** Returns a mutable reference to the underlying array */
+    Array &array() noexcept {
+        return this->a;
+    }
+
+    Lanes &operator+=(const Lanes &rhs) {
+        this->a += rhs.a;
+        return *this;
+    }
+
+    Lanes &operator-=(const Lanes &rhs) {
+        this->a -= rhs.a;
+        return *this;
+    }
+
+    Lanes &operator*=(const Lanes &rhs) {
+        this->a *= rhs.a;
+        return *this;
+    }
+
+    Lanes &operator/=(const Lanes &rhs) {
+        this->a /= rhs.a;
+        return *this;
+    }
+
+    // The operators and functions below are hidden friends, found only by ADL, so they
+    // do not hide std::sqrt etc. from unqualified calls on plain scalars.
+
+    friend Lanes operator+(const Lanes &lhs, const Lanes &rhs) {
+        return Lanes{lhs.a + rhs.a};
+    }
+
+    friend Lanes operator-(const Lanes &lhs, const Lanes &rhs) {
+        return Lanes{lhs.a - rhs.a};
+    }
+
+    friend Lanes operator*(const Lanes &lhs, const Lanes &rhs) {
+        return Lanes{lhs.a * rhs.a};
+    }
+
+    friend Lanes operator/(const Lanes &lhs, const Lanes &rhs) {
+        return Lanes{lhs.a / rhs.a};
+    }
+
+    friend Lanes operator-(const Lanes &rhs) {
+        return Lanes{-rhs.a};
+    }
+
+    friend Lanes operator+(const Lanes &rhs) {
+        return rhs;
+    }
+
+    friend Lanes sqrt(const Lanes &x) {
+        return Lanes{x.a.sqrt()};
+    }
+
+    friend Lanes abs(const Lanes &x) {
+        return Lanes{x.a.abs()};
+    }
+
+    friend Lanes sin(const Lanes &x) {
+        Array sin_x, cos_x;
+        batchSinCos(x.a, sin_x, cos_x);
+        return Lanes{sin_x};
+    }
+
+    friend Lanes cos(const Lanes &x) {
+        Array sin_x, cos_x;
+        batchSinCos(x.a, sin_x, cos_x);
+        return Lanes{cos_x};
+    }
+
+    friend void sinCos(const Lanes &x, Lanes &s, Lanes &c) {
+        batchSinCos(x.a, s.a, c.a);
+    }
+
+    friend Lanes acos(const Lanes &x) {
+        return Lanes{batchAcos(x.a)};
+    }
+
+    friend Lanes atan2(const Lanes &y, const Lanes &x) {
+        return Lanes{batchAtan2(y.a, x.a)};
+    }
+
+    friend std::ostream &operator<<(std::ostream &os, const Lanes &x) {
+        return os << x.a.transpose();
+    }
+
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+ private:
+    Array a;
+};
+
+/** Lane-wise a > b: a mask with 1 in lanes where it holds and 0 elsewhere
+ *
+ * As for scalars, the mask is clear in lanes where either input is NaN.
+ */
+template <typename Scalar, int N>
+Lanes<Scalar, N> laneGreater(const Lanes<Scalar, N> &a, const Lanes<Scalar, N> &b) {
+    return Lanes<Scalar, N>{(a.array() > b.array()).template cast<Scalar>()};
+}
+
+/** Lane-wise select: a in lanes where mask is nonzero, and b elsewhere */
+template <typename Scalar, int N>
+Lanes<Scalar, N> laneSelect(const Lanes<Scalar, N> &mask,
+                            const Lanes<Scalar, N> &a,
+                            const Lanes<Scalar, N> &b) {
+    return Lanes<Scalar, N>{batchSelect(mask.array(), a.array(), b.array())};
+}
+
+/** Extracts lane i of an Eigen matrix of Lanes, as a matrix of plain scalars */
+template <typename Derived>
+auto laneOf(const Eigen::MatrixBase<Derived> &m, int i) -> Eigen::Matrix<
+  typename Derived::Scalar::Scalar,
+  Derived::RowsAtCompileTime,
+  Derived::ColsAtCompileTime> {
+    using Scalar = typename Derived::Scalar::Scalar;
+    Eigen::Matrix<Scalar, Derived::RowsAtCompileTime, Derived::ColsAtCompileTime> out{
+      m.rows(), m.cols()};
+    for (Eigen::Index c = 0; c < m.cols(); ++c) {
+        for (Eigen::Index r = 0; r < m.rows(); ++r) {
+            out(r, c) = m(r, c)[i];
+        }
+    }
+    return out;
+}
+
+/** Sets lane i of an Eigen matrix of Lanes from a matrix of plain scalars */
+template <typename Derived, typename OtherDerived>
+void setLane(Eigen::MatrixBase<Derived> &m,
+             int i,
+             const Eigen::MatrixBase<OtherDerived> &value) {
+    for (Eigen::Index c = 0; c < m.cols(); ++c) {
+        for (Eigen::Index r = 0; r < m.rows(); ++r) {
+            m(r, c)[i] = value(r, c);
+        }
+    }
+}
+
+}  // namespace wave
+
+namespace Eigen {
+
+/** Lets Eigen matrices hold Lanes as their Scalar */
+template <typename Scalar, int N>
+struct NumTraits<wave::Lanes<Scalar, N>> : NumTraits<Scalar> {
+    using Real = wave::Lanes<Scalar, N>;
+    using NonInteger = Real;
+    using Nested = Real;
+    using Literal = Scalar;
+
+    enum {
+        IsComplex = 0,
+        IsInteger = 0,
+        IsSigned = 1,
+        RequireInitialization = 0,
+        ReadCost = N * NumTraits<Scalar>::ReadCost,
+        AddCost = N * NumTraits<Scalar>::AddCost,
+        MulCost = N * NumTraits<Scalar>::MulCost
+    };
+
+    static inline Real epsilon() {
+        return Real{NumTraits<Scalar>::epsilon()};
+    }
+
+    static inline Real dummy_precision() {
+        return Real{NumTraits<Scalar>::dummy_precision()};
+    }
+
+    static inline Real highest() {
+        return Real{NumTraits<Scalar>::highest()};
+    }
+
+    static inline Real lowest() {
+        return Real{NumTraits<Scalar>::lowest()};
+    }
+};
+
+/** Allows mixing Lanes with plain scalars, e.g. in `matrix / 2` */
+template <typename Scalar, int N, typename BinaryOp>
+struct ScalarBinaryOpTraits<wave::Lanes<Scalar, N>, Scalar, BinaryOp> {
+    using ReturnType = wave::Lanes<Scalar, N>;
+};
+
+template <typename Scalar, int N, typename BinaryOp>
+struct ScalarBinaryOpTraits<Scalar, wave::Lanes<Scalar, N>, BinaryOp> {
+    using ReturnType = wave::Lanes<Scalar, N>;
+};
+
+}  // namespace Eigen
+
+#endif  // WAVE_GEOMETRY_LANES_HPP
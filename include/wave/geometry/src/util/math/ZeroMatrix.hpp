@@ -0,0 +1,103 @@
+/**
+ * @file
+ * Defines an Eigen expression for a zero matrix, which can be trivially multiplied.
+ */
+
+#ifndef WAVE_GEOMETRY_ZEROMATRIX_HPP
+#define WAVE_GEOMETRY_ZEROMATRIX_HPP
+
+#include <Eigen/Geometry>
+#include "wave/geometry/src/util/meta/template_helpers.hpp"
+
+namespace wave {
+
+/**
+ * An Eigen expression for a (Rows x Cols) zero matrix
+ *
+ * Products with a ZeroMatrix are a ZeroMatrix, found without any arithmetic. For example,
+ * it is the jacobian of an expression w.r.t. a leaf not in it.
+ */
+template <typename Scalar, int Rows, int Cols>
+class ZeroMatrix : public Eigen::Matrix<Scalar, Rows, Cols>::ConstantReturnType {
+ public:
+    using MatrixType = Eigen::Matrix<Scalar, Rows, Cols>;
+    using Base = typename MatrixType::ConstantReturnType;
+    ZeroMatrix() : Base{MatrixType::Zero()} {}
+};
+
+// Forward declaration
+template <typename Scalar, int N>
+class IdentityMatrix;
+
+}  // namespace wave
+
+namespace Eigen {
+
+namespace internal {
+
+// Static attributes of our Zero expression
+// See https://eigen.tuxfamily.org/dox/TopicNewExpressionType.html
+template <typename Scalar, int Rows, int Cols>
+struct traits<::wave::ZeroMatrix<Scalar, Rows, Cols>>
+  : traits<typename Eigen::Matrix<Scalar, Rows, Cols>::ConstantReturnType> {};
+
+}  // namespace internal
+
+/**
+ * Multiply a Zero expression by another matrix on the right
+ */
+template <typename Scalar, int Rows, int Cols, typename OtherDerived>
+EIGEN_DEVICE_FUNC inline auto operator*(const wave::ZeroMatrix<Scalar, Rows, Cols> &,
+                                        const Eigen::MatrixBase<OtherDerived> &)
+  -> wave::ZeroMatrix<Scalar, Rows, OtherDerived::ColsAtCompileTime> {
+    static_assert(OtherDerived::RowsAtCompileTime == Cols, "Invalid matrix product");
+    return {};
+}
+
+/**
+ * Multiply a Zero expression by another matrix on the left
+ */
+template <typename Scalar, int Rows, int Cols, typename OtherDerived>
+EIGEN_DEVICE_FUNC inline auto operator*(const Eigen::MatrixBase<OtherDerived> &,
+                                        const wave::ZeroMatrix<Scalar, Rows, Cols> &)
+  -> wave::ZeroMatrix<Scalar, OtherDerived::RowsAtCompileTime, Cols> {
+    static_assert(OtherDerived::ColsAtCompileTime == Rows, "Invalid matrix product");
+    return {};
+}
+
+/**
+ * Multiply two Zero expressions
+ * (Provided to break tie between the other two specializations)
+ */
+template <typename Scalar, int Rows, int Inner, int Cols>
+EIGEN_DEVICE_FUNC inline auto operator*(const wave::ZeroMatrix<Scalar, Rows, Inner> &,
+                                        const wave::ZeroMatrix<Scalar, Inner, Cols> &)
+  -> wave::ZeroMatrix<Scalar, Rows, Cols> {
+    return {};
+}
+
+/**
+ * Multiply an Identity expression by a Zero expression
+ * (Provided to break tie between the other specializations)
+ */
+template <typename Scalar, int N, int Cols>
+EIGEN_DEVICE_FUNC inline auto operator*(const wave::IdentityMatrix<Scalar, N> &,
+                                        const wave::ZeroMatrix<Scalar, N, Cols> &)
+  -> wave::ZeroMatrix<Scalar, N, Cols> {
+    return {};
+}
+
+/**
+ * Multiply a Zero expression by an Identity expression
+ * (Provided to break tie between the other specializations)
+ */
+template <typename Scalar, int Rows, int N>
+EIGEN_DEVICE_FUNC inline auto operator*(const wave::ZeroMatrix<Scalar, Rows, N> &,
+                                        const wave::IdentityMatrix<Scalar, N> &)
+  -> wave::ZeroMatrix<Scalar, Rows, N> {
+    return {};
+}
+
+}  // namespace Eigen
+
+#endif  // WAVE_GEOMETRY_ZEROMATRIX_HPP
@@ -42,6 +42,57 @@ Eigen::Quaternion<Real> randomQuaternion() {
       std::cos(t2) * s2, std::sin(t1) * s1, std::cos(t1) * s1, std::sin(t2) * s2};
 }
 
+/** Returns whether a > b
+ *
+ * Expressions use this and laneSelect() instead of branching, so that they also work
+ * with scalar types holding several lanes (see Lanes), which overload both.
+ */
+template <typename Scalar>
+bool laneGreater(const Scalar &a, const Scalar &b) {
+    return a > b;
+}
+
+/** Returns a if mask is true, otherwise b
+ *
+ * Both a and b are evaluated. Lane types overload this to choose lane by lane.
+ */
+template <typename Scalar>
+Scalar laneSelect(bool mask, const Scalar &a, const Scalar &b) {
+    return mask ? a : b;
+}
+
+/** Returns the squared angle below which a rotation coefficient divided by the angle to
+ * the power 2K is found from its Taylor series
+ *
+ * A coefficient such as (1 - cos(t)) / t^2 (K = 1) loses about eps / t^(2K) to
+ * cancellation. Below this threshold, eps^(1 / 4K), its series kept to the t^4 term is
+ * accurate to rounding instead. For double, it is about 1.2e-4 for K = 1 and 1.1e-2 for
+ * K = 2.
+ */
+template <int K, typename Scalar>
+const Scalar &taylorThreshold() {
+    static_assert(K == 1 || K == 2, "Only K = 1 and K = 2 are provided");
+    using std::sqrt;
+    static const Scalar threshold = [] {
+        Scalar t = sqrt(sqrt(Eigen::NumTraits<Scalar>::epsilon()));
+        return K == 2 ? Scalar{sqrt(t)} : t;
+    }();
+    return threshold;
+}
+
+/** Sets s and c to the sine and cosine of x
+ *
+ * For plain scalars the compiler fuses the two calls into one. Lane types overload this
+ * to find both in one pass over the lanes.
+ */
+template <typename Scalar>
+void sinCos(const Scalar &x, Scalar &s, Scalar &c) {
+    using std::cos;
+    using std::sin;
+    s = sin(x);
+    c = cos(x);
+}
+
 /** Go from a skew-symmetric (cross) matrix to a compact vector
  *
  * Also known as the "vee" operator.
@@ -204,6 +204,30 @@ struct concat_if_unique<List<As...>, List<>> : std::true_type {
 };
 
 
+/** Append the items of list B which do not already appear in list A.
+ *
+ * Unlike concat_if_unique, this always succeeds; `type` keeps the first occurrence of
+ * each item.
+ */
+template <typename A, typename B>
+struct concat_unique;
+
+template <typename A, typename B>
+using concat_unique_t = typename concat_unique<A, B>::type;
+
+template <template <typename...> class List, typename... As, typename B0, typename... Bs>
+struct concat_unique<List<As...>, List<B0, Bs...>>
+  : concat_unique<tmp::conditional_t<find<List<As...>, B0>::value >= 0,
+                                     List<As...>,
+                                     List<As..., B0>>,
+                  List<Bs...>> {};
+
+template <template <typename...> class List, typename... As>
+struct concat_unique<List<As...>, List<>> {
+    using type = List<As...>;
+};
+
+
 }  // namespace tmp
 }  // namespace wave
 
@@ -0,0 +1,190 @@
+/**
+ * @file
+ *
+ * A minimal thread pool for parallel loops over independent elements
+ */
+
+#ifndef WAVE_GEOMETRY_THREADPOOL_HPP
+#define WAVE_GEOMETRY_THREADPOOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace wave {
+
+/** A fixed set of threads running parallel loops over index ranges
+ *
+ * Each call to parallelFor() splits the index range into one contiguous part per thread.
+ * A thread takes grains from the front of its own part, and when that is used up, steals
+ * grains from the other parts. A thread therefore mostly writes one contiguous region of
+ * an output array, while uneven costs are still balanced at the end of the loop.
+ *
+ * The calling thread takes part in each loop, so a pool of one thread has no workers
+ * and runs everything inline.
+ */
+class ThreadPool {
+ public:
+    /** Starts a pool using num_threads threads in total, including the calling thread
+     *
+     * @param num_threads the number of threads, or 0 to use one per hardware thread
+     */
+    explicit ThreadPool(unsigned int num_threads = 0)
+        : parts{new Part[numThreadsOrDefault(num_threads)]} {
+        const auto n = numThreadsOrDefault(num_threads);
+        this->workers.reserve(n - 1);
+        for (unsigned int t = 1; t < n; ++t) {
+            this->workers.emplace_back(&ThreadPool::workerLoop, this, t);
+        }
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /** Stops and joins all worker threads */
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock{this->mutex};
+            this->stop = true;
+        }
+        this->start_cv.notify_all();
+        for (auto &worker : this->workers) {
+            worker.join();
+        }
+    }
+
+    /** Returns the number of threads used by each loop, including the calling thread */
+    unsigned int numThreads() const noexcept {
+        return static_cast<unsigned int>(this->workers.size()) + 1;
+    }
+
+    /** Calls f(begin, end) on disjoint ranges covering [0, n), using all threads
+     *
+     * Returns once all calls have finished. Each range has at most `grain` elements. f is
+     * called concurrently from several threads and must not throw.
+     *
+     * A pool runs one loop at a time: parallelFor must not be called from inside f, or
+     * from two threads at once.
+     */
+    template <typename F>
+    void parallelFor(std::size_t n, std::size_t grain, const F &f) {
+        grain = std::max(grain, std::size_t{1});
+        if (n == 0) {
+            return;
+        }
+
+        const auto num_parts = this->numThreads();
+        for (unsigned int t = 0; t < num_parts; ++t) {
+            this->parts[t].next.store(n * t / num_parts, std::memory_order_relaxed);
+            this->parts[t].end = n * (t + 1) / num_parts;
+        }
+        this->job = Job{&ThreadPool::invoke<F>, &f, grain};
+
+        if (!this->workers.empty()) {
+            {
+                std::lock_guard<std::mutex> lock{this->mutex};
+                this->busy = this->workers.size();
+                ++this->generation;
+            }
+            this->start_cv.notify_all();
+        }
+
+        this->runParts(0);
+
+        std::unique_lock<std::mutex> lock{this->mutex};
+        this->done_cv.wait(lock, [this] { return this->busy == 0; });
+    }
+
+ private:
+    static constexpr std::size_t CacheLineSize = 64;
+
+    /** One thread's share of the index range
+     *
+     * The padding keeps each counter on its own cache line, whatever the alignment of
+     * the allocation, so threads claiming grains do not slow each other down.
+     */
+    struct Part {
+        char pad_before[CacheLineSize];
+        std::atomic<std::size_t> next;
+        std::size_t end;
+        char pad_after[CacheLineSize];
+    };
+
+    /** A type-erased loop body */
+    struct Job {
+        void (*func)(const void *, std::size_t, std::size_t);
+        const void *f;
+        std::size_t grain;
+    };
+
+    template <typename F>
+    static void invoke(const void *f, std::size_t begin, std::size_t end) {
+        (*static_cast<const F *>(f))(begin, end);
+    }
+
+    static unsigned int numThreadsOrDefault(unsigned int num_threads) {
+        if (num_threads == 0) {
+            num_threads = std::thread::hardware_concurrency();
+        }
+        return std::max(num_threads, 1u);
+    }
+
+    /** Runs grains from thread t's own part, then steals from the others in turn */
+    void runParts(unsigned int t) {
+        const auto num_parts = this->numThreads();
+        const auto grain = this->job.grain;
+        for (unsigned int k = 0; k < num_parts; ++k) {
+            Part &part = this->parts[(t + k) % num_parts];
+            for (;;) {
+                const auto begin = part.next.fetch_add(grain, std::memory_order_relaxed);
+                if (begin >= part.end) {
+                    break;
+                }
+                this->job.func(this->job.f, begin, std::min(begin + grain, part.end));
+            }
+        }
+    }
+
+    void workerLoop(unsigned int t) {
+        std::size_t seen_generation = 0;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock{this->mutex};
+                this->start_cv.wait(lock, [this, seen_generation] {
+                    return this->stop || this->generation != seen_generation;
+                });
+                if (this->stop) {
+                    return;
+                }
+                seen_generation = this->generation;
+            }
+
+            this->runParts(t);
+
+            std::lock_guard<std::mutex> lock{this->mutex};
+            if (--this->busy == 0) {
+                this->done_cv.notify_one();
+            }
+        }
+    }
+
+    std::unique_ptr<Part[]> parts;
+    std::vector<std::thread> workers;
+    Job job{};
+
+    std::mutex mutex;
+    std::condition_variable start_cv;
+    std::condition_variable done_cv;
+    std::size_t generation = 0;
+    std::size_t busy = 0;
+    bool stop = false;
+};
+
+}  // namespace wave
+
+#endif  // WAVE_GEOMETRY_THREADPOOL_HPP
@@ -0,0 +1,240 @@
+/**
+ * @file
+ *
+ * Tests for structure-of-arrays batch leaves, comparing against element-wise evaluation
+ */
+
+#include "wave/geometry/geometry.hpp"
+#include "test.hpp"
+
+namespace {
+
+const int N = 37;  // Deliberately not a multiple of any SIMD packet size
+
+template <typename Batch, typename Element>
+Batch randomBatch(int n) {
+    Batch batch{n};
+    for (int i = 0; i < n; ++i) {
+        batch.set(i, Element::Random());
+    }
+    return batch;
+}
+
+}  // namespace
+
+TEST(BatchTest, getSetRoundTrip) {
+    wave::RotationQBatchd qb{N};
+    wave::RotationMBatchd mb{N};
+    wave::TranslationBatchd tb{N};
+    wave::RigidTransformQBatchd rb{N};
+    for (int i = 0; i < N; ++i) {
+        const auto q = wave::RotationQd::Random();
+        const auto m = wave::RotationMd::Random();
+        const auto t = wave::Translationd::Random();
+        const auto r = wave::RigidTransformQd::Random();
+        qb.set(i, q);
+        mb.set(i, m);
+        tb.set(i, t);
+        rb.set(i, r);
+        EXPECT_EQ(q.value().coeffs(), qb.get(i).value().coeffs());
+        EXPECT_EQ(m.value(), mb.get(i).value());
+        EXPECT_EQ(t.value(), tb.get(i).value());
+        EXPECT_EQ(r.value(), rb.get(i).value());
+    }
+    EXPECT_EQ(N, qb.size());
+}
+
+TEST(BatchTest, quaternionCompose) {
+    const auto a = randomBatch<wave::RotationQBatchd, wave::RotationQd>(N);
+    const auto b = randomBatch<wave::RotationQBatchd, wave::RotationQd>(N);
+
+    const wave::RotationQBatchd res{a * b};
+    ASSERT_EQ(N, res.size());
+    for (int i = 0; i < N; ++i) {
+        const wave::RotationQd expected{a.get(i) * b.get(i)};
+        EXPECT_APPROX(expected, res.get(i));
+    }
+}
+
+TEST(BatchTest, rvalueLeaves) {
+    const auto a = randomBatch<wave::RotationQBatchd, wave::RotationQd>(N);
+    const auto b = randomBatch<wave::RotationQBatchd, wave::RotationQd>(N);
+
+    // Temporaries are held by value in the expression tree
+    const wave::RotationQBatchd res{wave::RotationQBatchd{a} *
+                                    inverse(wave::RotationQBatchd{b})};
+    for (int i = 0; i < N; ++i) {
+        const wave::RotationQd expected{a.get(i) * inverse(b.get(i))};
+        EXPECT_APPROX(expected, res.get(i));
+    }
+}
+
+TEST(BatchTest, quaternionRotateAndInverse) {
+    const auto a = randomBatch<wave::RotationQBatchd, wave::RotationQd>(N);
+    const auto v = randomBatch<wave::TranslationBatchd, wave::Translationd>(N);
+
+    const wave::TranslationBatchd res{inverse(a) * v};
+    for (int i = 0; i < N; ++i) {
+        const wave::Translationd expected{inverse(a.get(i)) * v.get(i)};
+        EXPECT_APPROX(expected, res.get(i));
+    }
+}
+
+TEST(BatchTest, matrixComposeRotateInverse) {
+    const auto a = randomBatch<wave::RotationMBatchd, wave::RotationMd>(N);
+    const auto b = randomBatch<wave::RotationMBatchd, wave::RotationMd>(N);
+    const auto v = randomBatch<wave::TranslationBatchd, wave::Translationd>(N);
+
+    const wave::TranslationBatchd res{a * inverse(b) * v};
+    for (int i = 0; i < N; ++i) {
+        const wave::Translationd expected{a.get(i) * inverse(b.get(i)) * v.get(i)};
+        EXPECT_APPROX(expected, res.get(i));
+    }
+}
+
+TEST(BatchTest, mixedConvertsQuaternionToMatrix) {
+    const auto a = randomBatch<wave::RotationQBatchd, wave::RotationQd>(N);
+    const auto b = randomBatch<wave::RotationMBatchd, wave::RotationMd>(N);
+
+    const auto res = eval(a * b);
+    static_assert(
+      std::is_same<wave::RotationMBatchd, wave::tmp::remove_cr_t<decltype(res)>>{}, "");
+    for (int i = 0; i < N; ++i) {
+        const wave::RotationMd expected{a.get(i) * b.get(i)};
+        EXPECT_APPROX(expected, res.get(i));
+    }
+}
+
+TEST(BatchTest, rigidTransform) {
+    const auto a = randomBatch<wave::RigidTransformQBatchd, wave::RigidTransformQd>(N);
+    const auto b = randomBatch<wave::RigidTransformQBatchd, wave::RigidTransformQd>(N);
+    const auto v = randomBatch<wave::TranslationBatchd, wave::Translationd>(N);
+
+    const wave::RigidTransformQBatchd composed{a * inverse(b)};
+    const wave::TranslationBatchd transformed{a * v};
+    for (int i = 0; i < N; ++i) {
+        const wave::RigidTransformQd expected_composed{a.get(i) * inverse(b.get(i))};
+        const wave::Translationd expected_transformed{a.get(i) * v.get(i)};
+        EXPECT_APPROX(expected_composed, composed.get(i));
+        EXPECT_APPROX(expected_transformed, transformed.get(i));
+    }
+}
+
+TEST(BatchTest, translationSum) {
+    const auto a = randomBatch<wave::TranslationBatchd, wave::Translationd>(N);
+    const auto b = randomBatch<wave::TranslationBatchd, wave::Translationd>(N);
+
+    const wave::TranslationBatchd res{a - b};
+    for (int i = 0; i < N; ++i) {
+        const wave::Translationd expected{a.get(i) - b.get(i)};
+        EXPECT_APPROX(expected, res.get(i));
+    }
+}
+
+TEST(BatchTest, framed) {
+    using RQ_AB = wave::RotationQBatchFd<FrameA, FrameB>;
+    using RM_BC = wave::RotationMBatchFd<FrameB, FrameC>;
+    using T_CCD = wave::TranslationBatchFd<FrameC, FrameC, FrameD>;
+
+    RQ_AB a{N};
+    RM_BC b{N};
+    T_CCD v{N};
+    for (int i = 0; i < N; ++i) {
+        a.set(i, wave::RotationQFd<FrameA, FrameB>::Random());
+        b.set(i, wave::RotationMFd<FrameB, FrameC>::Random());
+        v.set(i, wave::TranslationFd<FrameC, FrameC, FrameD>::Random());
+    }
+
+    const auto res = eval(a * b * v);
+    static_assert(std::is_same<wave::TranslationBatchFd<FrameA, FrameC, FrameD>,
+                               wave::tmp::remove_cr_t<decltype(res)>>{},
+                  "");
+    ASSERT_EQ(N, res.size());
+    for (int i = 0; i < N; ++i) {
+        const wave::TranslationFd<FrameA, FrameC, FrameD> expected =
+          a.get(i) * b.get(i) * v.get(i);
+        EXPECT_APPROX(expected, res.get(i));
+    }
+}
+
+namespace {
+
+/** Rotation vectors of random direction, including tiny and zero angles */
+wave::RelativeRotationBatchd randomRelativeRotations() {
+    wave::RelativeRotationBatchd batch{N};
+    for (int i = 0; i < N; ++i) {
+        const double angle = i < 4 ? 0 : i < 8 ? 1e-9 * i : 3.1 * i / N;
+        const Eigen::Vector3d axis = Eigen::Vector3d::Random().normalized();
+        batch.set(i, wave::RelativeRotationd{angle * axis});
+    }
+    return batch;
+}
+
+/** Copies the i'th 3x3 matrix out of a batch of column-major coefficients */
+Eigen::Matrix3d getMatrix(const Eigen::Array<double, Eigen::Dynamic, 9> &a, int i) {
+    Eigen::Matrix3d m;
+    Eigen::Map<Eigen::Array<double, 1, 9>>{m.data()} = a.row(i);
+    return m;
+}
+
+}  // namespace
+
+TEST(BatchTest, expMap) {
+    const auto phi = randomRelativeRotations();
+
+    const wave::RotationMBatchd res{exp(phi)};
+    const auto jac = wave::internal::expMapJacobianBatch(phi.value());
+    for (int i = 0; i < N; ++i) {
+        wave::RotationMd expected;
+        Eigen::Matrix3d expected_jac;
+        const auto phi_i = phi.get(i);
+        std::tie(expected, expected_jac) = exp(phi_i).evalWithJacobians();
+        EXPECT_APPROX(expected, res.get(i));
+        EXPECT_APPROX(expected_jac, getMatrix(jac, i));
+    }
+}
+
+TEST(BatchTest, logMap) {
+    const auto phi = randomRelativeRotations();
+    const wave::RotationMBatchd r{exp(phi)};
+
+    const wave::RelativeRotationBatchd res{log(r)};
+    const auto jac = wave::internal::logMapJacobianBatch(res.value());
+    for (int i = 0; i < N; ++i) {
+        wave::RelativeRotationd expected;
+        Eigen::Matrix3d expected_jac;
+        const auto r_i = r.get(i);
+        std::tie(expected, expected_jac) = log(r_i).evalWithJacobians();
+        EXPECT_APPROX(expected, res.get(i));
+        EXPECT_APPROX(phi.get(i), res.get(i));
+        EXPECT_APPROX(expected_jac, getMatrix(jac, i));
+        EXPECT_APPROX(Eigen::Matrix3d::Identity(),
+                      getMatrix(wave::internal::expMapJacobianBatch(res.value()), i) *
+                        getMatrix(jac, i));
+    }
+}
+
+TEST(BatchTest, logMapOfQuaternions) {
+    const auto a = randomBatch<wave::RotationQBatchd, wave::RotationQd>(N);
+
+    const wave::RelativeRotationBatchd res{log(a)};
+    for (int i = 0; i < N; ++i) {
+        // Random rotations can come close to pi, where the single-element log map loses
+        // digits in acos. Compare to Eigen's conversion, which uses atan2 as the batch
+        // kernel does.
+        const Eigen::AngleAxisd aa{a.get(i).value()};
+        const Eigen::Vector3d expected = aa.angle() * aa.axis();
+        EXPECT_PRED3(MatricesApproxPrec, expected, res.get(i).value(), 1e-9);
+    }
+}
+
+TEST(BatchTest, framedExpLog) {
+    wave::RelativeRotationBatchFd<FrameA, FrameB, FrameC> phi{
+      randomRelativeRotations().value()};
+
+    const auto res = eval(log(exp(phi)));
+    static_assert(std::is_same<wave::RelativeRotationBatchFd<FrameA, FrameA, FrameA>,
+                               wave::tmp::remove_cr_t<decltype(res)>>{},
+                  "");
+    EXPECT_TRUE(res.value().isApprox(phi.value()));
+}
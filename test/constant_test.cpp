@@ -0,0 +1,116 @@
+/**
+ * @file
+ *
+ * Tests for Constant leaves, comparing against the same expressions with ordinary leaves
+ */
+
+#include "wave/geometry/geometry.hpp"
+#include "test.hpp"
+
+TEST(ConstantTest, value) {
+    const auto R1 = wave::RotationQd::Random();
+    const auto p = wave::Translationd::Random();
+    const auto C1 = constant(R1);
+
+    EXPECT_APPROX(R1, wave::RotationQd{C1});
+    EXPECT_APPROX(wave::Translationd{R1 * p}, wave::Translationd{C1 * p});
+    EXPECT_APPROX(wave::RelativeRotationd{log(R1)}, wave::RelativeRotationd{log(C1)});
+}
+
+TEST(ConstantTest, notALeafForJacobians) {
+    using C = wave::Constant<wave::RotationQd>;
+    using Expr = wave::Compose<C, wave::Compose<wave::RotationMd, C>>;
+    static_assert(wave::internal::unique_leaves_t<Expr>{},
+                  "A repeated Constant type is allowed");
+    static_assert(std::is_same<typename wave::internal::unique_leaves_t<Expr>::type,
+                               wave::tmp::type_list<wave::RotationMd>>{},
+                  "A Constant is not one of the leaves");
+    static_assert(!wave::internal::contains_same_type<Expr, C>{}, "");
+}
+
+TEST(ConstantTest, reverseJacobians) {
+    const auto meas = wave::RotationQd::Random();
+    const auto R1 = wave::RotationMd::Random();
+    const auto R2 = wave::RotationAd::Random();
+    const auto C = constant(meas);
+
+    const auto expected = log(inverse(meas) * inverse(R1) * R2).evalWithJacobians();
+    const auto actual = log(inverse(C) * inverse(R1) * R2).evalWithJacobians();
+    static_assert(std::tuple_size<decltype(actual)>{} == 3, "");
+    EXPECT_APPROX(std::get<0>(expected), std::get<0>(actual));
+    EXPECT_PRED2(MatricesApprox, std::get<2>(expected), std::get<1>(actual));
+    EXPECT_PRED2(MatricesApprox, std::get<3>(expected), std::get<2>(actual));
+
+    // Constant leaves have no bit in a mask of leaves to hold constant
+    const auto masked = log(inverse(C) * inverse(R1) * R2).evalWithJacobians(
+      std::bitset<2>{"10"});
+    EXPECT_PRED2(MatricesApprox, std::get<2>(expected), std::get<1>(masked));
+    EXPECT_TRUE(std::get<2>(masked).isZero());
+
+    // A constant subtree, as the rhs of its parent
+    const auto p = wave::Translationd::Random();
+    const auto expected2 = (R1 * (meas * p)).evalWithJacobians();
+    const auto actual2 = (R1 * (C * constant(p))).evalWithJacobians();
+    static_assert(std::tuple_size<decltype(actual2)>{} == 2, "");
+    EXPECT_APPROX(std::get<0>(expected2), std::get<0>(actual2));
+    EXPECT_PRED2(MatricesApprox, std::get<1>(expected2), std::get<1>(actual2));
+
+    // Only constants
+    const auto actual3 = (C * constant(p)).evalWithJacobians();
+    static_assert(std::tuple_size<decltype(actual3)>{} == 1, "");
+    EXPECT_APPROX(std::get<0>(expected2), wave::Translationd{R1 * std::get<0>(actual3)});
+
+    // Written into destinations, which are given only for the free leaves
+    const auto expr = log(inverse(C) * inverse(R1) * R2);
+    Eigen::Matrix3d J_R1, J_R2;
+    EXPECT_APPROX(std::get<0>(expected), expr.evalWithJacobiansInto(J_R1, J_R2));
+    EXPECT_PRED2(MatricesApprox, std::get<2>(expected), J_R1);
+    EXPECT_PRED2(MatricesApprox, std::get<3>(expected), J_R2);
+
+    double J_R1_raw[9];
+    double *jacobians[] = {J_R1_raw, nullptr};
+    EXPECT_APPROX(std::get<0>(expected), expr.evalWithJacobiansInto(jacobians));
+    using RowMajor3d = Eigen::Matrix<double, 3, 3, Eigen::RowMajor>;
+    EXPECT_PRED2(MatricesApprox, std::get<2>(expected), Eigen::Map<RowMajor3d>{J_R1_raw});
+}
+
+TEST(ConstantTest, jacobiansWithTargets) {
+    const auto meas = wave::RotationQd::Random();
+    const auto R1 = wave::RotationQd::Random();
+    const auto p = wave::Translationd::Random();
+    const auto C = constant(meas);
+
+    const auto expected = (meas * R1 * meas * p).evalWithJacobians(R1, p);
+    const auto check = [&](const decltype(expected) &actual) {
+        EXPECT_APPROX(std::get<0>(expected), std::get<0>(actual));
+        EXPECT_PRED2(MatricesApprox, std::get<1>(expected), std::get<1>(actual));
+        EXPECT_PRED2(MatricesApprox, std::get<2>(expected), std::get<2>(actual));
+    };
+    const auto expr = C * R1 * C * p;
+    check(expr.evalWithJacobians(R1, p));
+    check(wave::internal::evaluateWithJacobians(expr, R1, p));
+    check(wave::internal::evaluateWithTypedJacobians(expr, R1, p));
+    check(wave::internal::evaluateWithAdjointJacobians(expr, R1, p));
+
+    // The jacobian w.r.t. a Constant is zero
+    EXPECT_TRUE(expr.jacobian(C).isZero());
+    EXPECT_TRUE(wave::internal::evaluateJacobian(C * p, C).isZero());
+}
+
+TEST(ConstantTest, framed) {
+    using T_AB = wave::RigidTransformQFd<FrameA, FrameB>;
+    using T_BC = wave::RigidTransformMFd<FrameB, FrameC>;
+    const auto T1 = T_AB::Random();
+    const auto T2 = T_BC::Random();
+    const auto C2 = wave::Constant<T_BC>{T2};
+
+    const auto expected = (T1 * T2).evalWithJacobians();
+    const auto actual = (T1 * C2).evalWithJacobians();
+    static_assert(std::is_same<wave::LeftFrameOf<decltype(std::get<0>(actual))>,
+                               FrameA>{} &&
+                    std::is_same<wave::RightFrameOf<decltype(std::get<0>(actual))>,
+                                 FrameC>{},
+                  "Frames are kept");
+    EXPECT_APPROX(std::get<0>(expected), std::get<0>(actual));
+    EXPECT_PRED2(MatricesApprox, std::get<1>(expected), std::get<1>(actual));
+}
@@ -91,3 +91,120 @@ TEST(Imu, compareToHand) {
     EXPECT_APPROX(J_phi_i, res3);
     EXPECT_APPROX(J_phi_j, res4);
 }
+
+/** The residual of the above tests, built from one element of each input */
+struct ImuResidual {
+    template <typename Rij, typename Wg, typename Ri, typename Rj>
+    auto operator()(const Rij &delta_R_ij,
+                    const Wg &wg,
+                    const Ri &R_i,
+                    const Rj &R_j) const
+      -> decltype(log(inverse(delta_R_ij * exp(wg)) * inverse(R_i) * R_j)) {
+        return log(inverse(delta_R_ij * exp(wg)) * inverse(R_i) * R_j);
+    }
+};
+
+using RijVector = AlignedVector<RotationMFd<FrameI, FrameJ>>;
+using WgVector = AlignedVector<RelativeRotationFd<FrameJ, FrameJ, FrameJ>>;
+using RiVector = AlignedVector<RotationMFd<FrameW, FrameI>>;
+using RjVector = AlignedVector<RotationMFd<FrameW, FrameJ>>;
+
+TEST(Imu, batchMatchesSingle) {
+    // Not a multiple of BatchLanes, so the last elements are evaluated one at a time
+    const int N = 23;
+    static_assert(internal::batch_uses_lanes<
+                    ImuResidual,
+                    tmp::type_list<RijVector, WgVector, RiVector, RjVector>>{},
+                  "Groups of elements are evaluated together as Lanes");
+    using RQVector = AlignedVector<RotationQd>;
+    static_assert(!internal::batch_uses_lanes<
+                    ImuResidual,
+                    tmp::type_list<RQVector, WgVector, RQVector, RQVector>>{},
+                  "Quaternions have no lane type");
+    RijVector delta_R_ij;
+    WgVector wg;
+    RiVector R_i;
+    RjVector R_j;
+    for (int i = 0; i < N; ++i) {
+        delta_R_ij.push_back(RijVector::value_type::Random());
+        wg.push_back(WgVector::value_type::Random());
+        R_i.push_back(RiVector::value_type::Random());
+        R_j.push_back(RjVector::value_type::Random());
+    }
+
+    const auto res = evalBatchWithJacobians(ImuResidual{}, delta_R_ij, wg, R_i, R_j);
+    ASSERT_EQ(N, static_cast<int>(std::get<0>(res).size()));
+
+    for (int i = 0; i < N; ++i) {
+        const auto expected = ImuResidual{}(delta_R_ij[i], wg[i], R_i[i], R_j[i])
+                                .evalWithJacobians(delta_R_ij[i], wg[i], R_i[i], R_j[i]);
+        EXPECT_APPROX(std::get<0>(expected), std::get<0>(res)[i]);
+        EXPECT_APPROX(std::get<1>(expected), std::get<1>(res)[i]);
+        EXPECT_APPROX(std::get<2>(expected), std::get<2>(res)[i]);
+        EXPECT_APPROX(std::get<3>(expected), std::get<3>(res)[i]);
+        EXPECT_APPROX(std::get<4>(expected), std::get<4>(res)[i]);
+    }
+
+    // The elements after the last group of lanes are evaluated alone, as above
+    for (int i = N - N % internal::BatchLanes; i < N; ++i) {
+        const auto expected = ImuResidual{}(delta_R_ij[i], wg[i], R_i[i], R_j[i])
+                                .evalWithJacobians(delta_R_ij[i], wg[i], R_i[i], R_j[i]);
+        EXPECT_EQ(std::get<0>(expected).value(), std::get<0>(res)[i].value());
+        EXPECT_EQ(std::get<1>(expected), std::get<1>(res)[i]);
+    }
+}
+
+TEST(Imu, batchReusesOutputs) {
+    RijVector delta_R_ij(3, RijVector::value_type::Random());
+    WgVector wg(3, WgVector::value_type::Random());
+    RiVector R_i(3, RiVector::value_type::Random());
+    RjVector R_j(3, RjVector::value_type::Random());
+
+    using Expr = decltype(ImuResidual{}(delta_R_ij[0], wg[0], R_i[0], R_j[0]));
+    internal::batch_with_reverse_jacobians_t<Expr> outputs;
+
+    // Outputs are resized to fit the inputs
+    evalBatchWithJacobiansTo(outputs, ImuResidual{}, delta_R_ij, wg, R_i, R_j);
+    EXPECT_EQ(3u, std::get<0>(outputs).size());
+    EXPECT_EQ(3u, std::get<4>(outputs).size());
+    EXPECT_APPROX(std::get<0>(outputs)[0], std::get<0>(outputs)[2]);
+    EXPECT_APPROX(std::get<2>(outputs)[0], std::get<2>(outputs)[2]);
+
+    delta_R_ij.pop_back();
+    wg.pop_back();
+    R_i.pop_back();
+    R_j.pop_back();
+    evalBatchWithJacobiansTo(outputs, ImuResidual{}, delta_R_ij, wg, R_i, R_j);
+    EXPECT_EQ(2u, std::get<0>(outputs).size());
+    EXPECT_EQ(2u, std::get<4>(outputs).size());
+}
+
+TEST(Imu, parallelBatchMatchesSerial) {
+    // Enough elements for several grains per thread
+    const int N = 3000;
+    RijVector delta_R_ij;
+    WgVector wg;
+    RiVector R_i;
+    RjVector R_j;
+    for (int i = 0; i < N; ++i) {
+        delta_R_ij.push_back(RijVector::value_type::Random());
+        wg.push_back(WgVector::value_type::Random());
+        R_i.push_back(RiVector::value_type::Random());
+        R_j.push_back(RjVector::value_type::Random());
+    }
+
+    const auto expected = evalBatchWithJacobians(ImuResidual{}, delta_R_ij, wg, R_i, R_j);
+    for (const unsigned int num_threads : {1u, 3u, 8u}) {
+        ThreadPool pool{num_threads};
+        const auto res =
+          parallelEvalBatchWithJacobians(pool, ImuResidual{}, delta_R_ij, wg, R_i, R_j);
+        ASSERT_EQ(N, static_cast<int>(std::get<0>(res).size()));
+        for (int i = 0; i < N; ++i) {
+            EXPECT_EQ(std::get<0>(expected)[i].value(), std::get<0>(res)[i].value());
+            EXPECT_EQ(std::get<1>(expected)[i], std::get<1>(res)[i]);
+            EXPECT_EQ(std::get<2>(expected)[i], std::get<2>(res)[i]);
+            EXPECT_EQ(std::get<3>(expected)[i], std::get<3>(res)[i]);
+            EXPECT_EQ(std::get<4>(expected)[i], std::get<4>(res)[i]);
+        }
+    }
+}
@@ -0,0 +1,98 @@
+/**
+ * @file
+ *
+ * Tests for jacobians found as products of local jacobians in the cheapest order,
+ * comparing against the forward-mode TypedJacobianEvaluator
+ */
+
+#include "wave/geometry/geometry.hpp"
+#include "test.hpp"
+
+namespace {
+
+using wave::internal::chain_order;
+using wave::tmp::index_sequence;
+
+// The textbook example: (10 x 30) (30 x 5) (5 x 60) is cheapest as (AB)C
+using Textbook = index_sequence<10, 30, 5, 60>;
+static_assert(chain_order<Textbook, 0, 3>::cost == 4500, "");
+static_assert(chain_order<Textbook, 0, 3>::split == 2, "");
+
+// A point's jacobian w.r.t. the innermost of nested transforms is cheapest from the
+// left...
+using PointThroughTransforms = index_sequence<3, 3, 3, 6>;
+static_assert(chain_order<PointThroughTransforms, 0, 3>::split == 2, "");
+static_assert(wave::internal::is_chain_reordered<PointThroughTransforms>{}, "");
+// ...and a twist's jacobian w.r.t. a point, from the right, as TypedJacobianEvaluator
+using TwistFromPoint = index_sequence<6, 6, 6, 3>;
+static_assert(chain_order<TwistFromPoint, 0, 3>::split == 1, "");
+static_assert(!wave::internal::is_chain_reordered<TwistFromPoint>{}, "");
+
+template <typename Jacobian>
+int expectJacobiansMatch(const Jacobian &expected, const Jacobian &actual) {
+    EXPECT_PRED2(MatricesApprox, expected, actual);
+    return 0;
+}
+
+template <typename Tuple, int... I>
+void checkJacobiansMatch(const Tuple &expected,
+                         const Tuple &actual,
+                         wave::tmp::index_sequence<I...>) {
+    const int foreach[] = {
+      expectJacobiansMatch(std::get<I>(expected), std::get<I>(actual))...};
+    (void) foreach;
+}
+
+/** Checks the value and jacobians match those of TypedJacobianEvaluator */
+template <typename Derived, typename... Targets>
+void checkAgainstTyped(const wave::ExpressionBase<Derived> &expr,
+                       const Targets &... targets) {
+    const auto expected = wave::internal::evaluateWithTypedJacobians(expr, targets...);
+    const auto actual = wave::internal::evaluateWithChainJacobians(expr, targets...);
+    EXPECT_APPROX(std::get<0>(expected), std::get<0>(actual));
+    checkJacobiansMatch(
+      expected, actual, wave::tmp::make_index_sequence<sizeof...(Targets), 1>{});
+}
+
+}  // namespace
+
+TEST(JacobianChainTest, transformsAndPoints) {
+    const auto T1 = wave::RigidTransformQd::Random();
+    const auto T2 = wave::RigidTransformMd::Random();
+    const auto R = wave::RotationQd::Random();
+    const auto p = wave::Translationd::Random();
+    const auto v = wave::RelativeRotationd::Random();
+
+    checkAgainstTyped(T1 * T2 * p, T1, T2, p);
+    checkAgainstTyped(R * (T1 * (T2 * p)), T1, T2, R, p);
+    checkAgainstTyped(T1 * (R * (T2 * p)), T2);
+    checkAgainstTyped(R * exp(v) * (T1 * p), R, v, T1, p);
+    checkAgainstTyped(log(T1 * inverse(T2)), T1, T2);
+}
+
+TEST(JacobianChainTest, identityFactors) {
+    // Compose has an identity jacobian w.r.t. its lhs, and Sum w.r.t. both sides
+    const auto R1 = wave::RotationQd::Random();
+    const auto R2 = wave::RotationMd::Random();
+    const auto v = wave::RelativeRotationd::Random();
+
+    checkAgainstTyped(R1 * R2, R1, R2);
+    checkAgainstTyped(v + log(R1 * R2), v, R1);
+}
+
+TEST(JacobianChainTest, absentTarget) {
+    const auto R1 = wave::RotationQd::Random();
+    const auto R2 = wave::RotationMd::Random();
+    const auto p = wave::Translationd::Random();
+
+    const auto res = wave::internal::evaluateWithChainJacobians(R1 * p, R2, R1);
+    EXPECT_TRUE(std::get<1>(res).isZero());
+    checkAgainstTyped(R1 * p, R1);
+}
+
+TEST(JacobianChainTest, framed) {
+    const auto T1 = wave::RigidTransformQFd<FrameA, FrameB>::Random();
+    const auto R2 = wave::RotationMFd<FrameB, FrameC>::Random();
+    const auto p = wave::TranslationFd<FrameC, FrameC, FrameD>::Random();
+    checkAgainstTyped(T1 * (R2 * p), T1, R2, p);
+}
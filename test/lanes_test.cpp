@@ -0,0 +1,176 @@
+/**
+ * @file
+ *
+ * Tests for evaluating expressions with a multi-lane scalar type, comparing each lane
+ * against evaluation with plain doubles
+ */
+
+#include "wave/geometry/geometry.hpp"
+#include "test.hpp"
+
+namespace {
+
+const int N = 4;
+using L = wave::Lanes<double, N>;
+using Vec3L = Eigen::Matrix<L, 3, 1>;
+using Vec6L = Eigen::Matrix<L, 6, 1>;
+using Mat3L = Eigen::Matrix<L, 3, 3>;
+using RelativeRotationL = wave::RelativeRotation<Vec3L>;
+using RotationML = wave::MatrixRotation<Mat3L>;
+using TwistL = wave::Twist<Vec6L>;
+
+/** Rotation vectors with a zero, a tiny and two ordinary angles, so lanes differ in which
+ * case of each function they need */
+std::vector<Eigen::Vector3d> mixedRotationVectors() {
+    return {Eigen::Vector3d::Zero(),
+            Eigen::Vector3d::Random().normalized() * 1e-9,
+            Eigen::Vector3d::Random().normalized() * 0.7,
+            Eigen::Vector3d::Random().normalized() * 3.0};
+}
+
+template <typename Matrix>
+auto packLanes(const std::vector<Matrix> &values)
+  -> Eigen::Matrix<L, Matrix::RowsAtCompileTime, Matrix::ColsAtCompileTime> {
+    Eigen::Matrix<L, Matrix::RowsAtCompileTime, Matrix::ColsAtCompileTime> out;
+    for (int i = 0; i < N; ++i) {
+        wave::setLane(out, i, values[i]);
+    }
+    return out;
+}
+
+std::vector<Eigen::Matrix3d> randomRotationMatrices() {
+    std::vector<Eigen::Matrix3d> out;
+    for (int i = 0; i < N; ++i) {
+        out.push_back(wave::RotationMd::Random().value());
+    }
+    return out;
+}
+
+}  // namespace
+
+TEST(LanesTest, mathFunctions) {
+    const L x{Eigen::Array4d{-2.5, 0.0, 1e-9, 3.1}};
+    const L y{Eigen::Array4d{0.3, -0.5, 0.9, -0.99}};
+    for (int i = 0; i < N; ++i) {
+        EXPECT_DOUBLE_EQ(std::sin(x[i]), sin(x)[i]);
+        EXPECT_DOUBLE_EQ(std::cos(x[i]), cos(x)[i]);
+        EXPECT_DOUBLE_EQ(std::acos(y[i]), acos(y)[i]);
+        EXPECT_DOUBLE_EQ(std::sqrt(y[i] * y[i]), sqrt(y * y)[i]);
+        EXPECT_DOUBLE_EQ(x[i] * y[i] - 2 / y[i], (x * y - 2 / y)[i]);
+    }
+}
+
+TEST(LanesTest, selectAndGreater) {
+    const L x{Eigen::Array4d{-1.0, 0.0, 1.0, 2.0}};
+    const auto mask = wave::laneGreater(x, L{0.5});
+    const L res = wave::laneSelect(mask, L{1.0} / x, L{7.0});
+    EXPECT_EQ(7.0, res[0]);
+    EXPECT_EQ(7.0, res[1]);  // the discarded lane is infinite
+    EXPECT_EQ(1.0, res[2]);
+    EXPECT_EQ(0.5, res[3]);
+
+    // NaN lanes compare false, as scalars do
+    const L y{Eigen::Array4d{NAN, 1.0, NAN, 0.0}};
+    const auto nan_mask = wave::laneGreater(y, L{Eigen::Array4d{0.0, NAN, NAN, -1.0}});
+    EXPECT_EQ(0.0, nan_mask[0]);
+    EXPECT_EQ(0.0, nan_mask[1]);
+    EXPECT_EQ(0.0, nan_mask[2]);
+    EXPECT_EQ(1.0, nan_mask[3]);
+
+    EXPECT_TRUE(wave::laneGreater(1.0, 0.5));
+    EXPECT_EQ(2.0, wave::laneSelect(false, 1.0, 2.0));
+}
+
+TEST(LanesTest, expMap) {
+    const auto phis = mixedRotationVectors();
+    const RelativeRotationL phi{packLanes(phis)};
+
+    const auto &expr = exp(phi);
+    const auto res = expr.evalWithJacobians();
+    for (int i = 0; i < N; ++i) {
+        const wave::RelativeRotationd phi_i{phis[i]};
+        const auto &expr_i = exp(phi_i);
+        const auto expected = expr_i.evalWithJacobians();
+        EXPECT_PRED2(MatricesApprox,
+                     std::get<0>(expected).value(),
+                     wave::laneOf(std::get<0>(res).value(), i));
+        EXPECT_PRED2(
+          MatricesApprox, std::get<1>(expected), wave::laneOf(std::get<1>(res), i));
+    }
+}
+
+TEST(LanesTest, logMap) {
+    const auto phis = mixedRotationVectors();
+    std::vector<Eigen::Matrix3d> matrices;
+    for (const auto &phi : phis) {
+        matrices.push_back(wave::RotationMd{exp(wave::RelativeRotationd{phi})}.value());
+    }
+    const RotationML r{packLanes(matrices)};
+
+    const auto &expr = log(r);
+    const auto res = expr.evalWithJacobians();
+    for (int i = 0; i < N; ++i) {
+        const wave::RotationMd r_i{matrices[i]};
+        const auto &expr_i = log(r_i);
+        const auto expected = expr_i.evalWithJacobians();
+        EXPECT_PRED2(MatricesApprox,
+                     std::get<0>(expected).value(),
+                     wave::laneOf(std::get<0>(res).value(), i));
+        EXPECT_PRED2(
+          MatricesApprox, std::get<1>(expected), wave::laneOf(std::get<1>(res), i));
+        // The jacobian is finite even for the zero rotation
+        EXPECT_TRUE(wave::laneOf(std::get<1>(res), i).allFinite());
+    }
+}
+
+TEST(LanesTest, residualWithJacobians) {
+    const auto Rij = randomRotationMatrices();
+    const auto Ri = randomRotationMatrices();
+    const auto Rj = randomRotationMatrices();
+    const auto wgs = mixedRotationVectors();
+    const RotationML meas_Rij{packLanes(Rij)};
+    const RotationML R_i{packLanes(Ri)};
+    const RotationML R_j{packLanes(Rj)};
+    const RelativeRotationL wg{packLanes(wgs)};
+
+    const auto &expr = log(inverse(meas_Rij * exp(wg)) * inverse(R_i) * R_j);
+    const auto res = expr.evalWithJacobians(meas_Rij, wg, R_i, R_j);
+
+    for (int i = 0; i < N; ++i) {
+        const wave::RotationMd meas_Rij_i{Rij[i]};
+        const wave::RotationMd R_i_i{Ri[i]};
+        const wave::RotationMd R_j_i{Rj[i]};
+        const wave::RelativeRotationd wg_i{wgs[i]};
+        const auto &expr_i =
+          log(inverse(meas_Rij_i * exp(wg_i)) * inverse(R_i_i) * R_j_i);
+        const auto expected = expr_i.evalWithJacobians(meas_Rij_i, wg_i, R_i_i, R_j_i);
+
+        EXPECT_APPROX(std::get<0>(expected).value(),
+                      wave::laneOf(std::get<0>(res).value(), i));
+        EXPECT_APPROX(std::get<1>(expected), wave::laneOf(std::get<1>(res), i));
+        EXPECT_APPROX(std::get<2>(expected), wave::laneOf(std::get<2>(res), i));
+        EXPECT_APPROX(std::get<3>(expected), wave::laneOf(std::get<3>(res), i));
+        EXPECT_APPROX(std::get<4>(expected), wave::laneOf(std::get<4>(res), i));
+    }
+}
+
+TEST(LanesTest, twistExpLog) {
+    const auto phis = mixedRotationVectors();
+    std::vector<Eigen::Matrix<double, 6, 1>> twists;
+    for (const auto &phi : phis) {
+        Eigen::Matrix<double, 6, 1> twist;
+        twist << phi, Eigen::Vector3d::Random();
+        twists.push_back(twist);
+    }
+    const TwistL xi{packLanes(twists)};
+
+    const auto transform = eval(exp(xi));
+    const TwistL res{log(transform)};
+    for (int i = 0; i < N; ++i) {
+        const auto expected = eval(exp(wave::Twistd{twists[i]}));
+        EXPECT_PRED2(MatricesApprox,
+                     expected.value(),
+                     wave::laneOf(transform.value(), i));
+        EXPECT_PRED3(MatricesApproxPrec, twists[i], wave::laneOf(res.value(), i), 1e-9);
+    }
+}
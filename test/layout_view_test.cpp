@@ -0,0 +1,225 @@
+/**
+ * @file
+ *
+ * Tests for leaves and ranges viewing external arrays in other libraries' layouts,
+ * comparing against the usual leaves
+ */
+
+#include "wave/geometry/geometry.hpp"
+#include "test.hpp"
+
+namespace {
+
+const int N = 37;
+
+// Ceres-style quaternion, with the scalar part first
+using WXYZ = wave::QuaternionOrderWXYZ;
+
+// ROS-style pose, with the translation first, followed by four unrelated scalars
+using TQLayout = wave::PoseLayout<wave::QuaternionOrderXYZW, 3, 0>;
+const int PoseStride = 11;
+
+using PoseView = wave::RigidTransformLayoutMapd<TQLayout>;
+using PointView = wave::Translation<Eigen::Map<Eigen::Vector3d>>;
+using RowMajor36 = Eigen::Matrix<double, 3, 6, Eigen::RowMajor>;
+using RowMajor33 = Eigen::Matrix<double, 3, 3, Eigen::RowMajor>;
+
+void storeWXYZ(const Eigen::Quaterniond &q, double *data) {
+    data[0] = q.w();
+    data[1] = q.x();
+    data[2] = q.y();
+    data[3] = q.z();
+}
+
+void storeTQ(const wave::RigidTransformQd &T, double *data) {
+    Eigen::Map<Eigen::Vector3d>{data} = T.translation().value();
+    Eigen::Map<Eigen::Vector4d>{data + 3} = T.rotation().value().coeffs();
+}
+
+}  // namespace
+
+TEST(LayoutViewTest, orderedQuaternion) {
+    const auto R1 = wave::RotationQd::Random();
+    const auto R2 = wave::RotationQd::Random();
+    const auto p = wave::Translationd::Random();
+    double data[8];
+    storeWXYZ(R1.value(), data);
+    storeWXYZ(R2.value(), data + 4);
+    const wave::RotationOrderedQMapd<WXYZ> V1{Eigen::Map<Eigen::Vector4d>{data}};
+    const wave::RotationOrderedQMapd<WXYZ> V2{Eigen::Map<Eigen::Vector4d>{data + 4}};
+
+    EXPECT_PRED2(QuaternionsApprox, R1.value(), V1.quaternion());
+    EXPECT_APPROX(wave::Translationd{R1 * p}, wave::Translationd{V1 * p});
+    EXPECT_APPROX(wave::RotationQd{R1 * R2}, wave::RotationQd{V1 * V2});
+    EXPECT_APPROX(wave::RotationQd{inverse(R1)}, wave::RotationQd{inverse(V1)});
+    EXPECT_APPROX(wave::RelativeRotationd{log(R1)}, wave::RelativeRotationd{log(V1)});
+
+    const auto expected = (R1 * inverse(R2) * p).evalWithJacobians(R1, R2, p);
+    const auto actual = (V1 * inverse(V2) * p).evalWithJacobians(V1, V2, p);
+    EXPECT_APPROX(std::get<0>(expected), std::get<0>(actual));
+    EXPECT_PRED2(MatricesApprox, std::get<1>(expected), std::get<1>(actual));
+    EXPECT_PRED2(MatricesApprox, std::get<2>(expected), std::get<2>(actual));
+    EXPECT_PRED2(MatricesApprox, std::get<3>(expected), std::get<3>(actual));
+}
+
+TEST(LayoutViewTest, orderedQuaternionWriteBack) {
+    const auto R1 = wave::RotationQd::Random();
+    const auto R2 = wave::RotationMd::Random();
+    double data[6] = {0, 0, 0, 0, 5, 6};
+    wave::RotationOrderedQMapd<WXYZ> view{Eigen::Map<Eigen::Vector4d>{data + 1}};
+
+    view = R1 * R2;
+    const Eigen::Quaterniond expected{wave::RotationQd{R1 * R2}.value()};
+    EXPECT_PRED2(QuaternionsApprox,
+                 expected,
+                 Eigen::Quaterniond(data[1], data[2], data[3], data[4]));
+    EXPECT_EQ(0.0, data[0]);
+    EXPECT_EQ(6.0, data[5]);
+
+    view = wave::RotationOrderedQd<WXYZ>::Identity();
+    EXPECT_EQ(Eigen::Vector4d(1, 0, 0, 0), Eigen::Map<Eigen::Vector4d>{data + 1});
+}
+
+TEST(LayoutViewTest, layoutTransform) {
+    const auto T1 = wave::RigidTransformQd::Random();
+    const auto T2 = wave::RigidTransformQd::Random();
+    const auto p = wave::Translationd::Random();
+    double data[14];
+    storeTQ(T1, data);
+    storeTQ(T2, data + 7);
+    const PoseView V1{Eigen::Map<Eigen::Matrix<double, 7, 1>>{data}};
+    const PoseView V2{Eigen::Map<Eigen::Matrix<double, 7, 1>>{data + 7}};
+
+    EXPECT_APPROX(T1, wave::RigidTransformQd{V1});
+    EXPECT_APPROX(wave::Translationd{T1 * p}, wave::Translationd{V1 * p});
+    EXPECT_APPROX(wave::RigidTransformQd{T1 * T2}, wave::RigidTransformQd{V1 * V2});
+    EXPECT_APPROX(wave::RigidTransformQd{inverse(T1)},
+                  wave::RigidTransformQd{inverse(V1)});
+    EXPECT_APPROX(wave::Twistd{log(T1)}, wave::Twistd{log(V1)});
+
+    const auto expected = (inverse(T1) * T2 * p).evalWithJacobians(T1, T2, p);
+    const auto actual = (inverse(V1) * V2 * p).evalWithJacobians(V1, V2, p);
+    EXPECT_APPROX(std::get<0>(expected), std::get<0>(actual));
+    EXPECT_PRED2(MatricesApprox, std::get<1>(expected), std::get<1>(actual));
+    EXPECT_PRED2(MatricesApprox, std::get<2>(expected), std::get<2>(actual));
+    EXPECT_PRED2(MatricesApprox, std::get<3>(expected), std::get<3>(actual));
+}
+
+TEST(LayoutViewTest, layoutTransformWriteBack) {
+    const auto T1 = wave::RigidTransformQd::Random();
+    const auto T2 = wave::RigidTransformMd::Random();
+    double data[7];
+    PoseView view{Eigen::Map<Eigen::Matrix<double, 7, 1>>{data}};
+
+    view = T1 * T2;
+    double expected[7];
+    storeTQ(wave::RigidTransformQd{T1 * T2}, expected);
+    EXPECT_PRED2(MatricesApprox,
+                 (Eigen::Map<Eigen::Matrix<double, 7, 1>>{expected}),
+                 (Eigen::Map<Eigen::Matrix<double, 7, 1>>{data}));
+
+    // Through the rotation and translation separately
+    view.rotation() = inverse(T2.rotation());
+    view.translation() = T1.translation();
+    EXPECT_APPROX(wave::RotationMd{inverse(T2.rotation())}, view.rotation());
+    EXPECT_EQ(T1.translation().value(), (Eigen::Map<Eigen::Vector3d>{data}));
+
+    view = wave::RigidTransformLayoutd<TQLayout>::Identity();
+    EXPECT_EQ((Eigen::Matrix<double, 7, 1>{} << 0, 0, 0, 0, 0, 0, 1).finished(),
+              (Eigen::Map<Eigen::Matrix<double, 7, 1>>{data}));
+}
+
+TEST(LayoutViewTest, stridedBatchWithJacobians) {
+    // Poses with extra data between them, and points with a fourth coefficient
+    std::vector<double> poses(N * PoseStride, 7.0);
+    Eigen::Matrix4Xd points = Eigen::Matrix4Xd::Random(4, N);
+    std::vector<wave::RigidTransformQd> expected_poses;
+    for (int i = 0; i < N; ++i) {
+        expected_poses.push_back(wave::RigidTransformQd::Random());
+        storeTQ(expected_poses.back(), poses.data() + i * PoseStride);
+    }
+
+    // Write values and jacobians into external row-major buffers
+    Eigen::Matrix3Xd values{3, N};
+    std::vector<double> J_pose(N * 18), J_point(N * 9);
+    auto outputs =
+      std::make_tuple(wave::StridedView<PointView>{values.data(), N},
+                      wave::StridedView<Eigen::Map<RowMajor36>>{J_pose.data(), N},
+                      wave::StridedView<Eigen::Map<RowMajor33>>{J_point.data(), N});
+
+    const wave::StridedView<PoseView> pose_view{poses.data(), N, PoseStride};
+    const wave::StridedView<PointView> point_view{points.data(), N, 4};
+    wave::evalBatchWithJacobiansTo(
+      outputs,
+      [](const PoseView &T, const PointView &p) { return T * p; },
+      pose_view,
+      point_view);
+
+    for (int i = 0; i < N; ++i) {
+        const wave::Translationd p{points.col(i).head<3>()};
+        const auto &T = expected_poses[i];
+        const auto expected = (T * p).evalWithJacobians(T, p);
+        EXPECT_PRED2(MatricesApprox, std::get<0>(expected).value(), values.col(i));
+        EXPECT_PRED2(MatricesApprox,
+                     std::get<1>(expected),
+                     Eigen::Map<RowMajor36>{J_pose.data() + 18 * i});
+        EXPECT_PRED2(MatricesApprox,
+                     std::get<2>(expected),
+                     Eigen::Map<RowMajor33>{J_point.data() + 9 * i});
+
+        // The scalars between poses are untouched
+        for (int k = 7; k < PoseStride; ++k) {
+            EXPECT_EQ(7.0, poses[i * PoseStride + k]);
+        }
+    }
+}
+
+TEST(LayoutViewTest, stridedOutputPoses) {
+    std::vector<double> poses(N * PoseStride, 7.0);
+    std::vector<wave::RigidTransformQd> T1, T2;
+    for (int i = 0; i < N; ++i) {
+        T1.push_back(wave::RigidTransformQd::Random());
+        T2.push_back(wave::RigidTransformQd::Random());
+    }
+
+    const wave::StridedView<PoseView> view{poses.data(), N, PoseStride};
+    for (int i = 0; i < N; ++i) {
+        view[i] = T1[i] * T2[i];
+    }
+    for (int i = 0; i < N; ++i) {
+        EXPECT_APPROX(wave::RigidTransformQd{T1[i] * T2[i]},
+                      wave::RigidTransformQd{view[i]});
+        EXPECT_EQ(7.0, poses[i * PoseStride + 7]);
+    }
+}
+
+TEST(LayoutViewTest, framed) {
+    using RotationView_AB = wave::RotationOrderedQMapFd<WXYZ, FrameA, FrameB>;
+    using PoseView_BC = wave::Framed<PoseView, FrameB, FrameC>;
+    using PointView_CCD = wave::Framed<PointView, FrameC, FrameC, FrameD>;
+
+    std::vector<double> rotations(4 * N), poses(PoseStride * N);
+    Eigen::Matrix3Xd points = Eigen::Matrix3Xd::Random(3, N);
+    for (int i = 0; i < N; ++i) {
+        storeWXYZ(wave::RotationQd::Random().value(), rotations.data() + 4 * i);
+        storeTQ(wave::RigidTransformQd::Random(), poses.data() + PoseStride * i);
+    }
+    const wave::StridedView<RotationView_AB> R_view{rotations.data(), N};
+    const wave::StridedView<PoseView_BC> T_view{poses.data(), N, PoseStride};
+    const wave::StridedView<PointView_CCD> p_view{points.data(), N};
+
+    const auto res = wave::evalBatchWithJacobians(
+      [](const RotationView_AB &R, const PoseView_BC &T, const PointView_CCD &p) {
+          return R * (T * p);
+      },
+      R_view,
+      T_view,
+      p_view);
+    for (int i = 0; i < N; ++i) {
+        const auto R = R_view[i];
+        const auto T = T_view[i];
+        const auto p = p_view[i];
+        const auto expected = eval(R * (T * p));
+        EXPECT_APPROX(expected, std::get<0>(res)[i]);
+    }
+}
@@ -154,6 +154,21 @@ TYPED_TEST(TransformTest, logMapJacobian) {
     CHECK_JACOBIANS(true, log(r1), r1);
 }
 
+TYPED_TEST(TransformTest, logMapJacobianSmallAngle) {
+    // Angles where the closed forms of the log coefficients lose digits to cancellation
+    for (const auto angle : {1e-3, 1e-4, 1e-5, 1e-6}) {
+        auto rel = TestFixture::RelLeafAAB::Random();
+        rel.value().template head<3>().normalize();
+        rel.value().template head<3>() *= angle;
+        const auto r1 = typename TestFixture::LeafAB{
+          wave::frame_cast<typename TestFixture::FrameA, typename TestFixture::FrameB>(
+            exp(rel))};
+        SCOPED_TRACE(angle);
+        EXPECT_APPROX(rel, typename TestFixture::RelLeafAAB{log(r1)});
+        CHECK_JACOBIANS(true, log(r1), r1);
+    }
+}
+
 
 TYPED_TEST(TransformTest, expMapJacobian) {
     auto rel = TestFixture::RelLeafAAB::Random();
@@ -0,0 +1,159 @@
+/**
+ * @file
+ *
+ * Tests for transforming and rotating point clouds as a whole, comparing against
+ * point-by-point evaluation
+ */
+
+#include "wave/geometry/geometry.hpp"
+#include "test.hpp"
+
+namespace {
+
+const int N = 37;  // Odd, so the last point is not part of a pair
+
+using StridedMap = Eigen::Map<Eigen::Matrix3Xd, 0, Eigen::OuterStride<>>;
+
+}  // namespace
+
+TEST(PointCloudTest, getSetRoundTrip) {
+    wave::PointCloudd cloud{N};
+    for (int i = 0; i < N; ++i) {
+        const auto p = wave::Translationd::Random();
+        cloud.set(i, p);
+        EXPECT_EQ(p.value(), cloud.get(i).value());
+    }
+    EXPECT_EQ(N, cloud.size());
+}
+
+TEST(PointCloudTest, transform) {
+    const wave::PointCloudd cloud{Eigen::Matrix3Xd::Random(3, N)};
+    const auto T_q = wave::RigidTransformQd::Random();
+    const wave::RigidTransformMd T_m{T_q};
+
+    const wave::PointCloudd res_q{T_q * cloud};
+    const wave::PointCloudd res_m{T_m * cloud};
+    ASSERT_EQ(N, res_q.size());
+    for (int i = 0; i < N; ++i) {
+        const wave::Translationd expected{T_q * cloud.get(i)};
+        EXPECT_APPROX(expected, res_q.get(i));
+        EXPECT_APPROX(expected, res_m.get(i));
+    }
+}
+
+TEST(PointCloudTest, rotate) {
+    const wave::PointCloudd cloud{Eigen::Matrix3Xd::Random(3, N)};
+    const auto R = wave::RotationQd::Random();
+
+    const wave::PointCloudd res{R * cloud};
+    const wave::PointCloudd res_inv{inverse(R) * cloud};
+    for (int i = 0; i < N; ++i) {
+        EXPECT_APPROX(wave::Translationd{R * cloud.get(i)}, res.get(i));
+        EXPECT_APPROX(wave::Translationd{inverse(R) * cloud.get(i)}, res_inv.get(i));
+    }
+}
+
+TEST(PointCloudTest, stridedMap) {
+    // Points with a fourth, unused coefficient, as in many point cloud formats
+    Eigen::Matrix4Xd data = Eigen::Matrix4Xd::Random(4, N);
+    data.row(3).setConstant(7.0);
+    const wave::PointCloudMapd cloud{
+      StridedMap{data.data(), 3, N, Eigen::OuterStride<>{4}}};
+    const auto T = wave::RigidTransformQd::Random();
+
+    const wave::PointCloudd res{T * cloud};
+    for (int i = 0; i < N; ++i) {
+        const Eigen::Vector3d p = data.col(i).head<3>();
+        EXPECT_APPROX(wave::Translationd{T * wave::Translationd{p}}, res.get(i));
+    }
+
+    // Transform in place, through the map
+    wave::PointCloudMapd mapped{StridedMap{data.data(), 3, N, Eigen::OuterStride<>{4}}};
+    wave::transformPointsTo(T, mapped, mapped);
+    EXPECT_PRED2(MatricesApprox, res.value(), data.topRows<3>());
+    EXPECT_TRUE((data.row(3).array() == 7.0).all());
+}
+
+TEST(PointCloudTest, transformPointsTo) {
+    const wave::PointCloudd cloud{Eigen::Matrix3Xd::Random(3, N)};
+    const auto T = wave::RigidTransformQd::Random();
+    const wave::PointCloudd expected{T * cloud};
+
+    // To a separate cloud, which is resized
+    wave::PointCloudd out;
+    wave::transformPointsTo(T, cloud, out);
+    EXPECT_PRED2(MatricesApprox, expected.value(), out.value());
+
+    // In place
+    wave::PointCloudd in_place = cloud;
+    wave::transformPointsTo(T, in_place, in_place);
+    EXPECT_PRED2(MatricesApprox, expected.value(), in_place.value());
+
+    // From an expression
+    wave::transformPointsTo(inverse(T), in_place, in_place);
+    EXPECT_PRED2(MatricesApprox, cloud.value(), in_place.value());
+}
+
+TEST(PointCloudTest, transformJacobians) {
+    const wave::PointCloudd cloud{Eigen::Matrix3Xd::Random(3, N)};
+    const auto T = wave::RigidTransformQd::Random();
+
+    wave::PointCloudd out;
+    wave::AlignedVector<Eigen::Matrix<double, 3, 6>> jacobians;
+    wave::transformPointsTo(T, cloud, out, jacobians);
+    ASSERT_EQ(N, static_cast<int>(jacobians.size()));
+
+    for (int i = 0; i < N; ++i) {
+        const auto p = cloud.get(i);
+        const auto &expr = T * p;
+        const auto expected = expr.evalWithJacobians(T);
+        EXPECT_APPROX(std::get<0>(expected), out.get(i));
+        EXPECT_PRED2(MatricesApprox, std::get<1>(expected), jacobians[i]);
+    }
+}
+
+TEST(PointCloudTest, rotateJacobians) {
+    const wave::PointCloudd cloud{Eigen::Matrix3Xd::Random(3, N)};
+    const auto R = wave::RotationMd::Random();
+
+    wave::PointCloudd out{N};
+    wave::AlignedVector<Eigen::Matrix3d> jacobians;
+    wave::rotatePointsTo(R, cloud, out, jacobians);
+    ASSERT_EQ(N, static_cast<int>(jacobians.size()));
+
+    for (int i = 0; i < N; ++i) {
+        const auto p = cloud.get(i);
+        const auto &expr = R * p;
+        const auto expected = expr.evalWithJacobians(R);
+        EXPECT_APPROX(std::get<0>(expected), out.get(i));
+        EXPECT_PRED2(MatricesApprox, std::get<1>(expected), jacobians[i]);
+    }
+}
+
+TEST(PointCloudTest, framed) {
+    using Cloud_BBC = wave::PointCloudFd<FrameB, FrameB, FrameC>;
+    using Cloud_AAC = wave::PointCloudFd<FrameA, FrameA, FrameC>;
+    using Cloud_DBC = wave::PointCloudFd<FrameD, FrameB, FrameC>;
+
+    const Cloud_BBC cloud{Eigen::Matrix3Xd::Random(3, N)};
+    const auto T = wave::RigidTransformQFd<FrameA, FrameB>::Random();
+    const auto R = wave::RotationMFd<FrameD, FrameB>::Random();
+
+    const auto res = eval(T * cloud);
+    static_assert(std::is_same<Cloud_AAC, wave::tmp::remove_cr_t<decltype(res)>>{}, "");
+    for (int i = 0; i < N; ++i) {
+        const wave::TranslationFd<FrameA, FrameA, FrameC> expected = T * cloud.get(i);
+        EXPECT_APPROX(expected, res.get(i));
+    }
+
+    Cloud_AAC out;
+    wave::transformPointsTo(T, cloud, out);
+    EXPECT_PRED2(MatricesApprox, res.value(), out.value());
+
+    Cloud_DBC rotated;
+    wave::rotatePointsTo(R, cloud, rotated);
+    for (int i = 0; i < N; ++i) {
+        const wave::TranslationFd<FrameD, FrameB, FrameC> expected = R * cloud.get(i);
+        EXPECT_APPROX(expected, rotated.get(i));
+    }
+}
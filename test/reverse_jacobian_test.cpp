@@ -0,0 +1,281 @@
+/**
+ * @file
+ *
+ * Tests for reverse-mode jacobians of expressions with repeated leaves and leaf types,
+ * comparing against the forward-mode JacobianEvaluator
+ */
+
+#include "wave/geometry/geometry.hpp"
+#include "test.hpp"
+
+namespace {
+
+/** Checks the value and both jacobians match those of the forward evaluator */
+template <typename Derived, typename T1, typename T2>
+void checkAgainstForward(const wave::ExpressionBase<Derived> &expr,
+                         const T1 &target1,
+                         const T2 &target2) {
+    const auto expected =
+      wave::internal::evaluateWithJacobians(expr.derived(), target1, target2);
+    const auto actual =
+      wave::internal::evaluateWithAdjointJacobians(expr, target1, target2);
+    EXPECT_APPROX(std::get<0>(expected), std::get<0>(actual));
+    EXPECT_PRED2(MatricesApprox, std::get<1>(expected), std::get<1>(actual));
+    EXPECT_PRED2(MatricesApprox, std::get<2>(expected), std::get<2>(actual));
+}
+
+}  // namespace
+
+TEST(ReverseJacobianTest, repeatedTypes) {
+    const auto R1 = wave::RotationQd::Random();
+    const auto R2 = wave::RotationQd::Random();
+    const auto R3 = wave::RotationQd::Random();
+    const auto expr = log(inverse(R1 * R2) * R3);
+
+    const auto expected = wave::internal::evaluateWithJacobians(expr, R1, R2, R3);
+    const auto actual = expr.evalWithJacobians(R1, R2, R3);
+    EXPECT_APPROX(std::get<0>(expected), std::get<0>(actual));
+    EXPECT_PRED2(MatricesApprox, std::get<1>(expected), std::get<1>(actual));
+    EXPECT_PRED2(MatricesApprox, std::get<2>(expected), std::get<2>(actual));
+    EXPECT_PRED2(MatricesApprox, std::get<3>(expected), std::get<3>(actual));
+}
+
+TEST(ReverseJacobianTest, repeatedLeaf) {
+    const auto R1 = wave::RotationQd::Random();
+    const auto R2 = wave::RotationMd::Random();
+    const auto p = wave::Translationd::Random();
+    checkAgainstForward(R1 * R2 * R1 * p, R1, p);
+    checkAgainstForward(R1 * R2 * R1 * p, R2, R1);
+
+    // The contributions of every occurrence are summed
+    const auto actual = (R1 * R1).evalWithJacobians(R1);
+    const wave::RotationQd R_copy = R1;
+    const auto J_left = (R1 * R_copy).evalWithJacobians(R1);
+    const auto J_right = (R_copy * R1).evalWithJacobians(R1);
+    const Eigen::Matrix3d expected = std::get<1>(J_left) + std::get<1>(J_right);
+    EXPECT_PRED2(MatricesApprox, expected, std::get<1>(actual));
+}
+
+TEST(ReverseJacobianTest, transformsAndPoints) {
+    const auto T1 = wave::RigidTransformQd::Random();
+    const auto T2 = wave::RigidTransformMd::Random();
+    const auto p1 = wave::Translationd::Random();
+    const auto p2 = wave::Translationd::Random();
+    checkAgainstForward(inverse(T1) * T2 * (T1 * p1 + p2), T1, p1);
+    checkAgainstForward(inverse(T1) * T2 * (T1 * p1 + p2), p2, T2);
+    checkAgainstForward(log(inverse(T1) * T2 * T1), T1, T2);
+}
+
+TEST(ReverseJacobianTest, absentTarget) {
+    const auto R1 = wave::RotationQd::Random();
+    const auto R2 = wave::RotationQd::Random();
+    const auto R3 = wave::RotationQd::Random();
+    const auto p = wave::Translationd::Random();
+
+    // R3 has the type of a leaf, but is not in the expression
+    const auto res = (R1 * R2 * R1).evalWithJacobians(R3, p);
+    EXPECT_TRUE(std::get<1>(res).isZero());
+    EXPECT_TRUE(std::get<2>(res).isZero());
+}
+
+TEST(ReverseJacobianTest, framed) {
+    const auto R1 = wave::RotationQFd<FrameA, FrameB>::Random();
+    const auto R2 = wave::RotationQFd<FrameA, FrameB>::Random();
+    const auto p = wave::TranslationFd<FrameB, FrameB, FrameC>::Random();
+    checkAgainstForward(R1 * inverse(R2) * R1 * p, R1, R2);
+    checkAgainstForward(R1 * inverse(R2) * R1 * p, p, R1);
+}
+
+TEST(ReverseJacobianTest, modeChosenByCost) {
+    using wave::internal::use_reverse_jacobians;
+    using Q = wave::RotationQd;
+    using M = wave::RotationMd;
+    using T = wave::Translationd;
+    using TQ = wave::RigidTransformQd;
+    using TM = wave::RigidTransformMd;
+
+    // One target and one node: forward mode does no products
+    static_assert(!use_reverse_jacobians<wave::Rotate<Q, T>, Q>{}, "");
+    // A small output and several targets deep in the tree: reverse mode is cheaper
+    using V = wave::RelativeRotationd;
+    using LogChain = wave::LogMap<
+      wave::NoFrame,
+      wave::Compose<wave::Compose<Q, M>, wave::ExpMap<V>>>;
+    static_assert(use_reverse_jacobians<LogChain, Q, M, V>{}, "");
+    static_assert(!use_reverse_jacobians<LogChain, V>{}, "");
+    // Forward mode multiplies each target's jacobians in the cheapest order, so it wins
+    // for short chains
+    using ChainPoint = wave::Transform<wave::Compose<TQ, TM>, T>;
+    static_assert(!use_reverse_jacobians<ChainPoint, TQ, TM, T>{}, "");
+
+    // Whichever mode is chosen, the results match the forward evaluator
+    const auto T1 = TQ::Random();
+    const auto T2 = TM::Random();
+    const auto p = T::Random();
+    const auto expected = wave::internal::evaluateWithJacobians(T1 * T2 * p, T1, T2, p);
+    const auto actual = (T1 * T2 * p).evalWithJacobians(T1, T2, p);
+    EXPECT_APPROX(std::get<0>(expected), std::get<0>(actual));
+    EXPECT_PRED2(MatricesApprox, std::get<1>(expected), std::get<1>(actual));
+    EXPECT_PRED2(MatricesApprox, std::get<2>(expected), std::get<2>(actual));
+    EXPECT_PRED2(MatricesApprox, std::get<3>(expected), std::get<3>(actual));
+    EXPECT_PRED2(MatricesApprox, std::get<3>(expected), (T1 * T2 * p).jacobian(p));
+}
+
+TEST(ReverseJacobianTest, constantLeaves) {
+    const auto R1 = wave::RotationQd::Random();
+    const auto R2 = wave::RotationMd::Random();
+    const auto R3 = wave::RotationAd::Random();
+    const auto p = wave::Translationd::Random();
+    const auto expr = R1 * (R2 * inverse(R3)) * p;
+    const auto all = expr.evalWithJacobians();
+
+    // Hold R2 and R3, a whole subtree, constant
+    const auto res = expr.evalWithJacobians(std::bitset<4>{"0110"});
+    EXPECT_APPROX(std::get<0>(all), std::get<0>(res));
+    EXPECT_APPROX(std::get<1>(all), std::get<1>(res));
+    EXPECT_TRUE(std::get<2>(res).isZero());
+    EXPECT_TRUE(std::get<3>(res).isZero());
+    EXPECT_APPROX(std::get<4>(all), std::get<4>(res));
+
+    // Hold only one leaf of the subtree constant
+    const auto res2 = expr.evalWithJacobians(std::bitset<4>{"0100"});
+    EXPECT_APPROX(std::get<1>(all), std::get<1>(res2));
+    EXPECT_APPROX(std::get<2>(all), std::get<2>(res2));
+    EXPECT_TRUE(std::get<3>(res2).isZero());
+    EXPECT_APPROX(std::get<4>(all), std::get<4>(res2));
+
+    // With all leaves constant, only the value is found
+    const auto res3 = expr.evalWithJacobians(std::bitset<4>{}.set());
+    EXPECT_APPROX(std::get<0>(all), std::get<0>(res3));
+    EXPECT_TRUE(std::get<1>(res3).isZero());
+    EXPECT_TRUE(std::get<4>(res3).isZero());
+}
+
+TEST(ReverseJacobianTest, vectorJacobianProducts) {
+    const auto T1 = wave::RigidTransformQd::Random();
+    const auto R2 = wave::RotationMd::Random();
+    const auto p = wave::Translationd::Random();
+    const auto C = constant(wave::RotationQd::Random());
+    const auto expr = T1 * (R2 * (C * p));
+    const auto all = expr.evalWithJacobians();
+
+    // A row vector adjoint gives gradients
+    const Eigen::RowVector3d r = Eigen::RowVector3d::Random();
+    const auto vjp = expr.evalWithVJP(r);
+    static_assert(std::is_same<wave::tmp::remove_cr_t<decltype(std::get<1>(vjp))>,
+                               Eigen::Matrix<double, 1, 6>>{},
+                  "");
+    EXPECT_APPROX(std::get<0>(all), std::get<0>(vjp));
+    EXPECT_APPROX(r * std::get<1>(all), std::get<1>(vjp));
+    EXPECT_APPROX(r * std::get<2>(all), std::get<2>(vjp));
+    EXPECT_APPROX(r * std::get<3>(all), std::get<3>(vjp));
+
+    // A taller adjoint
+    const Eigen::Matrix<double, 2, 3> A = Eigen::Matrix<double, 2, 3>::Random();
+    const auto vjp2 = expr.evalWithVJP(A);
+    EXPECT_APPROX(A * std::get<1>(all), std::get<1>(vjp2));
+    EXPECT_APPROX(A * std::get<3>(all), std::get<3>(vjp2));
+}
+
+TEST(ReverseJacobianTest, jacobianVectorProduct) {
+    const auto T1 = wave::RigidTransformQd::Random();
+    const auto R2 = wave::RotationMd::Random();
+    const auto p = wave::Translationd::Random();
+    const auto C = constant(wave::RotationQd::Random());
+    const auto expr = T1 * (R2 * (C * p));
+    const auto all = expr.evalWithJacobians();
+
+    const Eigen::Matrix<double, 6, 1> dT = Eigen::Matrix<double, 6, 1>::Random();
+    const Eigen::Vector3d dR = Eigen::Vector3d::Random();
+    const Eigen::Vector3d dp = Eigen::Vector3d::Random();
+    const auto jvp = expr.evalWithJVP(dT, dR, dp);
+    EXPECT_APPROX(std::get<0>(all), std::get<0>(jvp));
+    EXPECT_APPROX(Eigen::Vector3d{std::get<1>(all) * dT + std::get<2>(all) * dR +
+                                  std::get<3>(all) * dp},
+                  std::get<1>(jvp));
+
+    // Several tangents at once; a zero tangent leaves out a leaf
+    Eigen::Matrix<double, 6, 2> dT2;
+    dT2 << dT, Eigen::Matrix<double, 6, 1>::Zero();
+    const Eigen::Matrix<double, 3, 2> dR2 = Eigen::Matrix<double, 3, 2>::Random();
+    const Eigen::Matrix<double, 3, 2> dp2 = Eigen::Matrix<double, 3, 2>::Zero();
+    const auto jvp2 = expr.evalWithJVP(dT2, dR2, dp2);
+    const Eigen::Matrix<double, 3, 2> expected =
+      std::get<1>(all) * dT2 + std::get<2>(all) * dR2;
+    EXPECT_APPROX(expected, std::get<1>(jvp2));
+}
+
+TEST(ReverseJacobianTest, jacobiansIntoDestinations) {
+    const auto T1 = wave::RigidTransformQd::Random();
+    const auto R2 = wave::RotationMd::Random();
+    const auto p = wave::Translationd::Random();
+    const auto C = constant(wave::RotationQd::Random());
+    const auto expr = T1 * (R2 * (C * p));
+    const auto all = expr.evalWithJacobians();
+
+    // Blocks of a larger row-major matrix, through a block expression and an Eigen::Ref
+    Eigen::Matrix<double, 3, 12, Eigen::RowMajor> J;
+    Eigen::Ref<Eigen::Matrix<double, 3, 3, Eigen::RowMajor>> J_p = J.rightCols<3>();
+    const auto value =
+      expr.evalWithJacobiansInto(J.leftCols<6>(), J.middleCols<3>(6), J_p);
+    EXPECT_APPROX(std::get<0>(all), value);
+    EXPECT_APPROX(std::get<1>(all), J.leftCols<6>());
+    EXPECT_APPROX(std::get<2>(all), J.middleCols<3>(6));
+    EXPECT_APPROX(std::get<3>(all), J.rightCols<3>());
+
+    // Raw row-major arrays, with null pointers for jacobians which are not wanted
+    double J_T1[18], J_p_raw[9];
+    double *jacobians[] = {J_T1, nullptr, J_p_raw};
+    const auto value2 = expr.evalWithJacobiansInto(jacobians);
+    EXPECT_APPROX(std::get<0>(all), value2);
+    using RowMajor36 = Eigen::Matrix<double, 3, 6, Eigen::RowMajor>;
+    using RowMajor33 = Eigen::Matrix<double, 3, 3, Eigen::RowMajor>;
+    EXPECT_APPROX(std::get<1>(all), Eigen::Map<RowMajor36>{J_T1});
+    EXPECT_APPROX(std::get<3>(all), Eigen::Map<RowMajor33>{J_p_raw});
+
+    // With no jacobians at all, only the value is found
+    const auto value3 = expr.evalWithJacobiansInto(static_cast<double **>(nullptr));
+    EXPECT_APPROX(std::get<0>(all), value3);
+}
+
+TEST(ReverseJacobianTest, intermediatesKeptForJacobians) {
+    // Exp and log nodes keep the angle they find, and their jacobians reuse it
+    const auto R = wave::RotationMd::Random();
+    const auto T = wave::RigidTransformQd::Random();
+    const auto w = wave::Twistd::Random();
+    using LogR = wave::tmp::remove_cr_t<decltype(log(R))>;
+    using LogT = wave::tmp::remove_cr_t<decltype(log(T))>;
+    using ExpW = wave::tmp::remove_cr_t<decltype(exp(w))>;
+    static_assert(!std::is_void<wave::internal::Evaluator<LogR>::Aux>{}, "");
+    static_assert(!std::is_void<wave::internal::Evaluator<LogT>::Aux>{}, "");
+    static_assert(!std::is_void<wave::internal::Evaluator<ExpW>::Aux>{}, "");
+    checkAgainstForward(log(T * exp(w)), T, w);
+    checkAgainstForward(log(R * R), R, R);
+
+    // The jacobian of a twist with no rotation is the limit of those of small rotations
+    auto w0 = wave::Twistd{};
+    w0.value() << 0, 0, 0, 1, 2, 3;
+    auto w1 = w0;
+    w1.value().head<3>().setConstant(1e-9);
+    const auto J0 = std::get<1>(exp(w0).evalWithJacobians());
+    const auto J1 = std::get<1>(exp(w1).evalWithJacobians());
+    EXPECT_TRUE(J0.allFinite());
+    EXPECT_TRUE(J1.isApprox(J0, 1e-8));
+
+    // It differs from the limit by O(angle) across the range where the closed forms of
+    // its coefficients lose digits
+    const Eigen::Vector3d axis = Eigen::Vector3d{1, -2, 3}.normalized();
+    for (const double angle : {1e-3, 1e-4, 1e-5, 1e-6, 1e-7, 3e-8, 1e-8}) {
+        auto w2 = w0;
+        w2.value().head<3>() = angle * axis;
+        const auto J2 = std::get<1>(exp(w2).evalWithJacobians());
+        EXPECT_LT((J2 - J0).cwiseAbs().maxCoeff(), 5 * angle) << angle;
+
+        // The exp and log jacobians, whose SO(3) parts also switch to Taylor series,
+        // stay inverses
+        const auto J_log = std::get<1>(log(exp(w2).eval()).evalWithJacobians());
+        using Mat6 = Eigen::Matrix<double, 6, 6>;
+        EXPECT_PRED3(MatricesApproxPrec, Mat6::Identity(), Mat6{J_log * J2}, 1e-13)
+          << angle;
+    }
+}
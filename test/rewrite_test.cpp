@@ -0,0 +1,187 @@
+/**
+ * @file
+ *
+ * Tests for rewrite rules applied to prepared expressions, checking the rewritten types
+ * and comparing values and jacobians against numerical results of the original
+ */
+
+#include "wave/geometry/geometry.hpp"
+#include "test.hpp"
+
+namespace {
+
+using wave::internal::prepared_t;
+using wave::internal::RewriteNone;
+using wave::internal::RewriteAll;
+
+using M = wave::RotationMd;
+using Q = wave::RotationQd;
+using T = wave::Translationd;
+using V = wave::RelativeRotationd;
+
+// The rules found for some expressions
+static_assert(std::is_same<prepared_t<wave::Compose<wave::Inverse<M>, M>>,
+                           wave::InverseCompose<M, M>>{},
+              "");
+static_assert(
+  std::is_same<prepared_t<wave::Compose<wave::Inverse<Q>, wave::Inverse<Q>>>,
+               wave::Inverse<wave::ComposeFlipped<Q, Q>>>{},
+  "");
+static_assert(std::is_same<prepared_t<wave::Rotate<wave::Inverse<wave::Inverse<Q>>, T>>,
+                           wave::Rotate<Q, T>>{},
+              "");
+static_assert(
+  std::is_same<prepared_t<wave::Compose<wave::ExpMap<wave::LogMap<wave::NoFrame, M>>, M>>,
+               wave::Compose<M, M>>{},
+  "");
+// The log map of an exp map is kept, since it wraps angles above pi
+static_assert(
+  std::is_same<prepared_t<wave::Sum<wave::LogMap<wave::NoFrame, wave::ExpMap<V>>, V>>,
+               wave::Sum<wave::LogMap<wave::NoFrame, wave::ExpMap<V>>, V>>{},
+  "");
+
+// An explicit conversion of an exp map to a quaternion is evaluated directly
+static_assert(std::is_same<prepared_t<wave::Convert<Q, wave::ExpMap<V>>>,
+                           wave::ExpMapTo<Q, V>>{},
+              "");
+
+// Rules apply inside larger trees, as in an IMU preintegration residual
+static_assert(
+  std::is_same<
+    prepared_t<wave::LogMap<wave::NoFrame,
+                            wave::Compose<wave::Inverse<wave::Compose<M, M>>, M>>>,
+    wave::LogMap<wave::NoFrame, wave::InverseCompose<wave::Compose<M, M>, M>>>{},
+  "");
+
+// Rotation matrices are inverted for free, so InverseCompose is preferred
+static_assert(std::is_same<prepared_t<wave::Compose<wave::Inverse<M>, wave::Inverse<M>>>,
+                           wave::InverseCompose<M, wave::Inverse<M>>>{},
+              "");
+
+// A rule is not used if it would change the output type, here its frames
+using M_AA = wave::RotationMFd<FrameA, FrameA>;
+using M_AB = wave::RotationMFd<FrameA, FrameB>;
+using M_AC = wave::RotationMFd<FrameA, FrameC>;
+using ComposeExpLogAA = wave::Compose<wave::ExpMap<wave::LogMap<FrameB, M_AA>>, M_AC>;
+using ComposeExpLogAB = wave::Compose<wave::ExpMap<wave::LogMap<FrameB, M_AB>>, M_AC>;
+static_assert(std::is_same<prepared_t<ComposeExpLogAA>, wave::Compose<M_AA, M_AC>>{}, "");
+static_assert(std::is_same<prepared_t<ComposeExpLogAB>, ComposeExpLogAB>{}, "");
+
+// Identity leaves are removed only when no jacobians are needed
+using RotateByIdentity = wave::Rotate<wave::Compose<wave::Identity<M>, M>, T>;
+static_assert(std::is_same<prepared_t<RotateByIdentity>, RotateByIdentity>{}, "");
+static_assert(
+  std::is_same<prepared_t<RotateByIdentity, RewriteAll>, wave::Rotate<M, T>>{}, "");
+// Without jacobians, products of matrices applied to a vector are applied right to left,
+// but quaternion products are kept
+using RT = wave::RigidTransformMd;
+using RotateByProduct = wave::Rotate<wave::Compose<wave::Compose<M, M>, M>, T>;
+static_assert(std::is_same<prepared_t<RotateByProduct, RewriteAll>,
+                           wave::Rotate<M, wave::Rotate<M, wave::Rotate<M, T>>>>{},
+              "");
+static_assert(std::is_same<prepared_t<RotateByProduct>, RotateByProduct>{}, "");
+static_assert(
+  std::is_same<prepared_t<wave::Transform<wave::Compose<RT, RT>, T>, RewriteAll>,
+               wave::Transform<RT, wave::Transform<RT, T>>>{},
+  "");
+static_assert(std::is_same<prepared_t<wave::Rotate<wave::Compose<Q, Q>, T>, RewriteAll>,
+                           wave::Rotate<wave::Compose<Q, Q>, T>>{},
+              "");
+static_assert(std::is_same<prepared_t<wave::Compose<wave::Inverse<M>, M>, RewriteNone>,
+                           wave::Compose<wave::Inverse<M>, M>>{},
+              "");
+
+}  // namespace
+
+TEST(RewriteTest, inverseCompose) {
+    const auto R1 = M::Random();
+    const auto R2 = M::Random();
+    const auto R3 = M::Random();
+
+    EXPECT_APPROX(M{R1.value().transpose() * R2.value()}, M{inverse(R1) * R2});
+    CHECK_JACOBIANS(false, inverse(R1) * R2, R1, R2);
+    CHECK_JACOBIANS(false, log(inverse(R1 * R2) * R3), R1, R2, R3);
+    CHECK_JACOBIANS(false, inverse(R1) * R2 * T::Random(), R1, R2);
+}
+
+TEST(RewriteTest, inverseComposeRvalue) {
+    const auto R1 = M::Random();
+    const auto R2 = M::Random();
+    const auto expected = M{R1.value().transpose() * R2.value()};
+
+    EXPECT_APPROX(expected, M{inverse(M{R1}) * R2});
+    EXPECT_APPROX(expected, M{inverse(R1) * M{R2}});
+}
+
+TEST(RewriteTest, productOfInverses) {
+    const auto q1 = Q::Random();
+    const auto q2 = Q::Random();
+    const auto p = T::Random();
+
+    EXPECT_APPROX(Q{q1.value().inverse() * q2.value().inverse()},
+                  Q{inverse(q1) * inverse(q2)});
+    CHECK_JACOBIANS(false, inverse(q1) * inverse(q2) * p, q1, q2, p);
+}
+
+TEST(RewriteTest, doubleInverse) {
+    const auto R1 = Q::Random();
+    const auto R2 = M::Random();
+    const auto p = T::Random();
+
+    EXPECT_APPROX(T{R1 * p}, T{inverse(inverse(R1)) * p});
+    CHECK_JACOBIANS(true, inverse(inverse(R1)) * R2 * p, R1, R2, p);
+}
+
+TEST(RewriteTest, logOfExpWrapsAngle) {
+    const auto w = V{4, 0, 0};
+    const auto z = V{0, 0, 0};
+    const auto expected = V{log(exp(w))};
+
+    EXPECT_LT(expected.value().norm(), M_PI);
+    EXPECT_APPROX(expected, V{log(exp(w)) + z});
+    CHECK_JACOBIANS(false, log(exp(w)) + z, w, z);
+}
+
+TEST(RewriteTest, expOfLog) {
+    const auto R1 = M::Random();
+    const auto R2 = M::Random();
+
+    EXPECT_APPROX(M{R1 * R2}, M{exp(log(R1)) * R2});
+    CHECK_JACOBIANS(false, exp(log(R1)) * R2, R1, R2);
+}
+
+TEST(RewriteTest, reassociatedChain) {
+    const auto R1 = M::Random();
+    const auto R2 = M::Random();
+    const auto R3 = M::Random();
+    const auto T1 = RT::Random();
+    const auto T2 = RT::Random();
+    const auto p = T::Random();
+
+    EXPECT_APPROX(T{M{R1 * R2 * R3} * p}, T{R1 * R2 * R3 * p});
+    EXPECT_APPROX(T{RT{T1 * T2} * p}, T{T1 * T2 * p});
+    CHECK_JACOBIANS(false, R1 * inverse(R2) * R3 * p, R1, R2, R3, p);
+    CHECK_JACOBIANS(false, T1 * inverse(T2) * p, T1, T2, p);
+}
+
+TEST(RewriteTest, identityAndZero) {
+    const auto R = Q::Random();
+    const auto p = T::Random();
+
+    EXPECT_APPROX(T{R * p}, T{(wave::Identity<Q>{} * R) * p});
+    EXPECT_APPROX(T{R * p}, T{(R * inverse(wave::Identity<Q>{})) * p});
+    EXPECT_APPROX(p, T{wave::Identity<Q>{} * p + wave::Zero<T>{}});
+}
+
+TEST(RewriteTest, framed) {
+    using R_AB = wave::RotationMFd<FrameA, FrameB>;
+    using R_AC = wave::RotationMFd<FrameA, FrameC>;
+    const auto R1 = R_AB::Random();
+    const auto R2 = R_AC::Random();
+    const auto p = wave::TranslationFd<FrameC, FrameC, FrameD>::Random();
+
+    using R_BC = wave::RotationMFd<FrameB, FrameC>;
+    const R_BC expected{R1.value().transpose() * R2.value()};
+    EXPECT_APPROX(expected, R_BC{inverse(R1) * R2});
+    CHECK_JACOBIANS(true, inverse(R1) * R2 * p, R1, R2, p);
+}
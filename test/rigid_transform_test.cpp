@@ -31,6 +31,7 @@ class RigidTransformTest : public testing::Test {
     using TransformQ = wave::CompactRigidTransform<Eigen::Matrix<Scalar, 7, 1>>;
     using RelativeRotation = wave::RelativeRotation<Vector3>;
     using Translation = wave::Translation<Vector3>;
+    using Twist = wave::Twist<Eigen::Matrix<Scalar, 6, 1>>;
 
     // Convenience framed types
     template <typename T, typename... F>
@@ -44,6 +45,8 @@ class RigidTransformTest : public testing::Test {
     using RelAAB = Framed<RelativeRotation, FrameA, FrameA, FrameB>;
     using PointAAC = Framed<Translation, FrameA, FrameA, FrameC>;
     using PointBBC = Framed<Translation, FrameB, FrameB, FrameC>;
+    using TwistAAC = Framed<Twist, FrameA, FrameA, FrameC>;
+    using TwistBAC = Framed<Twist, FrameB, FrameA, FrameC>;
     using TransformM_BC = Framed<TransformM, FrameB, FrameC>;
     using TransformQ_BC = Framed<TransformQ, FrameB, FrameC>;
 
@@ -171,3 +174,64 @@ TYPED_TEST(RigidTransformTest, transformVector) {
 
     CHECK_JACOBIANS(true, rt * p1, rt, p1);
 }
+
+TYPED_TEST(RigidTransformTest, adjointAction) {
+    using Scalar = typename TestFixture::Scalar;
+    using Matrix3 = typename TestFixture::Matrix3;
+    const auto rt = TestFixture::LeafBA::Random();
+    const auto xi = TestFixture::TwistAAC::Random();
+    const auto result = typename TestFixture::TwistBAC{adjoint(rt) * xi};
+
+    const Matrix3 R{rt.rotation().value()};
+    Eigen::Matrix<Scalar, 6, 6> adj;
+    adj << R, Matrix3::Zero(), wave::crossMatrix(rt.translation().value()) * R, R;
+    EXPECT_APPROX((adj * xi.value()).eval(), result.value());
+
+    CHECK_JACOBIANS(true, adjoint(rt) * xi, rt, xi);
+}
+
+TYPED_TEST(RigidTransformTest, adjointActionOnZero) {
+    const auto rt = TestFixture::LeafBA::Random();
+    const auto xi = wave::Zero<typename TestFixture::TwistAAC>{};
+    const auto result = typename TestFixture::TwistBAC{adjoint(rt) * xi};
+    EXPECT_TRUE(result.value().isZero());
+
+    // The jacobian wrt the transform is zero, and wrt the twist is the adjoint
+    using Scalar = typename TestFixture::Scalar;
+    using Matrix3 = typename TestFixture::Matrix3;
+    const Matrix3 R{rt.rotation().value()};
+    Eigen::Matrix<Scalar, 6, 6> adj;
+    adj << R, Matrix3::Zero(), wave::crossMatrix(rt.translation().value()) * R, R;
+    const auto res = (adjoint(rt) * xi).evalWithJacobians();
+    EXPECT_TRUE(std::get<1>(res).isZero());
+    EXPECT_APPROX(adj, std::get<2>(res));
+}
+
+TEST(RigidTransformMiscTest, structuredJacobians) {
+    // The jacobians of Compose and Inverse keep their structure in their type, so
+    // their products are found block by block
+    using Lower = wave::BlockLowerTriangular<double, 3>;
+    using Adjoint = wave::AdjointMatrix<double>;
+    const auto T1 = wave::RigidTransformQd::Random();
+    const auto T2 = wave::RigidTransformMd::Random();
+    const auto T3 = wave::RigidTransformQd::Random();
+    const auto p = wave::Translationd::Random();
+
+    using wave::internal::expr;
+    using ComposeJacobian = decltype(wave::internal::rightJacobianImpl(
+      expr<wave::Compose>{}, T1, T1, T2));
+    using InverseJacobian =
+      decltype(wave::internal::jacobianImpl(expr<wave::Inverse>{}, T1, T1));
+    static_assert(std::is_same<ComposeJacobian, Adjoint>{}, "");
+    static_assert(std::is_same<InverseJacobian, Lower>{}, "");
+
+    // A jacobian wrt a transform which does not change the result is a ZeroMatrix
+    using ZeroTwist = wave::Zero<wave::Twistd>;
+    using AdjointOfZeroJacobian = decltype(wave::internal::leftJacobianImpl(
+      expr<wave::AdjointAction>{}, ZeroTwist{}, T1, ZeroTwist{}));
+    static_assert(
+      std::is_same<AdjointOfZeroJacobian, wave::ZeroMatrix<double, 6, 6>>{}, "");
+
+    CHECK_JACOBIANS(true, inverse(T1 * inverse(T2)) * p, T1, T2, p);
+    CHECK_JACOBIANS(false, T1 * (T2 * (T3 * p)), T1, T2, T3, p);
+}
@@ -121,6 +121,28 @@ TYPED_TEST(RotationTest, rotateVector) {
     CHECK_JACOBIANS(true, r1 * p1, r1, p1);
 }
 
+TYPED_TEST(RotationTest, rotateZeroVector) {
+    const auto r1 = TestFixture::LeafBA::Random();
+    const auto r2 = TestFixture::LeafAB::Random();
+    const auto z = wave::Zero<typename TestFixture::PointAAB>{};
+    const auto p2 = typename TestFixture::PointBAB{r1 * z};
+    EXPECT_TRUE(p2.value().isZero());
+
+    // The jacobians wrt the rotations are zero, found from a ZeroMatrix with no
+    // arithmetic
+    using Matrix3 = typename TestFixture::Matrix3;
+    const Matrix3 R1{r1.value()};
+    const Matrix3 R2{r2.value()};
+    const auto reverse = (r1 * z).evalWithJacobians();
+    EXPECT_TRUE(std::get<1>(reverse).isZero());
+    EXPECT_APPROX(R1, std::get<2>(reverse));
+
+    const auto forward = (r2 * (r1 * z)).evalWithJacobians(r1, r2, z);
+    EXPECT_TRUE(std::get<1>(forward).isZero());
+    EXPECT_TRUE(std::get<2>(forward).isZero());
+    EXPECT_APPROX(Matrix3{R2 * R1}, std::get<3>(forward));
+}
+
 TYPED_TEST(RotationTest, inverse) {
     const auto r1 = TestFixture::LeafAB::Random();
     const auto r2 = typename TestFixture::LeafBA{inverse(r1)};
@@ -218,3 +240,128 @@ TEST(RotationMiscTest, constructRotationMMap) {
     EXPECT_APPROX(m, r.value());
     EXPECT_EQ(m.data(), r.value().data());
 }
+
+TEST(RotationMiscTest, conversionsChosenByCost) {
+    using wave::Convert;
+    using A = wave::RotationAd;
+    using M = wave::RotationMd;
+    using Q = wave::RotationQd;
+    using PreparedAA = wave::internal::traits<wave::Compose<A, A>>::PreparedType;
+    using ConvertedAA = wave::Compose<Convert<Q, A>, Convert<Q, A>>;
+    static_assert(std::is_same<PreparedAA, ConvertedAA>{}, "");
+
+    const auto a1 = A::Random();
+    const auto a2 = A::Random();
+    const auto expected = M{Eigen::Matrix3d{a1.value() * a2.value()}};
+    EXPECT_APPROX(expected, M{a1 * a2});
+
+    // The choice can be overridden for a single expression
+    const auto expr = wave::convertTo<M>(a1) * wave::convertTo<M>(a2);
+    using PreparedMM = wave::internal::traits<decltype(expr)>::PreparedType;
+    static_assert(std::is_same<PreparedMM, wave::tmp::remove_cr_t<decltype(expr)>>{}, "");
+    EXPECT_APPROX(expected, M{expr});
+    CHECK_JACOBIANS(false, expr, a1, a2);
+}
+
+TEST(RotationMiscTest, quaternionLogMap) {
+    using Q = wave::RotationQd;
+    using M = wave::RotationMd;
+    const auto q = Q{wave::randomQuaternion<double>()};
+    using LogQ = decltype(wave::log(q));
+    static_assert(std::is_same<wave::internal::traits<LogQ>::PreparedType, LogQ>{},
+                  "The log of a quaternion should not be converted");
+
+    EXPECT_APPROX(wave::log(M{q}), wave::log(q));
+    CHECK_JACOBIANS(true, wave::log(q), q);
+
+    // Negating the quaternion gives the same rotation
+    const auto q_neg = Q{Eigen::Quaterniond{-q.value().coeffs()}};
+    EXPECT_APPROX(wave::log(q).eval().value(), wave::log(q_neg).eval().value());
+
+    // Near zero, including below the threshold for the Taylor expansion
+    const Eigen::Vector3d axis = Eigen::Vector3d{1, -2, 3}.normalized();
+    for (const double angle : {1e-3, 1e-7, 1e-9, 0.0}) {
+        const Eigen::Vector3d phi = angle * axis;
+        const auto q_small = Q{Eigen::AngleAxisd{angle, axis}};
+        EXPECT_TRUE(phi.isApprox(wave::log(q_small).eval().value(), 1e-12) ||
+                    (phi - wave::log(q_small).eval().value()).norm() < 1e-15);
+    }
+
+    // Near pi, where the matrix log loses precision
+    const double angle = M_PI - 1e-9;
+    const auto q_pi = Q{Eigen::AngleAxisd{angle, axis}};
+    EXPECT_TRUE((angle * axis).isApprox(wave::log(q_pi).eval().value(), 1e-12));
+}
+
+TEST(RotationMiscTest, quaternionExpMap) {
+    using Q = wave::RotationQd;
+    using M = wave::RotationMd;
+    using R = wave::RelativeRotationd;
+    const auto q = Q{wave::randomQuaternion<double>()};
+    const auto w = R::Random();
+
+    // A quaternion consumer evaluates the exp map directly as a quaternion
+    using Prepared =
+      wave::internal::traits<wave::Compose<Q, wave::ExpMap<R>>>::PreparedType;
+    static_assert(std::is_same<Prepared, wave::Compose<Q, wave::ExpMapTo<Q, R>>>{}, "");
+    static_assert(std::is_same<decltype((q * wave::exp(w)).eval()), Q>{}, "");
+    static_assert(std::is_same<decltype((q + w).eval()), Q>{}, "");
+
+    const Eigen::Matrix3d expected = q.value() * wave::exp(w).eval().value();
+    EXPECT_APPROX(expected, M{q * wave::exp(w)}.value());
+    // Box-plus composes the exp map on the left
+    const Eigen::Matrix3d exp_w = wave::exp(w).eval().value();
+    EXPECT_APPROX(M{exp_w * exp_w * q.value()}, M{q + w + w});
+    CHECK_JACOBIANS(true, q * wave::exp(w), q, w);
+    CHECK_JACOBIANS(true, q + w, q, w);
+
+    // Small angles
+    for (const double angle : {1e-3, 1e-9, 0.0}) {
+        const auto w_small = R{angle * Eigen::Vector3d{1, -2, 3}.normalized()};
+        const auto q_id = Q{Eigen::Quaterniond::Identity()};
+        EXPECT_APPROX(M{wave::exp(w_small)}, M{q_id * wave::exp(w_small)});
+    }
+
+    // The exp map of a log map is rewritten away
+    EXPECT_APPROX(M{q * q}, M{q * wave::exp(wave::log(q))});
+}
+
+TEST(RotationMiscTest, expMapAccuracy) {
+    using M = wave::RotationMd;
+    using Q = wave::RotationQd;
+    using R = wave::RelativeRotationd;
+    const Eigen::Vector3d axis = Eigen::Vector3d{1, -2, 3}.normalized();
+
+    // Across the threshold for the Taylor expansions, near 1.1e-2, through the range
+    // where 1 - cos(angle) cancels, and up to pi
+    for (const double angle :
+         {3.0, 1.0, 0.1, 1e-2, 1e-3, 1e-4, 1e-5, 1e-6, 1e-7, 3e-8, 1e-8, 1e-12, 0.0}) {
+        const auto w = R{angle * axis};
+        const Eigen::Matrix3d expected =
+          Eigen::AngleAxisd{angle, axis}.toRotationMatrix();
+        EXPECT_TRUE(expected.isApprox(wave::exp(w).eval().value(), 1e-14));
+        EXPECT_TRUE(expected.isApprox(M{Q{wave::exp(w)}}.value(), 1e-14));
+
+        Eigen::Matrix<double, 6, 1> xi;
+        xi << angle * axis, 1, 2, 3;
+        const auto T = wave::exp(wave::Twistd{xi}).eval();
+        EXPECT_TRUE(expected.isApprox(T.rotation().value(), 1e-14));
+
+        // The translation is V t, where V = I + B [w]x + C [w]x^2. Find B and C
+        // without cancellation: B from sin(angle / 2), C from its series when small
+        const double a2 = angle * angle;
+        const double half_sin = std::sin(angle / 2);
+        const double B = angle > 0 ? 2 * half_sin * half_sin / a2 : 0.5;
+        const double C = angle > 1e-2 ? (angle - std::sin(angle)) / (a2 * angle)
+                                     : 1.0 / 6 - a2 * (1.0 / 120 - a2 / 5040);
+        const Eigen::Matrix3d w_cross = wave::crossMatrix(w.value());
+        const Eigen::Matrix3d V =
+          Eigen::Matrix3d::Identity() + B * w_cross + C * w_cross * w_cross;
+        const Eigen::Vector3d expected_t = V * xi.tail<3>();
+        EXPECT_TRUE(expected_t.isApprox(T.translation().value(), 1e-14)) << angle;
+    }
+
+    // An explicit conversion to a quaternion is evaluated directly, with its jacobian
+    const auto w = R::Random();
+    CHECK_JACOBIANS(true, wave::convertTo<Q>(wave::exp(w)), w);
+}
@@ -0,0 +1,125 @@
+/**
+ * @file
+ *
+ * Tests for Shared subexpressions and evaluation of several outputs, comparing against
+ * the same expressions without sharing
+ */
+
+#include "wave/geometry/geometry.hpp"
+#include "test.hpp"
+
+TEST(SharedTest, value) {
+    const auto R1 = wave::RotationQd::Random();
+    const auto R2 = wave::RotationMd::Random();
+    const auto p = wave::Translationd::Random();
+    const auto R12 = share(R1 * R2);
+
+    EXPECT_APPROX(wave::RotationQd{R1 * R2}, wave::RotationQd{R12});
+    EXPECT_APPROX(wave::Translationd{R1 * R2 * p}, wave::Translationd{R12 * p});
+    EXPECT_APPROX(wave::RelativeRotationd{log(R1 * R2)},
+                  wave::RelativeRotationd{log(R12)});
+    EXPECT_APPROX(wave::RotationQd{R1 * R2 * inverse(R1 * R2)},
+                  wave::RotationQd{R12 * inverse(R12)});
+}
+
+TEST(SharedTest, jacobians) {
+    const auto R1 = wave::RotationQd::Random();
+    const auto R2 = wave::RotationQd::Random();
+    const auto p = wave::Translationd::Random();
+    const auto R12 = share(R1 * R2);
+
+    const auto expected =
+      (R1 * R2 * inverse(R1 * R2 * R1) * p).evalWithJacobians(R1, R2, p);
+    const auto actual = (R12 * inverse(R12 * R1) * p).evalWithJacobians(R1, R2, p);
+    EXPECT_APPROX(std::get<0>(expected), std::get<0>(actual));
+    EXPECT_PRED2(MatricesApprox, std::get<1>(expected), std::get<1>(actual));
+    EXPECT_PRED2(MatricesApprox, std::get<2>(expected), std::get<2>(actual));
+    EXPECT_PRED2(MatricesApprox, std::get<3>(expected), std::get<3>(actual));
+
+    // One jacobian at a time
+    EXPECT_PRED2(MatricesApprox,
+                 std::get<1>(expected),
+                 (R12 * inverse(R12 * R1) * p).jacobian(R1));
+}
+
+TEST(SharedTest, jacobianOfShared) {
+    const auto R1 = wave::RotationQd::Random();
+    const auto R2 = wave::RotationQd::Random();
+    const auto p = wave::Translationd::Random();
+    const auto R12 = share(R1 * R2);
+
+    // The shared node is itself a valid target
+    const wave::RotationQd R12_copy{R1 * R2};
+    const auto expected = (R12_copy * p).evalWithJacobians(R12_copy);
+    const auto actual = (R12 * p).evalWithJacobians(R12, R1);
+    EXPECT_PRED2(MatricesApprox, std::get<1>(expected), std::get<1>(actual));
+}
+
+TEST(SharedTest, nested) {
+    const auto R1 = wave::RotationQd::Random();
+    const auto R2 = wave::RotationQd::Random();
+    const auto R3 = wave::RotationMd::Random();
+    const auto p = wave::Translationd::Random();
+    const auto R12 = share(R1 * R2);
+    const auto R123 = share(R12 * R3);
+
+    const auto expected =
+      (R1 * R2 * R3 * (R1 * R2 * p) + R1 * R2 * R3 * p).evalWithJacobians(R1, R2, R3, p);
+    const auto actual = (R123 * (R12 * p) + R123 * p).evalWithJacobians(R1, R2, R3, p);
+    EXPECT_APPROX(std::get<0>(expected), std::get<0>(actual));
+    EXPECT_PRED2(MatricesApprox, std::get<1>(expected), std::get<1>(actual));
+    EXPECT_PRED2(MatricesApprox, std::get<2>(expected), std::get<2>(actual));
+    EXPECT_PRED2(MatricesApprox, std::get<3>(expected), std::get<3>(actual));
+    EXPECT_PRED2(MatricesApprox, std::get<4>(expected), std::get<4>(actual));
+}
+
+TEST(SharedTest, multiOutput) {
+    const auto T1 = wave::RigidTransformQd::Random();
+    const auto T2 = wave::RigidTransformMd::Random();
+    const auto p = wave::Translationd::Random();
+    const auto T12 = share(inverse(T1) * T2);
+
+    const auto res =
+      evalMultiWithJacobians(std::forward_as_tuple(log(T12), T12 * p, T1 * p), T1, T2, p);
+
+    const auto expected_log = log(inverse(T1) * T2).evalWithJacobians(T1, T2);
+    const auto &actual_log = std::get<0>(res);
+    EXPECT_APPROX(std::get<0>(expected_log), std::get<0>(actual_log));
+    EXPECT_PRED2(MatricesApprox, std::get<1>(expected_log), std::get<1>(actual_log));
+    EXPECT_PRED2(MatricesApprox, std::get<2>(expected_log), std::get<2>(actual_log));
+    EXPECT_TRUE(std::get<3>(actual_log).isZero());
+
+    const auto expected_point = (inverse(T1) * T2 * p).evalWithJacobians(T1, T2, p);
+    const auto &actual_point = std::get<1>(res);
+    EXPECT_APPROX(std::get<0>(expected_point), std::get<0>(actual_point));
+    EXPECT_PRED2(MatricesApprox, std::get<1>(expected_point), std::get<1>(actual_point));
+    EXPECT_PRED2(MatricesApprox, std::get<2>(expected_point), std::get<2>(actual_point));
+    EXPECT_PRED2(MatricesApprox, std::get<3>(expected_point), std::get<3>(actual_point));
+
+    const auto expected_unshared = (T1 * p).evalWithJacobians(T1, p);
+    const auto &actual_unshared = std::get<2>(res);
+    EXPECT_APPROX(std::get<0>(expected_unshared), std::get<0>(actual_unshared));
+    EXPECT_PRED2(
+      MatricesApprox, std::get<1>(expected_unshared), std::get<1>(actual_unshared));
+    EXPECT_TRUE(std::get<2>(actual_unshared).isZero());
+    EXPECT_PRED2(
+      MatricesApprox, std::get<2>(expected_unshared), std::get<3>(actual_unshared));
+}
+
+TEST(SharedTest, framed) {
+    const auto R1 = wave::RotationQFd<FrameA, FrameB>::Random();
+    const auto R2 = wave::RotationQFd<FrameB, FrameC>::Random();
+    const auto p = wave::TranslationFd<FrameC, FrameC, FrameD>::Random();
+    const auto R12 = share(R1 * R2);
+
+    const wave::TranslationFd<FrameA, FrameC, FrameD> expected_value = R1 * R2 * p;
+    const wave::TranslationFd<FrameA, FrameC, FrameD> actual_value = R12 * p;
+    EXPECT_APPROX(expected_value, actual_value);
+
+    const auto res =
+      evalMultiWithJacobians(std::forward_as_tuple(R12 * p, log(R12)), R1, p);
+    const auto expected = (R1 * R2 * p).evalWithJacobians(R1, p);
+    EXPECT_APPROX(std::get<0>(expected), std::get<0>(std::get<0>(res)));
+    EXPECT_PRED2(MatricesApprox, std::get<1>(expected), std::get<1>(std::get<0>(res)));
+    EXPECT_PRED2(MatricesApprox, std::get<2>(expected), std::get<2>(std::get<0>(res)));
+}
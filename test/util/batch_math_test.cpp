@@ -0,0 +1,97 @@
+#include "wave/geometry/src/util/math/BatchMath.hpp"
+#include "../test.hpp"
+
+namespace {
+
+/** Inputs spanning several periods, with odd length so some lanes are in a packet tail */
+Eigen::ArrayXd linspace(double a, double b, int n = 100001) {
+    return Eigen::ArrayXd::LinSpaced(n, a, b);
+}
+
+/** Largest absolute difference between f applied to each lane and the batch result */
+template <typename F>
+double maxError(const Eigen::ArrayXd &x, const Eigen::ArrayXd &res, F f) {
+    double err = 0;
+    for (Eigen::Index i = 0; i < x.size(); ++i) {
+        err = std::max(err, std::abs(res[i] - f(x[i])));
+    }
+    return err;
+}
+
+const double tolerance = 4 * Eigen::NumTraits<double>::epsilon();
+
+}  // namespace
+
+TEST(BatchMathTest, sinCos) {
+    const Eigen::ArrayXd x = linspace(-40, 40);
+    Eigen::ArrayXd s, c;
+    wave::batchSinCos(x, s, c);
+
+    EXPECT_LT(maxError(x, s, [](double v) { return std::sin(v); }), tolerance);
+    EXPECT_LT(maxError(x, c, [](double v) { return std::cos(v); }), tolerance);
+}
+
+TEST(BatchMathTest, sinCosQuadrantBoundaries) {
+    Eigen::ArrayXd x(9);
+    x << 0, M_PI_4, M_PI_2, 3 * M_PI_4, M_PI, -M_PI_2, -M_PI, 2 * M_PI, 1e6;
+    Eigen::ArrayXd s, c;
+    wave::batchSinCos(x, s, c);
+
+    EXPECT_LT(maxError(x, s, [](double v) { return std::sin(v); }), tolerance);
+    EXPECT_LT(maxError(x, c, [](double v) { return std::cos(v); }), tolerance);
+}
+
+TEST(BatchMathTest, atan) {
+    const Eigen::ArrayXd x = linspace(-30, 30).cube();
+    const Eigen::ArrayXd res = wave::batchAtan(x);
+
+    EXPECT_LT(maxError(x, res, [](double v) { return std::atan(v); }), tolerance);
+}
+
+TEST(BatchMathTest, atan2) {
+    const Eigen::ArrayXd y = linspace(-2, 2);
+    const Eigen::ArrayXd x = linspace(-3, 1).reverse();
+    const Eigen::ArrayXd res = wave::batchAtan2(y, x);
+
+    double err = 0;
+    for (Eigen::Index i = 0; i < x.size(); ++i) {
+        err = std::max(err, std::abs(res[i] - std::atan2(y[i], x[i])));
+    }
+    EXPECT_LT(err, tolerance);
+}
+
+TEST(BatchMathTest, acos) {
+    const Eigen::ArrayXd x = linspace(-1, 1);
+    const Eigen::ArrayXd res = wave::batchAcos(x);
+
+    EXPECT_LT(maxError(x, res, [](double v) { return std::acos(v); }), tolerance);
+}
+
+TEST(BatchMathTest, selectIgnoresUnselectedLanes) {
+    Eigen::ArrayXd mask(5), a(5), b(5);
+    mask << 1, 0, 1, 0, 0;
+    a << 1, NAN, 3, INFINITY, NAN;
+    b << NAN, 2, NAN, 4, 5;
+    const Eigen::ArrayXd res = wave::batchSelect(mask, a, b);
+
+    const Eigen::ArrayXd expected = Eigen::ArrayXd::LinSpaced(5, 1, 5);
+    EXPECT_EQ(expected.matrix(), res.matrix());
+}
+
+TEST(BatchMathTest, step) {
+    Eigen::ArrayXd a(5), b(5), expected(5);
+    a << -1, 0, 1, 2, -0.0;
+    b << 0, 0, 2, 1, 0;
+    expected << 0, 1, 0, 1, 1;
+    const Eigen::ArrayXd res = wave::batchStep(a, b);
+
+    EXPECT_EQ(expected.matrix(), res.matrix());
+}
+
+TEST(BatchMathTest, floor) {
+    Eigen::ArrayXd x = linspace(-1e6, 1e6, 40000);
+    x.head(9) << 0, -0.0, 0.5, -0.5, 2.5, -2.5, 3, -3, 1 - 1e-16;
+    const Eigen::ArrayXd res = wave::batchFloor(x);
+
+    EXPECT_EQ(0, maxError(x, res, [](double v) { return std::floor(v); }));
+}
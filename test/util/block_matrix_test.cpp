@@ -0,0 +1,207 @@
+#include "wave/geometry/src/util/math/IdentityMatrix.hpp"
+#include "wave/geometry/src/util/math/ZeroMatrix.hpp"
+#include "wave/geometry/src/util/math/BlockMatrix.hpp"
+#include "wave/geometry/src/util/math/AdjointMatrix.hpp"
+#include "../test.hpp"
+
+namespace {
+
+using Mat3 = Eigen::Matrix3d;
+using Mat6 = Eigen::Matrix<double, 6, 6>;
+using Lower = wave::BlockLowerTriangular<double, 3>;
+using Diagonal = wave::BlockDiagonal<double, 3>;
+using Adjoint = wave::AdjointMatrix<double>;
+using Vec3 = Eigen::Vector3d;
+
+Lower randomLower() {
+    return Lower{Mat3::Random(), Mat3::Random(), Mat3::Random()};
+}
+
+Adjoint randomAdjoint() {
+    return Adjoint{Mat3{Eigen::Quaterniond::UnitRandom()}, Vec3::Random()};
+}
+
+}  // namespace
+
+TEST(BlockMatrixTest, construct) {
+    const Mat3 a = Mat3::Random();
+    const Mat3 c = Mat3::Random();
+    const Mat3 d = Mat3::Random();
+    Mat6 expected;
+    expected << a, Mat3::Zero(), c, d;
+    EXPECT_EQ(expected, Mat6{Lower(a, c, d)});
+
+    expected << a, Mat3::Zero(), Mat3::Zero(), a;
+    EXPECT_EQ(expected, Mat6{Diagonal{a}});
+}
+
+TEST(BlockMatrixTest, negate) {
+    const auto m = randomLower();
+    const Mat6 expected = -Mat6{m};
+    const Lower negated = -m;
+    EXPECT_EQ(expected, Mat6{negated});
+
+    // Binary minus is still a dense operation
+    EXPECT_EQ(Mat6::Zero(), Mat6{m - m});
+}
+
+TEST(BlockMatrixTest, multiplyLower) {
+    const auto m1 = randomLower();
+    const auto m2 = randomLower();
+    const Mat6 dense = Mat6::Random();
+    const Eigen::Matrix<double, 3, 6> wide = Eigen::Matrix<double, 3, 6>::Random();
+    const Eigen::Matrix<double, 6, 1> vec = Eigen::Matrix<double, 6, 1>::Random();
+
+    static_assert(std::is_same<decltype(m1 * m2), Lower>{}, "");
+    EXPECT_APPROX(Mat6{Mat6{m1} * Mat6{m2}}, Mat6{m1 * m2});
+    EXPECT_APPROX(Mat6{Mat6{m1} * dense}, Mat6{m1 * dense});
+    EXPECT_APPROX(Mat6{dense * Mat6{m1}}, Mat6{dense * m1});
+    EXPECT_APPROX((Eigen::Matrix<double, 3, 6>{wide * Mat6{m1}}),
+                  (Eigen::Matrix<double, 3, 6>{wide * m1}));
+    EXPECT_APPROX((Eigen::Matrix<double, 6, 1>{Mat6{m1} * vec}),
+                  (Eigen::Matrix<double, 6, 1>{m1 * vec}));
+
+    // A lazy operand is evaluated once
+    EXPECT_APPROX(Mat6{Mat6{m1} * (dense * dense)}, Mat6{m1 * (dense * dense)});
+}
+
+TEST(BlockMatrixTest, multiplyDiagonal) {
+    const Diagonal d1{Mat3::Random()};
+    const Diagonal d2{Mat3::Random()};
+    const auto m = randomLower();
+    const Mat6 dense = Mat6::Random();
+
+    static_assert(std::is_same<decltype(d1 * d2), Diagonal>{}, "");
+    static_assert(std::is_same<decltype(d1 * m), Lower>{}, "");
+    static_assert(std::is_same<decltype(m * d1), Lower>{}, "");
+    EXPECT_APPROX(Mat6{Mat6{d1} * Mat6{d2}}, Mat6{d1 * d2});
+    EXPECT_APPROX(Mat6{Mat6{d1} * Mat6{m}}, Mat6{d1 * m});
+    EXPECT_APPROX(Mat6{Mat6{m} * Mat6{d1}}, Mat6{m * d1});
+    EXPECT_APPROX(Mat6{Mat6{d1} * dense}, Mat6{d1 * dense});
+    EXPECT_APPROX(Mat6{dense * Mat6{d1}}, Mat6{dense * d1});
+}
+
+// Ensure there are no ambiguous overloaded operator issues
+TEST(BlockMatrixTest, multiplyIdentity) {
+    using Identity6d = wave::IdentityMatrix<double, 6>;
+    const auto m = randomLower();
+    const Diagonal d{Mat3::Random()};
+
+    static_assert(std::is_same<decltype(Identity6d{} * m), const Lower &>{}, "");
+    EXPECT_EQ(Mat6{m}, Mat6{Identity6d{} * m});
+    EXPECT_EQ(Mat6{m}, Mat6{m * Identity6d{}});
+    EXPECT_EQ(Mat6{d}, Mat6{Identity6d{} * d});
+    EXPECT_EQ(Mat6{d}, Mat6{d * Identity6d{}});
+}
+
+TEST(AdjointMatrixTest, construct) {
+    const Mat3 R{Eigen::Quaterniond::UnitRandom()};
+    const Vec3 t = Vec3::Random();
+    Mat6 expected;
+    expected << R, Mat3::Zero(), wave::crossMatrix(t) * R, R;
+    EXPECT_APPROX(expected, Mat6{Adjoint(R, t)});
+    EXPECT_APPROX(Mat6{-expected}, Mat6{Lower{-Adjoint(R, t)}});
+}
+
+TEST(AdjointMatrixTest, multiply) {
+    const auto a1 = randomAdjoint();
+    const auto a2 = randomAdjoint();
+    const auto m = randomLower();
+    const Diagonal d{Mat3::Random()};
+    const Mat6 dense = Mat6::Random();
+    const Eigen::Matrix<double, 3, 6> wide = Eigen::Matrix<double, 3, 6>::Random();
+    const Eigen::Matrix<double, 6, 1> vec = Eigen::Matrix<double, 6, 1>::Random();
+
+    // Adjoints compose in closed form
+    static_assert(std::is_same<decltype(a1 * a2), Adjoint>{}, "");
+    static_assert(std::is_same<decltype(a1 * m), Lower>{}, "");
+    static_assert(std::is_same<decltype(m * a1), Lower>{}, "");
+    static_assert(std::is_same<decltype(a1 * d), Lower>{}, "");
+    static_assert(std::is_same<decltype(d * a1), Lower>{}, "");
+    EXPECT_APPROX(Mat6{Mat6{a1} * Mat6{a2}}, Mat6{a1 * a2});
+    EXPECT_APPROX(Mat6{Mat6{a1} * Mat6{m}}, Mat6{a1 * m});
+    EXPECT_APPROX(Mat6{Mat6{m} * Mat6{a1}}, Mat6{m * a1});
+    EXPECT_APPROX(Mat6{Mat6{a1} * Mat6{d}}, Mat6{a1 * d});
+    EXPECT_APPROX(Mat6{Mat6{d} * Mat6{a1}}, Mat6{d * a1});
+    EXPECT_APPROX(Mat6{Mat6{a1} * dense}, Mat6{a1 * dense});
+    EXPECT_APPROX(Mat6{dense * Mat6{a1}}, Mat6{dense * a1});
+    EXPECT_APPROX((Eigen::Matrix<double, 3, 6>{wide * Mat6{a1}}),
+                  (Eigen::Matrix<double, 3, 6>{wide * a1}));
+    EXPECT_APPROX((Eigen::Matrix<double, 6, 1>{Mat6{a1} * vec}),
+                  (Eigen::Matrix<double, 6, 1>{a1 * vec}));
+    EXPECT_APPROX(Mat6{Mat6{a1} * (dense * dense)}, Mat6{a1 * (dense * dense)});
+}
+
+// A block-diagonal matrix need not hold a rotation, so its products with adjoints are
+// not adjoints
+TEST(AdjointMatrixTest, multiplyNonRotationDiagonal) {
+    const auto a1 = randomAdjoint();
+    const auto a2 = randomAdjoint();
+    const Diagonal d = -Diagonal{Mat3::Identity()};
+
+    EXPECT_APPROX(Mat6{Mat6{a1} * Mat6{d}}, Mat6{a1 * d});
+    EXPECT_APPROX(Mat6{Mat6{d} * Mat6{a1}}, Mat6{d * a1});
+    EXPECT_APPROX(Mat6{Mat6{a1} * Mat6{d} * Mat6{a2}}, Mat6{(a1 * d) * a2});
+    EXPECT_APPROX(Mat6{Mat6{a1} * Mat6{d} * Mat6{a2}}, Mat6{a1 * (d * a2)});
+}
+
+// Ensure there are no ambiguous overloaded operator issues
+TEST(AdjointMatrixTest, multiplyIdentityAndZero) {
+    using Identity6d = wave::IdentityMatrix<double, 6>;
+    using Zero61 = wave::ZeroMatrix<double, 6, 1>;
+    using Zero16 = wave::ZeroMatrix<double, 1, 6>;
+    const auto a = randomAdjoint();
+
+    static_assert(std::is_same<decltype(Identity6d{} * a), const Adjoint &>{}, "");
+    static_assert(std::is_same<decltype(a * Zero61{}), Zero61>{}, "");
+    EXPECT_EQ(Mat6{a}, Mat6{Identity6d{} * a});
+    EXPECT_EQ(Mat6{a}, Mat6{a * Identity6d{}});
+    EXPECT_TRUE((Eigen::Matrix<double, 1, 6>{Zero16{} * a}.isZero()));
+}
+
+TEST(ZeroMatrixTest, multiply) {
+    using Zero36 = wave::ZeroMatrix<double, 3, 6>;
+    using Identity3d = wave::IdentityMatrix<double, 3>;
+    const Mat6 dense = Mat6::Random();
+    const Eigen::Matrix<double, 2, 3> wide = Eigen::Matrix<double, 2, 3>::Random();
+
+    static_assert(
+      std::is_same<decltype(Zero36{} * dense), wave::ZeroMatrix<double, 3, 6>>{}, "");
+    static_assert(
+      std::is_same<decltype(wide * Zero36{}), wave::ZeroMatrix<double, 2, 6>>{}, "");
+    static_assert(std::is_same<decltype(Zero36{} * wave::ZeroMatrix<double, 6, 1>{}),
+                               wave::ZeroMatrix<double, 3, 1>>{},
+                  "");
+    EXPECT_TRUE((Eigen::Matrix<double, 3, 6>{Zero36{}}.isZero()));
+    EXPECT_TRUE((Eigen::Matrix<double, 3, 6>{Identity3d{} * Zero36{}}.isZero()));
+    EXPECT_TRUE((Eigen::Matrix<double, 3, 6>{Zero36{} * dense}.isZero()));
+}
+
+// Ensure there are no ambiguous overloaded operator issues
+TEST(ZeroMatrixTest, multiplyStructured) {
+    using Zero66 = wave::ZeroMatrix<double, 6, 6>;
+    using Zero33 = wave::ZeroMatrix<double, 3, 3>;
+    const auto m = randomLower();
+    const auto a = randomAdjoint();
+    const Diagonal d{Mat3::Random()};
+    const Vec3 v = Vec3::Random();
+
+    static_assert(std::is_same<decltype(Zero66{} * m), Zero66>{}, "");
+    static_assert(std::is_same<decltype(m * Zero66{}), Zero66>{}, "");
+    static_assert(std::is_same<decltype(Zero66{} * d), Zero66>{}, "");
+    static_assert(std::is_same<decltype(d * Zero66{}), Zero66>{}, "");
+    static_assert(std::is_same<decltype(Zero66{} * a), Zero66>{}, "");
+    static_assert(std::is_same<decltype(a * Zero66{}), Zero66>{}, "");
+    static_assert(std::is_same<decltype(Zero33{} * wave::crossMatrix(v)), Zero33>{}, "");
+    static_assert(std::is_same<decltype(wave::crossMatrix(v) * Zero33{}), Zero33>{}, "");
+
+    // The result does not refer to the operands, so binding it to a reference is safe
+    const auto &z = Zero66{} * d;
+    EXPECT_TRUE(Mat6{z}.isZero());
+    EXPECT_TRUE(Mat6{Zero66{} * m}.isZero());
+    EXPECT_TRUE(Mat6{m * Zero66{}}.isZero());
+    EXPECT_TRUE(Mat6{Zero66{} * d}.isZero());
+    EXPECT_TRUE(Mat6{d * Zero66{}}.isZero());
+    EXPECT_TRUE(Mat3{Zero33{} * wave::crossMatrix(v)}.isZero());
+    EXPECT_TRUE(Mat3{wave::crossMatrix(v) * Zero33{}}.isZero());
+}
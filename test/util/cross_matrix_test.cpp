@@ -175,3 +175,52 @@ TEST(CrossMatrixTest, attributes) {
     EXPECT_EQ(3, crossExpr.rows());
     EXPECT_EQ(3, crossExpr.cols());
 }
+
+TEST(CrossMatrixTest, multiplyCrossMatricesClosedForm) {
+    Eigen::Vector3d a, b;
+    for (int reps = 100; reps--;) {
+        a.setRandom();
+        b.setRandom();
+
+        const Eigen::Matrix3d expected = manualCrossMatrix(a) * manualCrossMatrix(b);
+        const Eigen::Matrix3d actual = wave::crossMatrix(a) * wave::crossMatrix(b);
+        EXPECT_APPROX(expected, actual);
+
+        // The square of a cross matrix is symmetric
+        const Eigen::Matrix3d square = wave::crossMatrix(a) * wave::crossMatrix(a);
+        const Eigen::Matrix3d manual_square = manualCrossMatrix(a) * manualCrossMatrix(a);
+        EXPECT_APPROX(manual_square, square);
+        EXPECT_EQ(square, square.transpose());
+    }
+}
+
+TEST(CrossMatrixTest, scalarMultiple) {
+    const Eigen::Vector3d a = Eigen::Vector3d::Random();
+    const Eigen::Vector3d b = Eigen::Vector3d::Random();
+    const double s = 2.5;
+
+    // A scalar multiple is still a cross matrix
+    using Scaled = decltype(s * wave::crossMatrix(a));
+    static_assert(std::is_same<Scaled, decltype(wave::crossMatrix(a) * s)>{}, "");
+    const auto scaled = s * wave::crossMatrix(a);
+    EXPECT_APPROX(Eigen::Matrix3d{s * manualCrossMatrix(a)}, Eigen::Matrix3d{scaled});
+    EXPECT_APPROX(Eigen::Matrix3d{manualCrossMatrix(a) * 2},
+                  Eigen::Matrix3d{wave::crossMatrix(a) * 2});
+    EXPECT_APPROX(Eigen::Matrix3d{manualCrossMatrix(a) / s},
+                  Eigen::Matrix3d{wave::crossMatrix(a) / s});
+
+    // Products of the multiple still use the cross product
+    EXPECT_APPROX(Eigen::Vector3d{s * a.cross(b)}, Eigen::Vector3d{scaled * b});
+    EXPECT_APPROX(Eigen::Matrix3d{s * manualCrossMatrix(a) * manualCrossMatrix(b)},
+                  Eigen::Matrix3d{scaled * wave::crossMatrix(b)});
+}
+
+TEST(CrossMatrixTest, subtract) {
+    const Eigen::Vector3d a = Eigen::Vector3d::Random();
+    const Eigen::Matrix3d m = Eigen::Matrix3d::Random();
+
+    EXPECT_APPROX(Eigen::Matrix3d{manualCrossMatrix(a) - m},
+                  Eigen::Matrix3d{wave::crossMatrix(a) - m});
+    EXPECT_APPROX(Eigen::Matrix3d{m - manualCrossMatrix(a)},
+                  Eigen::Matrix3d{m - wave::crossMatrix(a)});
+}
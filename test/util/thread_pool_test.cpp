@@ -0,0 +1,93 @@
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+
+#include "wave/geometry/src/util/parallel/ThreadPool.hpp"
+#include "../test.hpp"
+
+namespace wave {
+
+namespace {
+
+/** Runs a loop and checks each index in [0, n) was visited exactly once */
+void checkCoversRange(ThreadPool &pool, std::size_t n, std::size_t grain) {
+    std::vector<std::atomic<int>> visits(n);
+    for (auto &v : visits) {
+        v = 0;
+    }
+    std::atomic<std::size_t> max_range{0};
+
+    pool.parallelFor(n, grain, [&](std::size_t begin, std::size_t end) {
+        ASSERT_LT(begin, end);
+        ASSERT_LE(end, n);
+        for (auto i = begin; i < end; ++i) {
+            ++visits[i];
+        }
+        auto prev = max_range.load();
+        while (end - begin > prev &&
+               !max_range.compare_exchange_weak(prev, end - begin)) {
+        }
+    });
+
+    for (std::size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(1, visits[i]) << "at index " << i;
+    }
+    EXPECT_LE(max_range, std::max(grain, std::size_t{1}));
+}
+
+}  // namespace
+
+TEST(ThreadPoolTest, numThreads) {
+    EXPECT_EQ(1u, ThreadPool{1}.numThreads());
+    EXPECT_EQ(4u, ThreadPool{4}.numThreads());
+    EXPECT_LE(1u, ThreadPool{}.numThreads());
+}
+
+TEST(ThreadPoolTest, coversRange) {
+    for (const unsigned int num_threads : {1u, 2u, 5u}) {
+        ThreadPool pool{num_threads};
+        checkCoversRange(pool, 1000, 16);
+        checkCoversRange(pool, 1000, 7);
+        checkCoversRange(pool, 3, 16);
+        checkCoversRange(pool, 1, 1);
+        checkCoversRange(pool, 100, 0);
+    }
+}
+
+TEST(ThreadPoolTest, emptyRange) {
+    ThreadPool pool{3};
+    bool called = false;
+    pool.parallelFor(0, 8, [&](std::size_t, std::size_t) { called = true; });
+    EXPECT_FALSE(called);
+}
+
+TEST(ThreadPoolTest, reusedManyTimes) {
+    ThreadPool pool{4};
+    std::atomic<std::size_t> sum{0};
+    for (int k = 0; k < 200; ++k) {
+        pool.parallelFor(50, 3, [&](std::size_t begin, std::size_t end) {
+            for (auto i = begin; i < end; ++i) {
+                sum += i;
+            }
+        });
+    }
+    EXPECT_EQ(200u * (49u * 50u / 2u), sum);
+}
+
+TEST(ThreadPoolTest, unevenWorkIsShared) {
+    // All of the work is in the first thread's part; other threads must steal it
+    ThreadPool pool{4};
+    std::mutex mutex;
+    std::set<std::thread::id> ids;
+    pool.parallelFor(4000, 1, [&](std::size_t begin, std::size_t) {
+        if (begin < 1000) {
+            std::this_thread::sleep_for(std::chrono::microseconds{200});
+            std::lock_guard<std::mutex> lock{mutex};
+            ids.insert(std::this_thread::get_id());
+        }
+    });
+    EXPECT_LT(1u, ids.size());
+}
+
+}  // namespace wave
@@ -100,6 +100,19 @@ void test_concat_if_unique() {
     static_assert(concat_if_unique<E, E>{}, "");
 };
 
+void test_concat_unique() {
+    using A = type_list<int, bool>;
+    using C = type_list<float, bool, double, float>;
+    using E = type_list<>;
+
+    static_assert(
+      std::is_same<concat_unique_t<A, C>, type_list<int, bool, float, double>>{}, "");
+    static_assert(std::is_same<concat_unique_t<A, A>, A>{}, "");
+    static_assert(std::is_same<concat_unique_t<A, E>, A>{}, "");
+    static_assert(std::is_same<concat_unique_t<E, A>, A>{}, "");
+    static_assert(std::is_same<concat_unique_t<E, E>, E>{}, "");
+};
+
 void test_has_unique_leaves() {
     using wave::internal::unique_leaves_t;
 